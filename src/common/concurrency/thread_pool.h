@@ -0,0 +1,159 @@
+// ToriYomi - 고정 크기 스레드 풀
+// 짧은 CPU 작업(형태소 분석 등)을 여러 코어에 나눠 실행
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace toriyomi {
+namespace concurrency {
+
+/**
+ * @brief 고정 개수 작업 스레드와 FIFO 작업 큐
+ *
+ * 소멸 시 큐에 남은 작업까지 모두 실행한 뒤 스레드를 합류시킵니다.
+ */
+class ThreadPool {
+public:
+    /**
+     * @param threadCount 작업 스레드 수 (0이면 코어 수 - 1, 최소 1)
+     */
+    explicit ThreadPool(std::size_t threadCount = 0) {
+        if (threadCount == 0) {
+            const unsigned cores = std::thread::hardware_concurrency();
+            threadCount = std::max(1u, cores > 1 ? cores - 1 : 1u);
+        }
+        workers_.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t ThreadCount() const { return workers_.size(); }
+
+    /**
+     * @brief 작업을 큐에 넣음 (결과가 필요하면 작업 안에서 전달)
+     */
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    /**
+     * @brief body(0..count-1)를 풀과 호출 스레드가 나눠 실행하고 모두 끝날 때까지 대기
+     *
+     * 호출 스레드도 인덱스를 가져가 처리하므로 풀 작업 안에서 호출해도 교착되지 않으며,
+     * 풀이 바쁘면 호출 스레드 혼자 전부 처리합니다. body는 서로 다른 인덱스에 대해
+     * 동시에 호출되어도 안전해야 합니다.
+     */
+    template <typename Body>
+    void ParallelFor(std::size_t count, Body&& body) {
+        if (count == 0) {
+            return;
+        }
+        if (count == 1 || workers_.empty()) {
+            for (std::size_t i = 0; i < count; ++i) {
+                body(i);
+            }
+            return;
+        }
+
+        // 늦게 시작한 도우미 작업이 호출 반환 이후에도 안전하게 빠져나가도록 상태는 공유 소유
+        struct State {
+            std::atomic<std::size_t> next{0};
+            std::size_t count = 0;
+            std::size_t completed = 0;
+            std::mutex mutex;
+            std::condition_variable done;
+            std::function<void(std::size_t)> body;
+        };
+        auto state = std::make_shared<State>();
+        state->count = count;
+        state->body = [&body](std::size_t i) { body(i); };
+
+        auto drain = [](State& s) {
+            std::size_t finished = 0;
+            for (std::size_t i = s.next.fetch_add(1); i < s.count; i = s.next.fetch_add(1)) {
+                s.body(i);
+                ++finished;
+            }
+            if (finished > 0) {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                s.completed += finished;
+                if (s.completed == s.count) {
+                    s.done.notify_all();
+                }
+            }
+        };
+
+        const std::size_t helpers = std::min(workers_.size(), count - 1);
+        for (std::size_t i = 0; i < helpers; ++i) {
+            Submit([state, drain]() { drain(*state); });
+        }
+        drain(*state);
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&]() { return state->completed == state->count; });
+    }
+
+private:
+    void WorkerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
+
+/**
+ * @brief 프로세스 전체가 함께 쓰는 풀 (첫 사용 시 생성)
+ */
+inline ThreadPool& SharedThreadPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+}  // namespace concurrency
+}  // namespace toriyomi
@@ -0,0 +1,383 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TORIYOMI_TEXT_HAS_SSE2 1
+#endif
+
+namespace toriyomi::text {
+
+/**
+ * @brief 일본어 처리에 필요한 문자 분류
+ */
+enum class Script : std::uint8_t {
+    Other,
+    Ascii,
+    Kanji,              // CJK 통합 한자 (+ 々〆〇)
+    Hiragana,
+    Katakana,           // ー 포함
+    HalfwidthKatakana,  // ｦ ~ ﾟ
+    Punctuation,        // CJK 기호/구두점, 반각 구두점
+    Fullwidth           // 전각 영숫자/기호 (！ ~ ｠)
+};
+
+inline constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+namespace detail {
+
+constexpr Script ClassifyByRange(char32_t cp) {
+    if (cp < 0x80) {
+        return Script::Ascii;
+    }
+    if (cp == 0x3005 || cp == 0x3006 || cp == 0x3007) {
+        return Script::Kanji;  // 々 〆 〇
+    }
+    if (cp >= 0x3000 && cp <= 0x303F) {
+        return Script::Punctuation;
+    }
+    if (cp >= 0x3041 && cp <= 0x309F) {
+        return Script::Hiragana;
+    }
+    if (cp == 0x30A0 || cp == 0x30FB) {
+        return Script::Punctuation;  // ゠ ・
+    }
+    if ((cp >= 0x30A1 && cp <= 0x30FF) || (cp >= 0x31F0 && cp <= 0x31FF)) {
+        return Script::Katakana;
+    }
+    if ((cp >= 0x4E00 && cp <= 0x9FFF) || (cp >= 0x3400 && cp <= 0x4DBF) ||
+        (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x20000 && cp <= 0x2FA1F)) {
+        return Script::Kanji;
+    }
+    if (cp >= 0xFF01 && cp <= 0xFF60) {
+        return Script::Fullwidth;
+    }
+    if (cp >= 0xFF61 && cp <= 0xFF65) {
+        return Script::Punctuation;
+    }
+    if (cp >= 0xFF66 && cp <= 0xFF9F) {
+        return Script::HalfwidthKatakana;
+    }
+    return Script::Other;
+}
+
+template <char32_t Base, std::size_t Count>
+constexpr std::array<Script, Count> MakeScriptTable() {
+    std::array<Script, Count> table{};
+    for (std::size_t i = 0; i < Count; ++i) {
+        table[i] = ClassifyByRange(Base + static_cast<char32_t>(i));
+    }
+    return table;
+}
+
+// 자주 나오는 두 블록은 표로 바로 조회 (U+3000~30FF: 기호/가나, U+FF00~FFEF: 전각/반각)
+inline constexpr auto kCjkKanaTable = MakeScriptTable<0x3000, 0x100>();
+inline constexpr auto kHalfFullwidthTable = MakeScriptTable<0xFF00, 0xF0>();
+
+}  // namespace detail
+
+/**
+ * @brief 코드포인트 문자 분류
+ */
+constexpr Script ClassifyCodePoint(char32_t cp) {
+    if (cp < 0x80) {
+        return Script::Ascii;
+    }
+    if (cp >= 0x3000 && cp < 0x3100) {
+        return detail::kCjkKanaTable[cp - 0x3000];
+    }
+    if (cp >= 0xFF00 && cp < 0xFFF0) {
+        return detail::kHalfFullwidthTable[cp - 0xFF00];
+    }
+    return detail::ClassifyByRange(cp);
+}
+
+constexpr bool IsKanji(char32_t cp) {
+    return ClassifyCodePoint(cp) == Script::Kanji;
+}
+
+constexpr bool IsHiragana(char32_t cp) {
+    return ClassifyCodePoint(cp) == Script::Hiragana;
+}
+
+constexpr bool IsKatakana(char32_t cp) {
+    return ClassifyCodePoint(cp) == Script::Katakana;
+}
+
+/**
+ * @brief 히라가나/가타카나/반각 가타카나 여부
+ */
+constexpr bool IsKana(char32_t cp) {
+    const Script script = ClassifyCodePoint(cp);
+    return script == Script::Hiragana || script == Script::Katakana || script == Script::HalfwidthKatakana;
+}
+
+/**
+ * @brief 일본어 본문 문자(한자/가나/CJK 기호/전각) 여부
+ */
+constexpr bool IsJapaneseScript(char32_t cp) {
+    const Script script = ClassifyCodePoint(cp);
+    return script != Script::Ascii && script != Script::Other;
+}
+
+/**
+ * @brief UTF-8 한 글자 디코딩
+ *
+ * 잘못된 시퀀스는 U+FFFD를 반환하고 최소 1바이트 전진합니다. (예외 없음)
+ *
+ * @param text UTF-8 문자열
+ * @param pos 읽을 위치 (다음 글자 위치로 갱신)
+ */
+inline char32_t DecodeUtf8(std::string_view text, std::size_t& pos) noexcept {
+    const auto byte = [&](std::size_t i) { return static_cast<unsigned char>(text[i]); };
+    const unsigned char lead = byte(pos);
+    if (lead < 0x80) {
+        ++pos;
+        return lead;
+    }
+
+    std::size_t length = 0;
+    char32_t cp = 0;
+    char32_t minimum = 0;
+    if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        cp = lead & 0x1F;
+        minimum = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        cp = lead & 0x0F;
+        minimum = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        cp = lead & 0x07;
+        minimum = 0x10000;
+    } else {
+        ++pos;
+        return kReplacementCharacter;
+    }
+
+    if (pos + length > text.size()) {
+        ++pos;
+        return kReplacementCharacter;
+    }
+    for (std::size_t i = 1; i < length; ++i) {
+        const unsigned char next = byte(pos + i);
+        if ((next & 0xC0) != 0x80) {
+            ++pos;
+            return kReplacementCharacter;
+        }
+        cp = (cp << 6) | (next & 0x3F);
+    }
+    if (cp < minimum || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        ++pos;
+        return kReplacementCharacter;
+    }
+    pos += length;
+    return cp;
+}
+
+/**
+ * @brief 코드포인트를 UTF-8로 덧붙임
+ */
+inline void AppendUtf8(std::string& out, char32_t cp) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+/**
+ * @brief 공백 문자 여부 (ASCII 공백, NBSP, 유니코드 공백, 전각 공백)
+ */
+constexpr bool IsWhitespace(char32_t cp) {
+    switch (cp) {
+        case U' ': case U'\t': case U'\n': case U'\v': case U'\f': case U'\r':
+        case 0x85: case 0xA0: case 0x1680: case 0x2028: case 0x2029:
+        case 0x202F: case 0x205F: case 0x3000:
+            return true;
+        default:
+            return cp >= 0x2000 && cp <= 0x200A;
+    }
+}
+
+/**
+ * @brief pos 바로 앞 글자의 시작 위치 (pos > 0)
+ */
+inline std::size_t PreviousUtf8Start(std::string_view text, std::size_t pos) noexcept {
+    --pos;
+    while (pos > 0 && (static_cast<unsigned char>(text[pos]) & 0xC0) == 0x80) {
+        --pos;
+    }
+    return pos;
+}
+
+/**
+ * @brief 앞뒤 공백(전각 공백 포함) 제거
+ */
+inline std::string_view TrimWhitespace(std::string_view text) noexcept {
+    std::size_t begin = 0;
+    while (begin < text.size()) {
+        std::size_t next = begin;
+        if (!IsWhitespace(DecodeUtf8(text, next))) {
+            break;
+        }
+        begin = next;
+    }
+    std::size_t end = text.size();
+    while (end > begin) {
+        const std::size_t start = PreviousUtf8Start(text, end);
+        std::size_t pos = start;
+        if (!IsWhitespace(DecodeUtf8(text, pos))) {
+            break;
+        }
+        end = start;
+    }
+    return text.substr(begin, end - begin);
+}
+
+/**
+ * @brief 코드포인트 수
+ */
+inline std::size_t CountCodePoints(std::string_view text) noexcept {
+    std::size_t count = 0;
+    for (std::size_t pos = 0; pos < text.size(); ++count) {
+        DecodeUtf8(text, pos);
+    }
+    return count;
+}
+
+/**
+ * @brief 앞에서부터 이어지는 ASCII 바이트 수 (SSE2로 16바이트씩 검사)
+ */
+inline std::size_t AsciiPrefixLength(std::string_view text) noexcept {
+    std::size_t pos = 0;
+#ifdef TORIYOMI_TEXT_HAS_SSE2
+    while (pos + 16 <= text.size()) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + pos));
+        const int mask = _mm_movemask_epi8(chunk);
+        if (mask != 0) {
+            return pos + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+        pos += 16;
+    }
+#endif
+    while (pos < text.size() && static_cast<unsigned char>(text[pos]) < 0x80) {
+        ++pos;
+    }
+    return pos;
+}
+
+/**
+ * @brief 지정한 분류의 글자가 하나라도 있는지
+ */
+inline bool ContainsScript(std::string_view text, Script script) noexcept {
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        if (script != Script::Ascii) {
+            pos += AsciiPrefixLength(text.substr(pos));
+            if (pos >= text.size()) {
+                break;
+            }
+        }
+        if (ClassifyCodePoint(DecodeUtf8(text, pos)) == script) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool ContainsKanji(std::string_view text) noexcept {
+    return ContainsScript(text, Script::Kanji);
+}
+
+/**
+ * @brief UTF-8 문자열의 가타카나를 히라가나로 제자리 변환
+ *
+ * ァ~ヶ, ヽヾ만 변환하고 장음 부호(ー)와 ・ 등은 그대로 둡니다.
+ * 변환 전후 모두 3바이트 UTF-8이므로 길이는 바뀌지 않습니다.
+ */
+inline void KatakanaToHiraganaInPlace(std::string& text) noexcept {
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        pos += AsciiPrefixLength(std::string_view(text).substr(pos));
+        if (pos >= text.size()) {
+            break;
+        }
+
+        // 가타카나는 모두 E3 82 xx / E3 83 xx
+        if (static_cast<unsigned char>(text[pos]) != 0xE3 || pos + 3 > text.size()) {
+            DecodeUtf8(text, pos);
+            continue;
+        }
+        const std::size_t start = pos;
+        const char32_t cp = DecodeUtf8(text, pos);
+        const bool convertible = (cp >= 0x30A1 && cp <= 0x30F6) || cp == 0x30FD || cp == 0x30FE;
+        if (!convertible || pos - start != 3) {
+            continue;
+        }
+        const char32_t hiragana = cp - 0x60;
+        text[start + 1] = static_cast<char>(0x80 | ((hiragana >> 6) & 0x3F));
+        text[start + 2] = static_cast<char>(0x80 | (hiragana & 0x3F));
+    }
+}
+
+inline std::string KatakanaToHiragana(std::string_view text) {
+    std::string result(text);
+    KatakanaToHiraganaInPlace(result);
+    return result;
+}
+
+/**
+ * @brief UTF-8 문자열의 히라가나를 가타카나로 제자리 변환 (KatakanaToHiraganaInPlace의 역)
+ *
+ * ぁ~ゖ, ゝゞ만 변환합니다.
+ */
+inline void HiraganaToKatakanaInPlace(std::string& text) noexcept {
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        pos += AsciiPrefixLength(std::string_view(text).substr(pos));
+        if (pos >= text.size()) {
+            break;
+        }
+
+        // 히라가나는 모두 E3 81 xx / E3 82 xx
+        if (static_cast<unsigned char>(text[pos]) != 0xE3 || pos + 3 > text.size()) {
+            DecodeUtf8(text, pos);
+            continue;
+        }
+        const std::size_t start = pos;
+        const char32_t cp = DecodeUtf8(text, pos);
+        const bool convertible = (cp >= 0x3041 && cp <= 0x3096) || cp == 0x309D || cp == 0x309E;
+        if (!convertible || pos - start != 3) {
+            continue;
+        }
+        const char32_t katakana = cp + 0x60;
+        text[start + 1] = static_cast<char>(0x80 | ((katakana >> 6) & 0x3F));
+        text[start + 2] = static_cast<char>(0x80 | (katakana & 0x3F));
+    }
+}
+
+inline std::string HiraganaToKatakana(std::string_view text) {
+    std::string result(text);
+    HiraganaToKatakanaInPlace(result);
+    return result;
+}
+
+}  // namespace toriyomi::text
@@ -0,0 +1,104 @@
+// ToriYomi - 적응형 캡처 간격 조절 구현
+
+#include "core/capture/capture_pacer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace toriyomi::capture {
+
+CapturePacer::CapturePacer(CapturePacerOptions options)
+    : options_(options)
+    , interval_(options.baseInterval) {
+    options_.baseInterval = std::max(std::chrono::milliseconds(1), options_.baseInterval);
+    options_.backoffFactor = std::max(1.0, options_.backoffFactor);
+    options_.ocrSmoothing = std::clamp(options_.ocrSmoothing, 0.01, 1.0);
+    interval_ = options_.baseInterval;
+    stats_.intervalMs = static_cast<double>(interval_.count());
+}
+
+void CapturePacer::Reset(Clock::time_point now) {
+    deadline_ = now;
+    interval_ = options_.baseInterval;
+    ocrEstimateMs_ = 0.0;
+    stats_ = CapturePacingStats{};
+    stats_.intervalMs = static_cast<double>(interval_.count());
+}
+
+void CapturePacer::OnFrame(bool changed, Clock::time_point capturedAt) {
+    if (changed) {
+        ++stats_.activeFrames;
+        Schedule(ActiveInterval(), PacingDecision::Active, capturedAt);
+        return;
+    }
+
+    ++stats_.staticFrames;
+    const auto grown = std::chrono::milliseconds(static_cast<long long>(
+        std::ceil(static_cast<double>(interval_.count()) * options_.backoffFactor)));
+    const auto next = std::clamp(grown, ActiveInterval(), MaxInterval());
+    Schedule(next, next >= MaxInterval() ? PacingDecision::Idle : PacingDecision::Backoff, capturedAt);
+}
+
+void CapturePacer::OnCaptureFailed(bool screenUnchanged, Clock::time_point now) {
+    if (screenUnchanged) {
+        OnFrame(false, now);
+        return;
+    }
+
+    // 재시도는 간격 상태를 바꾸지 않고 마감만 당김
+    ++stats_.retries;
+    stats_.lastDecision = PacingDecision::Retry;
+    deadline_ = now + options_.retryDelay;
+}
+
+void CapturePacer::OnConsumerBusy(Clock::time_point now) {
+    ++stats_.consumerBusy;
+    stats_.lastDecision = PacingDecision::ConsumerBusy;
+    const auto wait = std::max(interval_, options_.retryDelay);
+    deadline_ = now + wait;
+}
+
+void CapturePacer::OnOcrCompleted(std::chrono::duration<double, std::milli> elapsed) {
+    const double ms = std::max(0.0, elapsed.count());
+    if (ocrEstimateMs_ <= 0.0) {
+        ocrEstimateMs_ = ms;
+    } else {
+        ocrEstimateMs_ += options_.ocrSmoothing * (ms - ocrEstimateMs_);
+    }
+    stats_.ocrEstimateMs = ocrEstimateMs_;
+}
+
+void CapturePacer::SetBaseInterval(std::chrono::milliseconds interval) {
+    options_.baseInterval = std::max(std::chrono::milliseconds(1), interval);
+    interval_ = std::clamp(interval_, ActiveInterval(), MaxInterval());
+}
+
+std::chrono::milliseconds CapturePacer::ActiveInterval() const {
+    return std::clamp(options_.activeInterval, std::chrono::milliseconds(1), options_.baseInterval);
+}
+
+std::chrono::milliseconds CapturePacer::MaxInterval() const {
+    return std::max(options_.maxInterval, options_.baseInterval);
+}
+
+void CapturePacer::Schedule(std::chrono::milliseconds interval, PacingDecision decision, Clock::time_point now) {
+    // OCR이 한 프레임을 처리하는 동안 여러 장을 찍어 봐야 버려질 뿐이므로 간격 하한으로 사용
+    const auto ocrFloor = std::chrono::milliseconds(static_cast<long long>(std::ceil(ocrEstimateMs_)));
+    if (interval < ocrFloor) {
+        interval = ocrFloor;
+        decision = PacingDecision::OcrLimited;
+        ++stats_.ocrLimited;
+    }
+
+    interval_ = interval;
+    stats_.intervalMs = static_cast<double>(interval.count());
+    stats_.lastDecision = decision;
+
+    // 직전 마감 기준으로 더해 오차 누적을 막고, 이미 지났으면 몰아서 찍지 않도록 현재 시각으로 당김
+    deadline_ += interval;
+    if (deadline_ < now) {
+        deadline_ = now;
+        ++stats_.lateDeadlines;
+    }
+}
+
+} // namespace toriyomi::capture
@@ -0,0 +1,119 @@
+// ToriYomi - 적응형 캡처 간격 조절
+// 화면 변화와 OCR 처리 속도에 맞춰 다음 캡처 시각(마감)을 정함
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace toriyomi::capture {
+
+/**
+ * @brief 다음 캡처 간격을 정한 이유
+ */
+enum class PacingDecision {
+    Initial,        // 첫 캡처 (즉시)
+    Active,         // 화면이 바뀌는 중 → 짧은 간격
+    Backoff,        // 화면이 그대로 → 간격을 지수적으로 늘리는 중
+    Idle,           // 오래 그대로 → 최대 간격
+    OcrLimited,     // OCR 처리 시간보다 빨리 찍지 않도록 늘림
+    ConsumerBusy,   // 앞 프레임을 아직 가져가지 않아 캡처를 건너뜀
+    Retry           // 캡처 실패 → 잠시 뒤 재시도
+};
+
+/**
+ * @brief 캡처 간격 조절 설정
+ */
+struct CapturePacerOptions {
+    std::chrono::milliseconds baseInterval{1000};   // 사용자 설정 간격 (시작/재시도 뒤 기준)
+    std::chrono::milliseconds activeInterval{250};  // 화면이 바뀌는 동안 (baseInterval보다 길면 baseInterval)
+    std::chrono::milliseconds maxInterval{3000};    // 정지 화면 백오프 상한 (baseInterval보다 짧으면 baseInterval)
+    double backoffFactor = 2.0;                     // 정지 프레임마다 간격에 곱함
+    std::chrono::milliseconds retryDelay{10};       // 캡처 실패 후 재시도 간격
+    double ocrSmoothing = 0.3;                      // OCR 처리 시간 지수 이동 평균 가중치
+};
+
+/**
+ * @brief 간격 조절 결정 통계
+ */
+struct CapturePacingStats {
+    double intervalMs = 0.0;            // 마지막으로 정한 캡처 간격
+    double ocrEstimateMs = 0.0;         // OCR 처리 시간 추정 (간격 하한)
+    PacingDecision lastDecision = PacingDecision::Initial;
+    std::uint64_t activeFrames = 0;     // 바뀐 화면으로 판단한 프레임
+    std::uint64_t staticFrames = 0;     // 그대로인 화면으로 판단한 프레임
+    std::uint64_t ocrLimited = 0;       // OCR 속도 때문에 간격을 늘린 횟수
+    std::uint64_t consumerBusy = 0;     // 소비자가 밀려 캡처를 건너뛴 횟수
+    std::uint64_t retries = 0;          // 실패 후 재시도 예약 횟수
+    std::uint64_t lateDeadlines = 0;    // 마감을 이미 넘겨 바로 캡처한 횟수
+};
+
+/**
+ * @brief 마감 기준 캡처 간격 조절기
+ *
+ * 다음 캡처 시각은 직전 마감에 간격을 더해 정하므로 캡처/대기 오차가 누적되지 않고,
+ * 이미 지난 마감은 현재 시각으로 당겨 밀린 캡처를 몰아서 하지 않습니다.
+ * 화면이 바뀌면 activeInterval로 당기고, 그대로면 backoffFactor배씩 maxInterval까지 늘립니다.
+ * 어떤 경우에도 OCR 처리 시간 추정보다 짧게 찍지 않습니다.
+ *
+ * 시각은 호출하는 쪽이 넘겨 주므로 테스트에서 가짜 시계를 쓸 수 있습니다.
+ * 스레드 안전하지 않습니다 (여러 스레드에서 쓰면 호출하는 쪽에서 잠금).
+ */
+class CapturePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit CapturePacer(CapturePacerOptions options = {});
+
+    /**
+     * @brief 상태 초기화 후 첫 캡처를 now로 예약
+     */
+    void Reset(Clock::time_point now);
+
+    /**
+     * @brief 다음 캡처 시각
+     */
+    Clock::time_point NextDeadline() const { return deadline_; }
+
+    /**
+     * @brief 캡처한 프레임 반영
+     *
+     * @param changed 직전 프레임과 내용이 다른지
+     * @param capturedAt 캡처를 마친 시각
+     */
+    void OnFrame(bool changed, Clock::time_point capturedAt);
+
+    /**
+     * @brief 캡처 실패 반영
+     *
+     * @param screenUnchanged 실패 이유가 화면 변화 없음(DXGI 시간 초과)이면 정지 프레임처럼 백오프
+     */
+    void OnCaptureFailed(bool screenUnchanged, Clock::time_point now);
+
+    /**
+     * @brief 소비자(OCR)가 앞 프레임을 아직 가져가지 않아 이번 캡처를 건너뜀 (간격은 그대로)
+     */
+    void OnConsumerBusy(Clock::time_point now);
+
+    /**
+     * @brief OCR 한 번에 걸린 시간 반영 (캡처 간격 하한)
+     */
+    void OnOcrCompleted(std::chrono::duration<double, std::milli> elapsed);
+
+    void SetBaseInterval(std::chrono::milliseconds interval);
+
+    CapturePacingStats GetStats() const { return stats_; }
+
+private:
+    std::chrono::milliseconds ActiveInterval() const;
+    std::chrono::milliseconds MaxInterval() const;
+    void Schedule(std::chrono::milliseconds interval, PacingDecision decision, Clock::time_point now);
+
+    CapturePacerOptions options_;
+    Clock::time_point deadline_{};
+    std::chrono::milliseconds interval_;
+    double ocrEstimateMs_ = 0.0;
+    CapturePacingStats stats_;
+};
+
+} // namespace toriyomi::capture
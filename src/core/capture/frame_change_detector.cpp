@@ -0,0 +1,108 @@
+// ToriYomi - 잡음에 둔감한 ROI 변화 감지 구현
+
+#include "core/capture/frame_change_detector.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace toriyomi::capture {
+
+FrameChangeDetector::FrameChangeDetector(FrameChangeOptions options)
+    : options_(options) {
+}
+
+void FrameChangeDetector::SetOptions(const FrameChangeOptions& options) {
+    options_ = options;
+    // 격자 크기가 달라질 수 있으므로 다음 프레임부터 새로 비교
+    Reset();
+}
+
+bool FrameChangeDetector::Update(const cv::Mat& image) {
+    cv::Size gridSize;
+    if (!BuildThumbnail(image, current_, gridSize)) {
+        hasPrevious_ = false;
+        lastDifference_ = 0.0;
+        return true;
+    }
+
+    const bool comparable = hasPrevious_ &&
+        image.cols == previousImageSize_.width && image.rows == previousImageSize_.height &&
+        gridSize == previousGridSize_;
+    bool changed = true;
+    lastDifference_ = 0.0;
+    if (comparable) {
+        double total = 0.0;
+        for (std::size_t i = 0; i < current_.size(); ++i) {
+            const double diff = std::abs(static_cast<double>(current_[i]) - previous_[i]);
+            if (diff > options_.noiseFloor) {
+                total += diff - options_.noiseFloor;
+            }
+        }
+        lastDifference_ = total / static_cast<double>(current_.size());
+        changed = lastDifference_ > options_.threshold;
+    }
+
+    // 천천히 바뀌는 화면(페이드 등)도 누적되면 잡히도록 바뀐 것으로 본 프레임만 기준으로 삼음
+    if (changed) {
+        previous_.swap(current_);
+        previousImageSize_ = cv::Size(image.cols, image.rows);
+        previousGridSize_ = gridSize;
+        hasPrevious_ = true;
+    }
+    return changed;
+}
+
+void FrameChangeDetector::Reset() {
+    previous_.clear();
+    current_.clear();
+    previousImageSize_ = cv::Size();
+    previousGridSize_ = cv::Size();
+    hasPrevious_ = false;
+    lastDifference_ = 0.0;
+}
+
+bool FrameChangeDetector::BuildThumbnail(const cv::Mat& image,
+                                         std::vector<float>& cells,
+                                         cv::Size& gridSize) const {
+    const int channels = image.channels();
+    if (image.empty() || image.depth() != CV_8U || (channels != 1 && channels != 3 && channels != 4)) {
+        return false;
+    }
+
+    const int gridCols = std::clamp(options_.gridWidth, 1, image.cols);
+    const int gridRows = std::clamp(
+        static_cast<int>(std::lround(static_cast<double>(image.rows) * gridCols / image.cols)), 1, image.rows);
+    gridSize = cv::Size(gridCols, gridRows);
+
+    // 열 → 칸 대응표 (행마다 다시 나누지 않음)
+    std::vector<int> cellOfColumn(static_cast<std::size_t>(image.cols));
+    for (int x = 0; x < image.cols; ++x) {
+        cellOfColumn[static_cast<std::size_t>(x)] = static_cast<int>(static_cast<long long>(x) * gridCols / image.cols);
+    }
+
+    const std::size_t cellCount = static_cast<std::size_t>(gridCols) * static_cast<std::size_t>(gridRows);
+    std::vector<std::uint64_t> sums(cellCount, 0);
+    std::vector<std::uint32_t> counts(cellCount, 0);
+    for (int y = 0; y < image.rows; ++y) {
+        const unsigned char* row = image.ptr<unsigned char>(y);
+        const std::size_t base = static_cast<std::size_t>(static_cast<long long>(y) * gridRows / image.rows) * gridCols;
+        for (int x = 0; x < image.cols; ++x) {
+            const unsigned char* pixel = row + static_cast<std::size_t>(x) * channels;
+            // BGR 순서, BT.601 가중치를 정수로 근사
+            const unsigned int luma = channels == 1
+                ? pixel[0]
+                : (pixel[0] * 29u + pixel[1] * 150u + pixel[2] * 77u) >> 8;
+            const std::size_t cell = base + static_cast<std::size_t>(cellOfColumn[static_cast<std::size_t>(x)]);
+            sums[cell] += luma;
+            ++counts[cell];
+        }
+    }
+
+    cells.resize(cellCount);
+    for (std::size_t i = 0; i < cellCount; ++i) {
+        cells[i] = counts[i] == 0 ? 0.0f : static_cast<float>(sums[i]) / static_cast<float>(counts[i]);
+    }
+    return true;
+}
+
+} // namespace toriyomi::capture
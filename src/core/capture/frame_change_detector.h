@@ -0,0 +1,68 @@
+// ToriYomi - 잡음에 둔감한 ROI 변화 감지
+// ROI를 흑백 격자로 줄여 직전 프레임과의 평균 밝기 차이로 화면이 바뀌었는지 판단
+
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace toriyomi::capture {
+
+/**
+ * @brief 변화 감지 설정
+ */
+struct FrameChangeOptions {
+    int gridWidth = 64;             // 축소 격자 가로 칸 수 (세로는 ROI 비율대로, 원본보다 크게 늘리지 않음)
+    double noiseFloor = 3.0;        // 칸 밝기 차이가 이 이하면 잡음으로 보고 0으로 셈 (0~255)
+    double threshold = 0.1;         // 칸별 차이의 평균이 이보다 크면 변화 (0~255)
+};
+
+/**
+ * @brief 직전 프레임과 비교하는 ROI 변화 감지기
+ *
+ * 정확한 해시는 압축 잡음, 디더링, 미세한 밝기 흔들림에도 매번 "바뀜"이 되어
+ * 화면이 안정되지 않고 캡처 간격도 줄지 않습니다. 대신 ROI를 흑백으로 바꿔 격자 칸마다
+ * 영역 평균을 내고, 칸별 밝기 차이의 평균(잡음 바닥 이하는 0)을 임계값과 비교합니다.
+ * 글자 하나가 새로 나타나면 그 글자가 덮는 칸의 차이만으로 임계값을 넘습니다.
+ *
+ * 8비트 1/3/4채널(BGR/BGRA) 프레임을 받으며, 그 밖의 형식은 항상 바뀐 것으로 봅니다.
+ * 스레드 안전하지 않습니다 (캡처 스레드에서 순서대로 호출).
+ */
+class FrameChangeDetector {
+public:
+    explicit FrameChangeDetector(FrameChangeOptions options = {});
+
+    void SetOptions(const FrameChangeOptions& options);
+    const FrameChangeOptions& GetOptions() const { return options_; }
+
+    /**
+     * @brief 새 프레임 반영
+     *
+     * @param image ROI (원본을 공유하는 부분 행렬도 됨, 읽기만 함)
+     * @return 직전 프레임과 다르면 true (첫 프레임, 크기가 바뀐 프레임도 true)
+     */
+    bool Update(const cv::Mat& image);
+
+    /**
+     * @brief 마지막 Update의 칸별 평균 차이 (첫 프레임/크기 변경 시 0)
+     */
+    double GetLastDifference() const { return lastDifference_; }
+
+    /**
+     * @brief 직전 프레임을 잊음 (다음 Update는 바뀐 것으로 봄)
+     */
+    void Reset();
+
+private:
+    bool BuildThumbnail(const cv::Mat& image, std::vector<float>& cells, cv::Size& gridSize) const;
+
+    FrameChangeOptions options_;
+    std::vector<float> previous_;
+    std::vector<float> current_;
+    cv::Size previousImageSize_;
+    cv::Size previousGridSize_;
+    bool hasPrevious_ = false;
+    double lastDifference_ = 0.0;
+};
+
+} // namespace toriyomi::capture
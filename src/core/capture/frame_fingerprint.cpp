@@ -0,0 +1,27 @@
+// ToriYomi - 프레임 내용 지문 구현
+
+#include "core/capture/frame_fingerprint.h"
+#include <cstring>
+
+namespace toriyomi::capture {
+
+std::uint64_t FrameFingerprint(const cv::Mat& image) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    const std::size_t rowBytes = static_cast<std::size_t>(image.cols) * image.elemSize();
+    for (int y = 0; y < image.rows; ++y) {
+        const unsigned char* row = image.ptr<unsigned char>(y);
+        std::size_t offset = 0;
+        for (; offset + sizeof(std::uint64_t) <= rowBytes; offset += sizeof(std::uint64_t)) {
+            std::uint64_t word = 0;
+            std::memcpy(&word, row + offset, sizeof(word));
+            hash = (hash ^ word) * 0x100000001b3ULL;
+            hash ^= hash >> 29;
+        }
+        for (; offset < rowBytes; ++offset) {
+            hash = (hash ^ row[offset]) * 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+} // namespace toriyomi::capture
@@ -0,0 +1,19 @@
+// ToriYomi - 프레임 내용 지문
+// 화면이 그대로인지 빠르게 판단하기 위한 64비트 해시 (캡처 간격 조절, 미리보기 갱신에 사용)
+
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <cstdint>
+
+namespace toriyomi::capture {
+
+/**
+ * @brief 프레임 전체 픽셀의 지문 (8바이트 단위로 섞음, 1080p BGRA 기준 1~2ms)
+ *
+ * ROI처럼 원본을 공유하는 부분 행렬도 행 단위로 읽으므로 복사 없이 넘겨도 됩니다.
+ * 빈 프레임은 항상 같은 값입니다.
+ */
+std::uint64_t FrameFingerprint(const cv::Mat& image);
+
+} // namespace toriyomi::capture
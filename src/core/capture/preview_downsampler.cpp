@@ -0,0 +1,69 @@
+// ToriYomi - 미리보기 프레임 축소 구현
+
+#include "core/capture/preview_downsampler.h"
+#include "core/capture/frame_fingerprint.h"
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+
+namespace toriyomi::capture {
+
+PreviewDownsampler::PreviewDownsampler(cv::Size maxSize)
+    : maxSize_(std::max(1, maxSize.width), std::max(1, maxSize.height)) {
+}
+
+cv::Size PreviewDownsampler::FitWithin(cv::Size source, cv::Size maxSize) {
+    if (source.width <= 0 || source.height <= 0) {
+        return cv::Size();
+    }
+    if (source.width <= maxSize.width && source.height <= maxSize.height) {
+        return source;
+    }
+    const double scale = std::min(static_cast<double>(maxSize.width) / source.width,
+                                  static_cast<double>(maxSize.height) / source.height);
+    return cv::Size(std::max(1, static_cast<int>(source.width * scale)),
+                    std::max(1, static_cast<int>(source.height * scale)));
+}
+
+std::optional<PreviewFrame> PreviewDownsampler::Update(const cv::Mat& frame, std::uint64_t sequence) {
+    if (frame.empty()) {
+        return std::nullopt;
+    }
+    // 캡처 스레드가 새 프레임을 올리지 않았으면 축소도 생략
+    if (sequence != 0 && sequence == lastSequence_) {
+        return std::nullopt;
+    }
+    lastSequence_ = sequence;
+
+    const cv::Size target = FitWithin(frame.size(), maxSize_);
+    cv::Mat image;
+    if (target == frame.size()) {
+        image = frame;
+    } else {
+        cv::resize(frame, image, target, 0.0, 0.0, cv::INTER_AREA);
+    }
+
+    const std::uint64_t fingerprint = FrameFingerprint(image);
+    if (version_ != 0 && fingerprint == lastFingerprint_ &&
+        image.size() == lastSize_ && image.type() == lastType_) {
+        return std::nullopt;
+    }
+    lastFingerprint_ = fingerprint;
+    lastSize_ = image.size();
+    lastType_ = image.type();
+
+    PreviewFrame preview;
+    preview.version = ++version_;
+    preview.image = std::move(image);
+    preview.sourceSize = frame.size();
+    return preview;
+}
+
+void PreviewDownsampler::Reset() {
+    lastSequence_ = 0;
+    lastFingerprint_ = 0;
+    lastSize_ = cv::Size();
+    lastType_ = -1;
+    // version_은 유지해 이전 미리보기 URL과 겹치지 않게 함
+}
+
+} // namespace toriyomi::capture
@@ -0,0 +1,62 @@
+// ToriYomi - ROI 선택 미리보기용 프레임 축소
+// 캡처 파이프라인의 최신 프레임을 영역 평균으로 줄이고, 바뀐 경우에만 새 미리보기를 만듦
+
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <cstdint>
+#include <optional>
+
+namespace toriyomi::capture {
+
+/**
+ * @brief 축소된 미리보기 프레임
+ */
+struct PreviewFrame {
+    std::uint64_t version = 0;      // 내용이 바뀔 때마다 1씩 증가
+    cv::Mat image;                  // 원본과 같은 채널 구성 (축소가 필요 없으면 원본 버퍼 공유)
+    cv::Size sourceSize;            // 축소 전 크기 (ROI 좌표 변환용)
+};
+
+/**
+ * @brief 미리보기 프레임 축소기
+ *
+ * 캡처 스레드가 이미 가져온 프레임을 그대로 받아 INTER_AREA로 줄입니다.
+ * 같은 캡처 번호거나 축소 결과가 직전과 같으면 아무것도 만들지 않아
+ * UI가 같은 그림을 다시 올리지 않게 합니다.
+ */
+class PreviewDownsampler {
+public:
+    explicit PreviewDownsampler(cv::Size maxSize = cv::Size(960, 540));
+
+    /**
+     * @brief 새 프레임 반영
+     *
+     * @param frame 캡처 프레임 (읽기만 함)
+     * @param sequence 캡처 번호 (0이면 번호 비교 없이 내용으로만 판단)
+     * @return 미리보기가 바뀌었으면 새 프레임, 그대로면 std::nullopt
+     */
+    std::optional<PreviewFrame> Update(const cv::Mat& frame, std::uint64_t sequence = 0);
+
+    /**
+     * @brief 직전 상태 초기화 (대상 창이 바뀌었을 때)
+     */
+    void Reset();
+
+    std::uint64_t Version() const { return version_; }
+
+    /**
+     * @brief 비율을 유지하며 maxSize 안에 들어가는 크기 (원본이 더 작으면 원본 크기)
+     */
+    static cv::Size FitWithin(cv::Size source, cv::Size maxSize);
+
+private:
+    cv::Size maxSize_;
+    std::uint64_t version_ = 0;
+    std::uint64_t lastSequence_ = 0;
+    std::uint64_t lastFingerprint_ = 0;
+    cv::Size lastSize_;
+    int lastType_ = -1;
+};
+
+} // namespace toriyomi::capture
@@ -0,0 +1,62 @@
+// ToriYomi - 창 캡처 세션
+// DXGI/GDI 선택과 상호 폴백, 클라이언트 영역 자르기, 가림 감지를 한 프레임 단위로 제공
+
+#pragma once
+
+#include "core/pipeline/frame_source.h"
+#include <opencv2/core.hpp>
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#ifdef min
+#undef min
+#endif
+#ifdef max
+#undef max
+#endif
+#include <memory>
+
+namespace toriyomi::capture {
+
+/**
+ * @brief 한 창에 대한 캡처 세션
+ *
+ * 일반 윈도우는 PrintWindow 기반 GDI 캡처를 우선 시도하고, 실패 시 DXGI로 폴백합니다.
+ * 전체 화면(Desktop) 캡처는 DXGI를 기본으로 사용합니다.
+ * 연속 실패가 쌓이면 다른 방식으로 전환합니다.
+ *
+ * pipeline::Pipeline의 캡처 단계에서 사용합니다.
+ * 한 스레드에서만 CaptureFrame을 호출해야 합니다.
+ */
+class WindowCapture : public pipeline::FrameSource {
+public:
+    explicit WindowCapture(HWND targetWindow);
+    ~WindowCapture() override;
+
+    WindowCapture(const WindowCapture&) = delete;
+    WindowCapture& operator=(const WindowCapture&) = delete;
+
+    bool Start() override;
+    void Stop() override;
+
+    /**
+     * @brief 한 프레임 캡처 (DXGI면 클라이언트 영역으로 자름, 거의 검은 프레임은 실패로 처리)
+     */
+    cv::Mat CaptureFrame() override;
+
+    bool IsOccluded() const override;
+
+    /**
+     * @brief 마지막 실패가 DXGI 시간 초과(화면 변화 없음)였는지
+     */
+    bool LastCaptureUnchanged() const override;
+
+    bool IsUsingDxgi() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+} // namespace toriyomi::capture
@@ -0,0 +1,290 @@
+// ToriYomi - 컴파일된 사전 구현
+
+#include "compiled_dictionary.h"
+#include "dictionary_format.h"
+#include "double_array_trie.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace toriyomi {
+namespace dictionary {
+
+namespace {
+
+// 접두사 검색 한 번에 보는 최대 길이 수 (표제어 길이 상한과 같은 의미)
+constexpr std::size_t kMaxPrefixMatches = 64;
+
+/**
+ * @brief 읽기 전용 파일 매핑
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Map(const std::filesystem::path& path) {
+        Unmap();
+#ifdef _WIN32
+        file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file_, &fileSize) || fileSize.QuadPart <= 0) {
+            Unmap();
+            return false;
+        }
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) {
+            Unmap();
+            return false;
+        }
+        data_ = static_cast<const std::byte*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (!data_) {
+            Unmap();
+            return false;
+        }
+        size_ = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* mapped = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+        data_ = static_cast<const std::byte*>(mapped);
+        size_ = static_cast<std::size_t>(st.st_size);
+#endif
+        return true;
+    }
+
+    void Unmap() {
+#ifdef _WIN32
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if (data_) {
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const std::byte* Data() const { return data_; }
+    std::size_t Size() const { return size_; }
+
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+};
+
+}  // namespace
+
+class CompiledDictionary::Impl {
+public:
+    bool Open(const std::filesystem::path& path) {
+        Close();
+        if (!file.Map(path)) {
+            SPDLOG_WARN("사전 파일을 매핑할 수 없습니다: {}", path.string());
+            return false;
+        }
+        if (!Validate()) {
+            SPDLOG_WARN("사전 파일 형식이 올바르지 않습니다: {}", path.string());
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close() {
+        file.Unmap();
+        trie = {};
+        keys = {};
+        postings = {};
+        entries = {};
+        senses = {};
+        strings = {};
+    }
+
+    std::string_view String(const StringRef& ref) const {
+        if (static_cast<std::uint64_t>(ref.offset) + ref.length > strings.size()) {
+            return {};
+        }
+        return strings.substr(ref.offset, ref.length);
+    }
+
+    std::span<const std::uint32_t> Postings(std::uint32_t keyId) const {
+        if (keyId >= keys.size()) {
+            return {};
+        }
+        const KeyRecord& key = keys[keyId];
+        if (static_cast<std::uint64_t>(key.firstPosting) + key.postingCount > postings.size()) {
+            return {};
+        }
+        return postings.subspan(key.firstPosting, key.postingCount);
+    }
+
+    MappedFile file;
+    DoubleArrayTrieView trie;
+    std::span<const KeyRecord> keys;
+    std::span<const std::uint32_t> postings;
+    std::span<const EntryRecord> entries;
+    std::span<const SenseRecord> senses;
+    std::string_view strings;
+
+private:
+    template <typename T>
+    bool MapSection(const DictionarySection& section, std::span<const T>& out) const {
+        if (section.offset % alignof(T) != 0 || section.offset > file.Size() ||
+            section.count > (file.Size() - section.offset) / sizeof(T)) {
+            return false;
+        }
+        out = {reinterpret_cast<const T*>(file.Data() + section.offset), static_cast<std::size_t>(section.count)};
+        return true;
+    }
+
+    bool Validate() {
+        if (file.Size() < sizeof(DictionaryFileHeader)) {
+            return false;
+        }
+        DictionaryFileHeader header;
+        std::memcpy(&header, file.Data(), sizeof(header));
+        if (std::memcmp(header.magic, kDictionaryMagic, sizeof(header.magic)) != 0 ||
+            header.version != kDictionaryFormatVersion || header.headerSize != sizeof(DictionaryFileHeader)) {
+            return false;
+        }
+
+        std::span<const DoubleArrayUnit> units;
+        std::span<const char> chars;
+        if (!MapSection(header.trie, units) || !MapSection(header.keys, keys) ||
+            !MapSection(header.postings, postings) || !MapSection(header.entries, entries) ||
+            !MapSection(header.senses, senses) || !MapSection(header.strings, chars) || units.empty()) {
+            return false;
+        }
+        trie = DoubleArrayTrieView(units.data(), units.size());
+        strings = std::string_view(chars.data(), chars.size());
+        return true;
+    }
+};
+
+CompiledDictionary::CompiledDictionary()
+    : pImpl_(std::make_unique<Impl>()) {
+}
+
+CompiledDictionary::~CompiledDictionary() = default;
+
+bool CompiledDictionary::Open(const std::filesystem::path& path) {
+    return pImpl_->Open(path);
+}
+
+void CompiledDictionary::Close() {
+    pImpl_->Close();
+}
+
+bool CompiledDictionary::IsOpen() const {
+    return pImpl_->file.Data() != nullptr;
+}
+
+std::span<const std::uint32_t> CompiledDictionary::Lookup(std::string_view key) const {
+    std::uint32_t keyId = 0;
+    if (!pImpl_->trie.ExactMatch(key, keyId)) {
+        return {};
+    }
+    return pImpl_->Postings(keyId);
+}
+
+std::size_t CompiledDictionary::LookupPrefixes(std::string_view text,
+                                               DictionaryPrefixMatch* results,
+                                               std::size_t maxResults) const {
+    std::array<TriePrefixMatch, kMaxPrefixMatches> matches;
+    const std::size_t found =
+        pImpl_->trie.CommonPrefixSearch(text, matches.data(), std::min(maxResults, matches.size()));
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < found; ++i) {
+        const auto entries = pImpl_->Postings(matches[i].value);
+        if (!entries.empty()) {
+            results[count++] = {matches[i].length, entries};
+        }
+    }
+    return count;
+}
+
+DictionaryEntryView CompiledDictionary::Entry(std::uint32_t id) const {
+    if (id >= pImpl_->entries.size()) {
+        return {};
+    }
+    const EntryRecord& record = pImpl_->entries[id];
+    DictionaryEntryView view;
+    view.id = id;
+    view.sequence = record.sequence;
+    view.common = (record.flags & kEntryCommon) != 0;
+    view.headword = pImpl_->String(record.headword);
+    view.reading = pImpl_->String(record.reading);
+    view.senseCount = record.senseCount;
+    return view;
+}
+
+DictionarySenseView CompiledDictionary::Sense(std::uint32_t entryId, std::uint32_t index) const {
+    if (entryId >= pImpl_->entries.size()) {
+        return {};
+    }
+    const EntryRecord& record = pImpl_->entries[entryId];
+    const std::uint64_t senseIndex = static_cast<std::uint64_t>(record.firstSense) + index;
+    if (index >= record.senseCount || senseIndex >= pImpl_->senses.size()) {
+        return {};
+    }
+    const SenseRecord& sense = pImpl_->senses[static_cast<std::size_t>(senseIndex)];
+    return {pImpl_->String(sense.partOfSpeech), pImpl_->String(sense.glosses)};
+}
+
+std::size_t CompiledDictionary::EntryCount() const {
+    return pImpl_->entries.size();
+}
+
+std::size_t CompiledDictionary::KeyCount() const {
+    return pImpl_->keys.size();
+}
+
+}  // namespace dictionary
+}  // namespace toriyomi
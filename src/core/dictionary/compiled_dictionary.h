@@ -0,0 +1,105 @@
+// ToriYomi - 컴파일된 사전 (메모리 매핑)
+// DictionaryBuilder가 만든 파일을 매핑해서 토큰마다 할당 없이 조회
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace toriyomi {
+namespace dictionary {
+
+/**
+ * @brief 엔트리 요약 (매핑된 파일을 가리키므로 사전이 열려 있는 동안만 유효)
+ */
+struct DictionaryEntryView {
+    std::uint32_t id = 0;
+    std::uint32_t sequence = 0;    // JMdict ent_seq
+    bool common = false;
+    std::string_view headword;
+    std::string_view reading;
+    std::uint32_t senseCount = 0;
+};
+
+/**
+ * @brief 뜻 하나 (사전이 열려 있는 동안만 유효)
+ */
+struct DictionarySenseView {
+    std::string_view partOfSpeech;   // 쉼표 구분 태그 (예: "v1,vt")
+    std::string_view glosses;        // "; " 구분 뜻풀이
+};
+
+/**
+ * @brief 접두사 검색 결과 하나
+ */
+struct DictionaryPrefixMatch {
+    std::uint32_t length = 0;                // 일치한 접두사 길이 (바이트)
+    std::span<const std::uint32_t> entries;  // 엔트리 ID 목록
+};
+
+/**
+ * @brief 메모리 매핑된 사전
+ *
+ * 파일 전체를 읽기 전용으로 매핑하므로 열기는 헤더 검증만 하고 바로 끝나며,
+ * 페이지는 조회할 때 OS가 필요한 만큼만 읽어 들입니다.
+ * 조회 함수는 할당하지 않고 매핑된 메모리를 가리키는 뷰를 반환합니다.
+ *
+ * 열기/닫기와 조회를 동시에 호출하면 안 되며, 열린 뒤의 조회는 스레드 안전합니다.
+ */
+class CompiledDictionary {
+public:
+    CompiledDictionary();
+    ~CompiledDictionary();
+
+    CompiledDictionary(const CompiledDictionary&) = delete;
+    CompiledDictionary& operator=(const CompiledDictionary&) = delete;
+
+    /**
+     * @brief 사전 파일 열기 (이미 열려 있으면 닫고 다시 엶)
+     *
+     * @return 매핑 및 헤더/섹션 검증 성공 여부
+     */
+    bool Open(const std::filesystem::path& path);
+
+    void Close();
+
+    bool IsOpen() const;
+
+    /**
+     * @brief 표제어 또는 읽기가 key와 정확히 같은 엔트리 ID 목록
+     */
+    std::span<const std::uint32_t> Lookup(std::string_view key) const;
+
+    /**
+     * @brief text의 접두사 중 사전에 있는 것을 짧은 순으로 최대 maxResults개 기록
+     *
+     * @return 기록한 개수
+     */
+    std::size_t LookupPrefixes(std::string_view text,
+                               DictionaryPrefixMatch* results,
+                               std::size_t maxResults) const;
+
+    /**
+     * @brief 엔트리 조회 (범위 밖이면 빈 뷰)
+     */
+    DictionaryEntryView Entry(std::uint32_t id) const;
+
+    /**
+     * @brief 엔트리의 index번째 뜻 (범위 밖이면 빈 뷰)
+     */
+    DictionarySenseView Sense(std::uint32_t entryId, std::uint32_t index) const;
+
+    std::size_t EntryCount() const;
+    std::size_t KeyCount() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+}  // namespace dictionary
+}  // namespace toriyomi
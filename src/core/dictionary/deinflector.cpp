@@ -0,0 +1,435 @@
+// ToriYomi - 활용형 역변환 구현
+
+#include "deinflector.h"
+#include "compiled_dictionary.h"
+#include "common/text/unicode_utils.h"
+#include <algorithm>
+#include <array>
+#include <map>
+
+namespace toriyomi {
+namespace dictionary {
+
+namespace {
+
+// 규칙 연쇄 최대 길이와 후보 수 상한 (실제 활용은 4~5단계를 넘지 않음)
+constexpr std::size_t kMaxChainLength = 8;
+constexpr std::size_t kMaxCandidates = 256;
+
+constexpr std::uint32_t V1 = kConditionV1;
+constexpr std::uint32_t V5 = kConditionV5;
+constexpr std::uint32_t Vk = kConditionVk;
+constexpr std::uint32_t Vs = kConditionVs;
+constexpr std::uint32_t AdjI = kConditionAdjI;
+constexpr std::uint32_t Masu = kConditionMasu;
+constexpr std::uint32_t Te = kConditionTe;
+constexpr std::uint32_t Ta = kConditionTa;
+
+/**
+ * @brief 5단 동사 활용 행 (사전형 어미 기준)
+ */
+struct GodanRow {
+    const char* u;     // 사전형 어미
+    const char* i;     // 연용형
+    const char* a;     // 미연형
+    const char* e;     // 가정형/명령형
+    const char* o;     // 의지형
+    const char* te;    // て형
+    const char* ta;    // た형
+};
+
+constexpr std::array<GodanRow, 9> kGodanRows = {{
+    {"く", "き", "か", "け", "こ", "いて", "いた"},
+    {"ぐ", "ぎ", "が", "げ", "ご", "いで", "いだ"},
+    {"す", "し", "さ", "せ", "そ", "して", "した"},
+    {"つ", "ち", "た", "て", "と", "って", "った"},
+    {"ぬ", "に", "な", "ね", "の", "んで", "んだ"},
+    {"ぶ", "び", "ば", "べ", "ぼ", "んで", "んだ"},
+    {"む", "み", "ま", "め", "も", "んで", "んだ"},
+    {"る", "り", "ら", "れ", "ろ", "って", "った"},
+    {"う", "い", "わ", "え", "お", "って", "った"},
+}};
+
+std::vector<DeinflectionRule> DefaultRules() {
+    std::vector<DeinflectionRule> rules;
+    auto add = [&rules](std::string from, std::string to, std::uint32_t in, std::uint32_t out, const char* name) {
+        rules.push_back({std::move(from), std::move(to), in, out, name});
+    };
+    auto s = [](const char* a, const char* b = "") { return std::string(a) + b; };
+
+    // 5단 동사
+    for (const auto& row : kGodanRows) {
+        add(s(row.i, "ます"), row.u, Masu, V5, "polite");
+        add(s(row.a, "ない"), row.u, AdjI, V5, "negative");
+        add(s(row.a, "ず"), row.u, 0, V5, "zu");
+        add(s(row.a, "ぬ"), row.u, 0, V5, "nu");
+        add(s(row.a, "れる"), row.u, V1, V5, "passive");
+        add(s(row.a, "せる"), row.u, V1, V5, "causative");
+        add(s(row.e, "る"), row.u, V1, V5, "potential");
+        add(s(row.e, "ば"), row.u, 0, V5, "provisional");
+        add(row.e, row.u, 0, V5, "imperative");
+        add(s(row.o, "う"), row.u, 0, V5, "volitional");
+        add(s(row.i, "たい"), row.u, AdjI, V5, "tai");
+        add(row.i, row.u, 0, V5, "masu stem");
+        add(row.te, row.u, Te, V5, "te");
+        add(row.ta, row.u, Ta, V5, "past");
+    }
+    // 行く는 て/た형이 불규칙
+    add("行って", "行く", Te, V5, "te");
+    add("行った", "行く", Ta, V5, "past");
+    add("いって", "いく", Te, V5, "te");
+    add("いった", "いく", Ta, V5, "past");
+
+    // 1단 동사
+    add("ます", "る", Masu, V1, "polite");
+    add("ない", "る", AdjI, V1, "negative");
+    add("ず", "る", 0, V1, "zu");
+    add("ぬ", "る", 0, V1, "nu");
+    add("られる", "る", V1, V1, "passive/potential");
+    add("れる", "る", V1, V1, "potential (ra-nuki)");
+    add("させる", "る", V1, V1, "causative");
+    add("れば", "る", 0, V1, "provisional");
+    add("ろ", "る", 0, V1, "imperative");
+    add("よ", "る", 0, V1, "imperative");
+    add("よう", "る", 0, V1, "volitional");
+    add("たい", "る", AdjI, V1, "tai");
+    add("", "る", 0, V1, "masu stem");
+    add("て", "る", Te, V1, "te");
+    add("た", "る", Ta, V1, "past");
+
+    // 来る (かな/한자 표기)
+    for (const char* stem : {"", "来"}) {
+        const bool kana = *stem == '\0';
+        const std::string dict = kana ? "くる" : s(stem, "る");
+        add(kana ? "きます" : s(stem, "ます"), dict, Masu, Vk, "polite");
+        add(kana ? "こない" : s(stem, "ない"), dict, AdjI, Vk, "negative");
+        add(kana ? "こられる" : s(stem, "られる"), dict, V1, Vk, "passive/potential");
+        add(kana ? "こさせる" : s(stem, "させる"), dict, V1, Vk, "causative");
+        add(kana ? "くれば" : s(stem, "れば"), dict, 0, Vk, "provisional");
+        add(kana ? "こい" : s(stem, "い"), dict, 0, Vk, "imperative");
+        add(kana ? "こよう" : s(stem, "よう"), dict, 0, Vk, "volitional");
+        add(kana ? "きたい" : s(stem, "たい"), dict, AdjI, Vk, "tai");
+        add(kana ? "きて" : s(stem, "て"), dict, Te, Vk, "te");
+        add(kana ? "きた" : s(stem, "た"), dict, Ta, Vk, "past");
+    }
+
+    // する
+    add("します", "する", Masu, Vs, "polite");
+    add("しない", "する", AdjI, Vs, "negative");
+    add("せず", "する", 0, Vs, "zu");
+    add("される", "する", V1, Vs, "passive");
+    add("させる", "する", V1, Vs, "causative");
+    add("すれば", "する", 0, Vs, "provisional");
+    add("しろ", "する", 0, Vs, "imperative");
+    add("せよ", "する", 0, Vs, "imperative");
+    add("しよう", "する", 0, Vs, "volitional");
+    add("したい", "する", AdjI, Vs, "tai");
+    add("して", "する", Te, Vs, "te");
+    add("した", "する", Ta, Vs, "past");
+
+    // い형용사 (ない/たい도 같은 활용)
+    add("かった", "い", Ta, AdjI, "past");
+    add("くて", "い", Te, AdjI, "te");
+    add("く", "い", 0, AdjI, "adverbial");
+    add("ければ", "い", 0, AdjI, "provisional");
+    add("さ", "い", 0, AdjI, "noun");
+    add("そう", "い", 0, AdjI, "sou");
+    add("すぎる", "い", V1, AdjI, "sugiru");
+
+    // 정중형 활용
+    add("ました", "ます", Ta, Masu, "polite past");
+    add("ません", "ます", 0, Masu, "polite negative");
+    add("ませんでした", "ます", 0, Masu, "polite past negative");
+    add("ましょう", "ます", 0, Masu, "polite volitional");
+    add("まして", "ます", Te, Masu, "polite te");
+
+    // た형 조건/열거
+    add("たら", "た", 0, Ta, "tara");
+    add("たり", "た", 0, Ta, "tari");
+    add("だら", "だ", 0, Ta, "tara");
+    add("だり", "だ", 0, Ta, "tari");
+
+    // て형 보조동사와 구어 축약
+    add("ている", "て", V1, Te, "te-iru");
+    add("てる", "て", V1, Te, "te-iru (contracted)");
+    add("でいる", "で", V1, Te, "te-iru");
+    add("でる", "で", V1, Te, "te-iru (contracted)");
+    add("てしまう", "て", V5, Te, "te-shimau");
+    add("でしまう", "で", V5, Te, "te-shimau");
+    add("ちゃう", "て", V5, Te, "chau");
+    add("じゃう", "で", V5, Te, "chau");
+    add("ちまう", "て", V5, Te, "chimau");
+    add("じまう", "で", V5, Te, "chimau");
+    add("ておく", "て", V5, Te, "te-oku");
+    add("とく", "て", V5, Te, "te-oku (contracted)");
+    add("どく", "で", V5, Te, "te-oku (contracted)");
+    add("てある", "て", V5, Te, "te-aru");
+    add("てくる", "て", Vk, Te, "te-kuru");
+    add("ていく", "て", V5, Te, "te-iku");
+    add("てく", "て", V5, Te, "te-iku (contracted)");
+
+    // 부정 구어 축약
+    add("なきゃ", "ない", 0, AdjI, "nakya");
+    add("なくちゃ", "ない", 0, AdjI, "nakucha");
+    add("ねえ", "ない", 0, AdjI, "nee");
+    add("ねー", "ない", 0, AdjI, "nee");
+    add("なかった", "ない", Ta, AdjI, "past");
+    add("なくて", "ない", Te, AdjI, "te");
+    add("ん", "ない", 0, AdjI, "n (negative)");
+    return rules;
+}
+
+std::size_t NextCharEnd(std::string_view text, std::size_t pos) {
+    text::DecodeUtf8(text, pos);
+    return pos;
+}
+
+}  // namespace
+
+Deinflector::Deinflector()
+    : Deinflector(DefaultRules()) {
+}
+
+Deinflector::Deinflector(std::vector<DeinflectionRule> rules)
+    : rules_(std::move(rules)) {
+    Compile();
+}
+
+void Deinflector::Compile() {
+    // 규칙의 from을 뒤집어 넣은 트라이를 만든 뒤 평탄화 (간선은 바이트 순 정렬)
+    std::vector<std::map<unsigned char, std::uint32_t>> children(1);
+    std::vector<std::vector<std::uint16_t>> rulesAt(1);
+    for (std::size_t r = 0; r < rules_.size() && r <= UINT16_MAX; ++r) {
+        std::uint32_t node = 0;
+        const std::string& from = rules_[r].from;
+        for (auto it = from.rbegin(); it != from.rend(); ++it) {
+            const auto byte = static_cast<unsigned char>(*it);
+            auto found = children[node].find(byte);
+            if (found == children[node].end()) {
+                found = children[node].emplace(byte, static_cast<std::uint32_t>(children.size())).first;
+                children.emplace_back();
+                rulesAt.emplace_back();
+            }
+            node = found->second;
+        }
+        rulesAt[node].push_back(static_cast<std::uint16_t>(r));
+    }
+
+    nodes_.assign(children.size(), {});
+    edges_.clear();
+    nodeRules_.clear();
+    for (std::size_t n = 0; n < children.size(); ++n) {
+        nodes_[n].firstEdge = static_cast<std::uint32_t>(edges_.size());
+        nodes_[n].edgeCount = static_cast<std::uint32_t>(children[n].size());
+        for (const auto& [byte, target] : children[n]) {
+            edges_.push_back({byte, target});
+        }
+        nodes_[n].firstRule = static_cast<std::uint32_t>(nodeRules_.size());
+        nodes_[n].ruleCount = static_cast<std::uint32_t>(rulesAt[n].size());
+        nodeRules_.insert(nodeRules_.end(), rulesAt[n].begin(), rulesAt[n].end());
+    }
+}
+
+template <typename Visitor>
+void Deinflector::ForEachMatchingRule(std::string_view text, Visitor&& visit) const {
+    std::uint32_t node = 0;
+    std::size_t remaining = text.size();
+    while (true) {
+        const Node& current = nodes_[node];
+        for (std::uint32_t i = 0; i < current.ruleCount; ++i) {
+            visit(nodeRules_[current.firstRule + i]);
+        }
+        if (remaining == 0) {
+            return;
+        }
+        const auto byte = static_cast<unsigned char>(text[--remaining]);
+        const auto begin = edges_.begin() + current.firstEdge;
+        const auto end = begin + current.edgeCount;
+        const auto edge = std::lower_bound(begin, end, byte, [](const Edge& e, unsigned char b) {
+            return e.byte < b;
+        });
+        if (edge == end || edge->byte != byte) {
+            return;
+        }
+        node = edge->target;
+    }
+}
+
+std::vector<Deinflection> Deinflector::Deinflect(std::string_view surface) const {
+    std::vector<Deinflection> results;
+    results.push_back({std::string(surface), kConditionNone, {}});
+
+    for (std::size_t i = 0; i < results.size() && results.size() < kMaxCandidates; ++i) {
+        if (results[i].rules.size() >= kMaxChainLength) {
+            continue;
+        }
+        // push_back으로 참조가 무효화되므로 복사해서 사용
+        const std::string term = results[i].term;
+        const std::uint32_t conditions = results[i].conditions;
+        const std::vector<std::uint16_t> chain = results[i].rules;
+
+        ForEachMatchingRule(term, [&](std::uint16_t ruleIndex) {
+            // 한 후보에서 여러 규칙이 맞아도 상한을 넘기지 않음
+            if (results.size() >= kMaxCandidates) {
+                return;
+            }
+            const DeinflectionRule& rule = rules_[ruleIndex];
+            if (conditions != kConditionNone && (conditions & rule.conditionsIn) == 0) {
+                return;
+            }
+            std::string next = term.substr(0, term.size() - rule.from.size()) + rule.to;
+            if (next.empty() || next == term) {
+                return;
+            }
+            const bool duplicate = std::any_of(results.begin(), results.end(), [&](const Deinflection& existing) {
+                return existing.conditions == rule.conditionsOut && existing.term == next;
+            });
+            if (duplicate) {
+                return;
+            }
+            Deinflection candidate{std::move(next), rule.conditionsOut, chain};
+            candidate.rules.push_back(ruleIndex);
+            results.push_back(std::move(candidate));
+        });
+    }
+    return results;
+}
+
+bool Deinflector::HasRuleSuffix(std::string_view text) const {
+    bool found = false;
+    std::size_t depth = 0;
+    std::uint32_t node = 0;
+    for (std::size_t remaining = text.size(); remaining > 0 && !found; ++depth) {
+        const Node& current = nodes_[node];
+        const auto byte = static_cast<unsigned char>(text[--remaining]);
+        const auto begin = edges_.begin() + current.firstEdge;
+        const auto end = begin + current.edgeCount;
+        const auto edge = std::lower_bound(begin, end, byte, [](const Edge& e, unsigned char b) {
+            return e.byte < b;
+        });
+        if (edge == end || edge->byte != byte) {
+            break;
+        }
+        node = edge->target;
+        found = nodes_[node].ruleCount > 0;
+    }
+    return found;
+}
+
+std::string_view Deinflector::RuleName(std::uint16_t index) const {
+    return index < rules_.size() ? std::string_view(rules_[index].name) : std::string_view();
+}
+
+std::uint32_t Deinflector::ConditionsFromPartOfSpeech(std::string_view tags) {
+    std::uint32_t conditions = kConditionNone;
+    while (!tags.empty()) {
+        const std::size_t comma = tags.find(',');
+        const std::string_view tag = tags.substr(0, comma);
+        if (tag == "v1" || tag.starts_with("v1-")) {
+            conditions |= kConditionV1;
+        } else if (tag.starts_with("v5")) {
+            conditions |= kConditionV5;
+        } else if (tag == "vk") {
+            conditions |= kConditionVk;
+        } else if (tag == "vs" || tag == "vs-i" || tag == "vs-s") {
+            conditions |= kConditionVs;
+        } else if (tag == "adj-i" || tag == "adj-ix") {
+            conditions |= kConditionAdjI;
+        }
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        tags.remove_prefix(comma + 1);
+    }
+    return conditions;
+}
+
+bool Deinflector::MatchesDictionary(const CompiledDictionary& dictionary,
+                                    const Deinflection& candidate,
+                                    std::uint32_t& entryId) const {
+    const auto ids = dictionary.Lookup(candidate.term);
+    if (ids.empty()) {
+        return false;
+    }
+    if (candidate.conditions == kConditionNone) {
+        entryId = ids.front();
+        return true;
+    }
+    // 역변환 결과는 품사가 맞는 엔트리만 인정 (중간 어형은 사전에 없음)
+    for (const std::uint32_t id : ids) {
+        const auto entry = dictionary.Entry(id);
+        for (std::uint32_t s = 0; s < entry.senseCount; ++s) {
+            if (ConditionsFromPartOfSpeech(dictionary.Sense(id, s).partOfSpeech) & candidate.conditions) {
+                entryId = id;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::optional<DeinflectedMatch> Deinflector::FindLongestMatch(const CompiledDictionary& dictionary,
+                                                              std::string_view text,
+                                                              std::size_t maxChars) const {
+    std::array<std::size_t, 64> ends{};
+    std::size_t endCount = 0;
+    for (std::size_t pos = 0; pos < text.size() && endCount < std::min(maxChars, ends.size());) {
+        pos = NextCharEnd(text, pos);
+        ends[endCount++] = pos;
+    }
+    if (endCount == 0) {
+        return std::nullopt;
+    }
+
+    std::optional<DeinflectedMatch> best;
+    // 활용하지 않은 형태: 트라이 접두사 검색 한 번으로 가장 긴 것
+    std::array<DictionaryPrefixMatch, 64> prefixes;
+    const std::size_t prefixCount =
+        dictionary.LookupPrefixes(text.substr(0, ends[endCount - 1]), prefixes.data(), prefixes.size());
+    if (prefixCount > 0) {
+        const auto& longest = prefixes[prefixCount - 1];
+        best = DeinflectedMatch{0, longest.length, longest.entries.front(),
+                                {std::string(text.substr(0, longest.length)), kConditionNone, {}}};
+    }
+
+    // 활용형: 긴 것부터, 규칙 접미사가 맞는 길이만 역변환
+    for (std::size_t k = endCount; k-- > 0;) {
+        const std::size_t length = ends[k];
+        if (best && length <= best->length) {
+            break;
+        }
+        const std::string_view candidateText = text.substr(0, length);
+        if (!HasRuleSuffix(candidateText)) {
+            continue;
+        }
+        auto candidates = Deinflect(candidateText);
+        for (std::size_t c = 1; c < candidates.size(); ++c) {
+            std::uint32_t entryId = 0;
+            if (MatchesDictionary(dictionary, candidates[c], entryId)) {
+                return DeinflectedMatch{0, length, entryId, std::move(candidates[c])};
+            }
+        }
+    }
+    return best;
+}
+
+std::vector<DeinflectedMatch> Deinflector::ScanSentence(const CompiledDictionary& dictionary,
+                                                        std::string_view text,
+                                                        std::size_t maxChars) const {
+    std::vector<DeinflectedMatch> matches;
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        auto match = FindLongestMatch(dictionary, text.substr(pos), maxChars);
+        if (!match) {
+            pos = NextCharEnd(text, pos);
+            continue;
+        }
+        match->offset = pos;
+        pos += match->length;
+        matches.push_back(std::move(*match));
+    }
+    return matches;
+}
+
+}  // namespace dictionary
+}  // namespace toriyomi
@@ -0,0 +1,154 @@
+// ToriYomi - 활용형 역변환 (deinflection)
+// 활용된 표면형에서 사전형 후보를 만들어 사전 조회에 사용
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace toriyomi {
+namespace dictionary {
+
+class CompiledDictionary;
+
+/**
+ * @brief 활용 규칙이 요구/생성하는 어형 종류 (비트 마스크)
+ *
+ * 사전 품사와 대응하는 종류(V1~AdjI)와, 규칙끼리 이어 붙이기 위한
+ * 중간 어형(Masu, Te, Ta)이 있습니다.
+ */
+enum DeinflectCondition : std::uint32_t {
+    kConditionNone = 0,
+    kConditionV1 = 1u << 0,     // 1단 동사 (1단처럼 활용하는 ～てる, ～られる 포함)
+    kConditionV5 = 1u << 1,     // 5단 동사
+    kConditionVk = 1u << 2,     // 来る
+    kConditionVs = 1u << 3,     // する
+    kConditionAdjI = 1u << 4,   // い형용사 (ない/たい 포함)
+    kConditionMasu = 1u << 5,   // ～ます
+    kConditionTe = 1u << 6,     // ～て/～で
+    kConditionTa = 1u << 7,     // ～た/～だ
+};
+
+constexpr std::uint32_t kDictionaryFormConditions =
+    kConditionV1 | kConditionV5 | kConditionVk | kConditionVs | kConditionAdjI;
+
+/**
+ * @brief 활용 규칙 하나: 끝이 from인 어형(conditionsIn)을 끝이 to인 어형(conditionsOut)으로
+ *
+ * conditionsIn이 0이면 원래 입력에만 적용됩니다 (더 활용되지 않는 어형).
+ */
+struct DeinflectionRule {
+    std::string from;
+    std::string to;
+    std::uint32_t conditionsIn = kConditionNone;
+    std::uint32_t conditionsOut = kConditionNone;
+    std::string name;   // 예: "past", "te-iru"
+};
+
+/**
+ * @brief 역변환 후보 하나
+ */
+struct Deinflection {
+    std::string term;                       // 사전형 후보
+    std::uint32_t conditions = kConditionNone;   // 후보 어형 종류 (0 = 원래 입력)
+    std::vector<std::uint16_t> rules;       // 적용한 규칙 (입력에 가까운 것부터)
+};
+
+/**
+ * @brief 사전으로 검증된 역변환 결과
+ */
+struct DeinflectedMatch {
+    std::size_t offset = 0;       // 문장 기준 바이트 오프셋
+    std::size_t length = 0;       // 일치한 표면형 길이 (바이트)
+    std::uint32_t entryId = 0;    // CompiledDictionary 엔트리 ID
+    Deinflection deinflection;
+};
+
+/**
+ * @brief 규칙 표를 역방향 접미사 상태 기계로 컴파일한 역변환기
+ *
+ * 어형 끝에서부터 바이트를 거꾸로 따라가며 맞는 규칙을 한 번에 모으고,
+ * 규칙 연쇄(예: 食べちゃった → 食べちゃう → 食べて → 食べる)를 너비 우선으로 펼칩니다.
+ * 생성 후에는 불변이며 스레드 안전합니다.
+ */
+class Deinflector {
+public:
+    /**
+     * @brief 기본 규칙 표 (동사/형용사 활용 + ～ちゃう, ～てる 등 구어 축약)
+     */
+    Deinflector();
+
+    explicit Deinflector(std::vector<DeinflectionRule> rules);
+
+    /**
+     * @brief 사전형 후보 나열 (첫 번째는 항상 원래 입력)
+     */
+    std::vector<Deinflection> Deinflect(std::string_view surface) const;
+
+    /**
+     * @brief 빈 접미사가 아닌 규칙이 text 끝에 맞는지 (역변환할 필요가 있는지)
+     */
+    bool HasRuleSuffix(std::string_view text) const;
+
+    std::string_view RuleName(std::uint16_t index) const;
+    std::size_t RuleCount() const { return rules_.size(); }
+
+    /**
+     * @brief 사전 품사 태그(쉼표 구분, JMdict 엔티티 이름)를 어형 종류로 변환
+     */
+    static std::uint32_t ConditionsFromPartOfSpeech(std::string_view tags);
+
+    /**
+     * @brief text 시작 위치에서 사전에 있는 가장 긴 단어 (활용형 포함)
+     *
+     * @param maxChars 시도할 최대 글자 수
+     */
+    std::optional<DeinflectedMatch> FindLongestMatch(const CompiledDictionary& dictionary,
+                                                     std::string_view text,
+                                                     std::size_t maxChars = 16) const;
+
+    /**
+     * @brief 문장 전체를 앞에서부터 최장 일치로 나눠 사전 단어 목록 생성
+     *
+     * 일치하지 않는 글자는 한 글자씩 건너뜁니다.
+     */
+    std::vector<DeinflectedMatch> ScanSentence(const CompiledDictionary& dictionary,
+                                               std::string_view text,
+                                               std::size_t maxChars = 16) const;
+
+private:
+    struct Node {
+        std::uint32_t firstEdge = 0;
+        std::uint32_t edgeCount = 0;
+        std::uint32_t firstRule = 0;
+        std::uint32_t ruleCount = 0;
+    };
+    struct Edge {
+        unsigned char byte = 0;
+        std::uint32_t target = 0;
+    };
+
+    void Compile();
+
+    /**
+     * @brief text 끝에 맞는 규칙을 순서대로 visit에 전달
+     */
+    template <typename Visitor>
+    void ForEachMatchingRule(std::string_view text, Visitor&& visit) const;
+
+    bool MatchesDictionary(const CompiledDictionary& dictionary,
+                           const Deinflection& candidate,
+                           std::uint32_t& entryId) const;
+
+    std::vector<DeinflectionRule> rules_;
+    std::vector<Node> nodes_;
+    std::vector<Edge> edges_;
+    std::vector<std::uint16_t> nodeRules_;
+};
+
+}  // namespace dictionary
+}  // namespace toriyomi
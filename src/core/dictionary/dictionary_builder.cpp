@@ -0,0 +1,218 @@
+// ToriYomi - 사전 컴파일러 구현
+
+#include "dictionary_builder.h"
+#include "dictionary_format.h"
+#include "double_array_trie.h"
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+namespace toriyomi {
+namespace dictionary {
+
+namespace {
+
+/**
+ * @brief 같은 문자열은 한 번만 저장하는 문자열 풀
+ */
+class StringPool {
+public:
+    bool Add(const std::string& text, StringRef& ref) {
+        const auto it = offsets_.find(text);
+        if (it != offsets_.end()) {
+            ref = it->second;
+            return true;
+        }
+        if (data_.size() + text.size() > std::numeric_limits<std::uint32_t>::max()) {
+            return false;
+        }
+        ref = {static_cast<std::uint32_t>(data_.size()), static_cast<std::uint32_t>(text.size())};
+        data_ += text;
+        offsets_.emplace(text, ref);
+        return true;
+    }
+
+    const std::string& Data() const { return data_; }
+
+private:
+    std::string data_;
+    std::unordered_map<std::string, StringRef> offsets_;
+};
+
+std::string Join(const std::vector<std::string>& items, const char* separator) {
+    std::string joined;
+    for (const auto& item : items) {
+        if (!joined.empty()) {
+            joined += separator;
+        }
+        joined += item;
+    }
+    return joined;
+}
+
+void SetError(std::string* errorMessage, const char* message) {
+    if (errorMessage) {
+        *errorMessage = message;
+    }
+}
+
+constexpr std::uint64_t AlignUp(std::uint64_t value) {
+    return (value + 7) & ~std::uint64_t{7};
+}
+
+/**
+ * @brief 섹션을 8바이트 정렬로 이어 쓰는 출력기
+ */
+class SectionWriter {
+public:
+    explicit SectionWriter(std::ofstream& out) : out_(out), position_(sizeof(DictionaryFileHeader)) {}
+
+    template <typename T>
+    DictionarySection Write(const std::vector<T>& records) {
+        return WriteBytes(records.data(), records.size() * sizeof(T), records.size());
+    }
+
+    DictionarySection WriteString(const std::string& data) {
+        return WriteBytes(data.data(), data.size(), data.size());
+    }
+
+private:
+    DictionarySection WriteBytes(const void* data, std::size_t bytes, std::size_t count) {
+        const std::uint64_t aligned = AlignUp(position_);
+        static constexpr char kPadding[8] = {};
+        out_.write(kPadding, static_cast<std::streamsize>(aligned - position_));
+        if (bytes > 0) {
+            out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        }
+        position_ = aligned + bytes;
+        return {aligned, count};
+    }
+
+    std::ofstream& out_;
+    std::uint64_t position_;
+};
+
+}  // namespace
+
+void DictionaryBuilder::AddEntry(DictionaryEntry entry) {
+    if (entry.kanji.empty() && entry.readings.empty()) {
+        return;
+    }
+    entries_.push_back(std::move(entry));
+}
+
+bool DictionaryBuilder::WriteToFile(const std::filesystem::path& path, std::string* errorMessage) const {
+    if (entries_.size() >= std::numeric_limits<std::int32_t>::max()) {
+        SetError(errorMessage, "엔트리가 너무 많습니다");
+        return false;
+    }
+
+    StringPool strings;
+    std::vector<EntryRecord> entryRecords;
+    std::vector<SenseRecord> senseRecords;
+    // std::string 비교는 바이트(unsigned) 순서이므로 트라이 입력 순서와 같음
+    std::map<std::string, std::vector<std::uint32_t>> keyEntries;
+    entryRecords.reserve(entries_.size());
+
+    for (std::size_t id = 0; id < entries_.size(); ++id) {
+        const DictionaryEntry& entry = entries_[id];
+        EntryRecord record;
+        record.sequence = entry.sequence;
+        record.flags = entry.common ? static_cast<std::uint32_t>(kEntryCommon) : 0u;
+        record.firstSense = static_cast<std::uint32_t>(senseRecords.size());
+        record.senseCount = static_cast<std::uint32_t>(entry.senses.size());
+
+        const std::string& headword = entry.kanji.empty() ? entry.readings.front() : entry.kanji.front();
+        const std::string reading = entry.readings.empty() ? std::string() : entry.readings.front();
+        bool ok = strings.Add(headword, record.headword) && strings.Add(reading, record.reading);
+        for (const auto& sense : entry.senses) {
+            SenseRecord senseRecord;
+            ok = ok && strings.Add(Join(sense.partsOfSpeech, ","), senseRecord.partOfSpeech) &&
+                 strings.Add(Join(sense.glosses, "; "), senseRecord.glosses);
+            senseRecords.push_back(senseRecord);
+        }
+        if (!ok) {
+            SetError(errorMessage, "문자열 풀이 4GB를 넘었습니다");
+            return false;
+        }
+        entryRecords.push_back(record);
+
+        for (const auto* forms : {&entry.kanji, &entry.readings}) {
+            for (const auto& form : *forms) {
+                if (form.empty()) {
+                    continue;
+                }
+                auto& ids = keyEntries[form];
+                if (ids.empty() || ids.back() != id) {
+                    ids.push_back(static_cast<std::uint32_t>(id));
+                }
+            }
+        }
+    }
+
+    std::vector<std::pair<std::string, std::uint32_t>> trieKeys;
+    std::vector<KeyRecord> keyRecords;
+    std::vector<std::uint32_t> postings;
+    trieKeys.reserve(keyEntries.size());
+    keyRecords.reserve(keyEntries.size());
+    for (const auto& [key, ids] : keyEntries) {
+        trieKeys.emplace_back(key, static_cast<std::uint32_t>(keyRecords.size()));
+        keyRecords.push_back({static_cast<std::uint32_t>(postings.size()), static_cast<std::uint32_t>(ids.size())});
+        postings.insert(postings.end(), ids.begin(), ids.end());
+    }
+
+    DoubleArrayTrieBuilder trie;
+    if (!trie.Build(trieKeys)) {
+        SetError(errorMessage, "트라이 생성 실패");
+        return false;
+    }
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            SetError(errorMessage, "출력 파일을 열 수 없습니다");
+            return false;
+        }
+
+        DictionaryFileHeader header;
+        std::memcpy(header.magic, kDictionaryMagic, sizeof(header.magic));
+        header.version = kDictionaryFormatVersion;
+        header.headerSize = sizeof(DictionaryFileHeader);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        SectionWriter writer(out);
+        header.trie = writer.Write(trie.Units());
+        header.keys = writer.Write(keyRecords);
+        header.postings = writer.Write(postings);
+        header.entries = writer.Write(entryRecords);
+        header.senses = writer.Write(senseRecords);
+        header.strings = writer.WriteString(strings.Data());
+
+        // 섹션 위치가 정해진 뒤 헤더 다시 쓰기
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!out) {
+            SetError(errorMessage, "출력 파일 쓰기 실패");
+            return false;
+        }
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        SetError(errorMessage, "출력 파일 교체 실패");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace dictionary
+}  // namespace toriyomi
@@ -0,0 +1,64 @@
+// ToriYomi - 사전 컴파일러
+// 사전 엔트리를 모아 CompiledDictionary가 매핑할 바이너리 파일로 저장
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace toriyomi {
+namespace dictionary {
+
+/**
+ * @brief 뜻 하나 (품사 + 뜻풀이)
+ */
+struct DictionarySense {
+    std::vector<std::string> partsOfSpeech;   // 예: "v1", "vt"
+    std::vector<std::string> glosses;
+};
+
+/**
+ * @brief 사전 엔트리 하나 (JMdict <entry>에 해당)
+ */
+struct DictionaryEntry {
+    std::uint32_t sequence = 0;
+    std::vector<std::string> kanji;       // 한자 표기 (keb)
+    std::vector<std::string> readings;    // 읽기 (reb, 히라가나/가타카나)
+    std::vector<DictionarySense> senses;
+    bool common = false;
+};
+
+/**
+ * @brief 컴파일된 사전 파일 생성기 (오프라인 도구용)
+ *
+ * 모든 한자 표기와 읽기를 키로 더블 어레이 트라이에 넣고,
+ * 키마다 엔트리 ID 목록을, 엔트리마다 뜻 레코드를 연결합니다.
+ * 같은 키의 엔트리는 추가한 순서를 유지합니다.
+ */
+class DictionaryBuilder {
+public:
+    /**
+     * @brief 엔트리 추가 (표기/읽기가 하나도 없으면 무시)
+     */
+    void AddEntry(DictionaryEntry entry);
+
+    std::size_t EntryCount() const { return entries_.size(); }
+
+    /**
+     * @brief 파일로 저장 (임시 파일에 쓴 뒤 교체)
+     *
+     * @param path 출력 경로
+     * @param errorMessage 실패 사유 (nullptr 허용)
+     * @return 성공 여부
+     */
+    bool WriteToFile(const std::filesystem::path& path, std::string* errorMessage = nullptr) const;
+
+private:
+    std::vector<DictionaryEntry> entries_;
+};
+
+}  // namespace dictionary
+}  // namespace toriyomi
@@ -0,0 +1,75 @@
+// ToriYomi - 컴파일된 사전 파일 형식
+// DictionaryBuilder가 쓰고 CompiledDictionary가 매핑해서 그대로 읽는 레코드 정의
+
+#pragma once
+
+#include <cstdint>
+
+namespace toriyomi {
+namespace dictionary {
+
+/**
+ * 파일 구조 (리틀 엔디언, 모든 섹션은 8바이트 정렬)
+ *
+ *   DictionaryFileHeader
+ *   trie      DoubleArrayUnit[]   표제어/읽기 → 키 ID
+ *   keys      KeyRecord[]         키 ID → postings 구간
+ *   postings  uint32_t[]          엔트리 ID 목록
+ *   entries   EntryRecord[]
+ *   senses    SenseRecord[]
+ *   strings   char[]              UTF-8 문자열 풀 (NUL 종료 없음)
+ */
+constexpr char kDictionaryMagic[8] = {'T', 'Y', 'D', 'I', 'C', 'T', '\0', '\0'};
+constexpr std::uint32_t kDictionaryFormatVersion = 1;
+
+struct DictionarySection {
+    std::uint64_t offset = 0;    // 파일 시작 기준 바이트
+    std::uint64_t count = 0;     // 레코드 개수 (strings는 바이트 수)
+};
+
+struct DictionaryFileHeader {
+    char magic[8] = {};
+    std::uint32_t version = 0;
+    std::uint32_t headerSize = 0;
+    DictionarySection trie;
+    DictionarySection keys;
+    DictionarySection postings;
+    DictionarySection entries;
+    DictionarySection senses;
+    DictionarySection strings;
+};
+
+struct StringRef {
+    std::uint32_t offset = 0;
+    std::uint32_t length = 0;
+};
+
+struct KeyRecord {
+    std::uint32_t firstPosting = 0;
+    std::uint32_t postingCount = 0;
+};
+
+enum EntryFlags : std::uint32_t {
+    kEntryCommon = 1u << 0,    // ke_pri/re_pri 우선순위 태그가 있는 엔트리
+};
+
+struct EntryRecord {
+    std::uint32_t sequence = 0;    // JMdict ent_seq
+    std::uint32_t flags = 0;
+    StringRef headword;            // 첫 번째 한자 표기 (없으면 첫 번째 읽기)
+    StringRef reading;             // 첫 번째 읽기
+    std::uint32_t firstSense = 0;
+    std::uint32_t senseCount = 0;
+};
+
+struct SenseRecord {
+    StringRef partOfSpeech;        // 품사 태그 (JMdict 엔티티 이름, 쉼표 구분)
+    StringRef glosses;             // 뜻풀이 ("; " 구분)
+};
+
+static_assert(sizeof(DictionaryFileHeader) == 112, "파일 헤더 크기가 바뀌면 형식 버전을 올려야 함");
+static_assert(sizeof(EntryRecord) == 32, "EntryRecord 크기가 바뀌면 형식 버전을 올려야 함");
+static_assert(sizeof(SenseRecord) == 16, "SenseRecord 크기가 바뀌면 형식 버전을 올려야 함");
+
+}  // namespace dictionary
+}  // namespace toriyomi
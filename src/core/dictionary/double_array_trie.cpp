@@ -0,0 +1,179 @@
+// ToriYomi - 더블 어레이 트라이 구현
+
+#include "double_array_trie.h"
+#include <algorithm>
+#include <limits>
+
+namespace toriyomi {
+namespace dictionary {
+
+namespace {
+
+// 빈 칸 탐색 시작 위치를 앞으로 당기는 기준 (지나온 칸 중 사용 중인 비율)
+constexpr double kDenseRatio = 0.95;
+
+constexpr std::uint32_t LabelAt(const std::string& key, std::size_t depth) {
+    return depth < key.size() ? static_cast<std::uint32_t>(static_cast<unsigned char>(key[depth])) + 1 : 0;
+}
+
+}  // namespace
+
+bool DoubleArrayTrieBuilder::Build(const std::vector<std::pair<std::string, std::uint32_t>>& keys) {
+    units_.clear();
+    nextCheckPos_ = 1;
+    keys_ = &keys;
+
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i].first.empty() ||
+            keys[i].second >= static_cast<std::uint32_t>(std::numeric_limits<std::int32_t>::max())) {
+            return false;
+        }
+        if (i > 0 && !(keys[i - 1].first < keys[i].first)) {
+            return false;
+        }
+    }
+
+    EnsureSize(1);
+    units_[0].check = 0;  // 루트
+    if (!keys.empty()) {
+        BuildNode(0, 0, keys.size(), 0);
+    }
+
+    // 뒤쪽 빈 칸 정리
+    while (units_.size() > 1 && units_.back().check < 0) {
+        units_.pop_back();
+    }
+    keys_ = nullptr;
+    return true;
+}
+
+void DoubleArrayTrieBuilder::BuildNode(std::int32_t node, std::size_t begin, std::size_t end, std::size_t depth) {
+    const auto& keys = *keys_;
+
+    std::vector<Child> children;
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t label = LabelAt(keys[i].first, depth);
+        if (children.empty() || children.back().label != label) {
+            children.push_back({label, i, i + 1});
+        } else {
+            children.back().end = i + 1;
+        }
+    }
+
+    const std::int32_t base = FindBase(children);
+    units_[node].base = base;
+    // 자식 칸을 먼저 모두 점유해야 하위 노드가 같은 칸을 가져가지 않음
+    for (const auto& child : children) {
+        units_[base + child.label].check = node;
+    }
+
+    for (const auto& child : children) {
+        const std::int32_t index = base + static_cast<std::int32_t>(child.label);
+        if (child.label == 0) {
+            units_[index].base = -static_cast<std::int32_t>(keys[child.begin].second) - 1;
+        } else {
+            BuildNode(index, child.begin, child.end, depth + 1);
+        }
+    }
+}
+
+std::int32_t DoubleArrayTrieBuilder::FindBase(const std::vector<Child>& children) {
+    const std::uint32_t first = children.front().label;
+    const std::uint32_t last = children.back().label;
+
+    std::size_t pos = std::max<std::size_t>(nextCheckPos_, first + 1);
+    std::size_t occupied = 0;
+    bool sawFree = false;
+    for (;; ++pos) {
+        EnsureSize(pos + 1);
+        if (units_[pos].check >= 0) {
+            ++occupied;
+            continue;
+        }
+        if (!sawFree) {
+            nextCheckPos_ = pos;
+            sawFree = true;
+        }
+
+        const std::size_t base = pos - first;
+        EnsureSize(base + last + 1);
+        const bool fits = std::all_of(children.begin(), children.end(), [&](const Child& child) {
+            return units_[base + child.label].check < 0;
+        });
+        if (fits) {
+            break;
+        }
+    }
+
+    if (static_cast<double>(occupied) >= kDenseRatio * static_cast<double>(pos - nextCheckPos_ + 1)) {
+        nextCheckPos_ = pos;
+    }
+    return static_cast<std::int32_t>(pos - first);
+}
+
+void DoubleArrayTrieBuilder::EnsureSize(std::size_t size) {
+    if (units_.size() < size) {
+        units_.resize(std::max(size, units_.size() * 2));
+    }
+}
+
+bool DoubleArrayTrieView::Step(std::int32_t& node, std::uint32_t label) const {
+    const std::int32_t base = units_[node].base;
+    if (base <= 0) {
+        return false;
+    }
+    const std::size_t next = static_cast<std::size_t>(base) + label;
+    if (next >= size_ || units_[next].check != node) {
+        return false;
+    }
+    node = static_cast<std::int32_t>(next);
+    return true;
+}
+
+bool DoubleArrayTrieView::ValueAt(std::int32_t node, std::uint32_t& outValue) const {
+    std::int32_t terminal = node;
+    if (!Step(terminal, 0)) {
+        return false;
+    }
+    outValue = static_cast<std::uint32_t>(-units_[terminal].base - 1);
+    return true;
+}
+
+bool DoubleArrayTrieView::ExactMatch(std::string_view key, std::uint32_t& outValue) const {
+    if (size_ == 0 || key.empty()) {
+        return false;
+    }
+    std::int32_t node = 0;
+    for (const char ch : key) {
+        if (!Step(node, static_cast<std::uint32_t>(static_cast<unsigned char>(ch)) + 1)) {
+            return false;
+        }
+    }
+    return ValueAt(node, outValue);
+}
+
+std::size_t DoubleArrayTrieView::CommonPrefixSearch(std::string_view text,
+                                                    TriePrefixMatch* results,
+                                                    std::size_t maxResults) const {
+    if (size_ == 0 || maxResults == 0) {
+        return 0;
+    }
+    std::size_t count = 0;
+    std::int32_t node = 0;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (!Step(node, static_cast<std::uint32_t>(static_cast<unsigned char>(text[i])) + 1)) {
+            break;
+        }
+        std::uint32_t value = 0;
+        if (ValueAt(node, value)) {
+            results[count++] = {value, static_cast<std::uint32_t>(i + 1)};
+            if (count == maxResults) {
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+}  // namespace dictionary
+}  // namespace toriyomi
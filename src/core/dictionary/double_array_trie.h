@@ -0,0 +1,102 @@
+// ToriYomi - 더블 어레이 트라이
+// 사전 표제어/읽기 → 키 ID 조회 (빌드는 오프라인, 조회는 매핑된 메모리 위에서)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace toriyomi {
+namespace dictionary {
+
+/**
+ * @brief 더블 어레이 한 칸 (파일에 그대로 저장되는 형식)
+ *
+ * 노드 s에서 바이트 c로 가는 전이: t = base[s] + (c + 1), check[t] == s 이면 유효.
+ * 키 끝은 라벨 0으로 표시하며, 그 칸의 base는 -(값 + 1) 입니다.
+ * 빈 칸은 check = -1.
+ */
+struct DoubleArrayUnit {
+    std::int32_t base = 0;
+    std::int32_t check = -1;
+};
+static_assert(sizeof(DoubleArrayUnit) == 8, "DoubleArrayUnit은 파일 형식이므로 8바이트여야 함");
+
+/**
+ * @brief 공통 접두사 검색 결과 하나
+ */
+struct TriePrefixMatch {
+    std::uint32_t value = 0;     // 키에 연결된 값
+    std::uint32_t length = 0;    // 일치한 접두사 길이 (바이트)
+};
+
+/**
+ * @brief 더블 어레이 빌더
+ *
+ * 키는 바이트 단위(unsigned) 오름차순으로 정렬되고 중복이 없어야 합니다.
+ */
+class DoubleArrayTrieBuilder {
+public:
+    /**
+     * @brief 트라이 생성
+     *
+     * @param keys (키, 값) 목록 (정렬/중복 없음, 빈 키 불가, 값 < 2^31)
+     * @return 입력 조건을 만족하지 않으면 false
+     */
+    bool Build(const std::vector<std::pair<std::string, std::uint32_t>>& keys);
+
+    const std::vector<DoubleArrayUnit>& Units() const { return units_; }
+
+private:
+    struct Child {
+        std::uint32_t label = 0;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    void BuildNode(std::int32_t node, std::size_t begin, std::size_t end, std::size_t depth);
+    std::int32_t FindBase(const std::vector<Child>& children);
+    void EnsureSize(std::size_t size);
+
+    const std::vector<std::pair<std::string, std::uint32_t>>* keys_ = nullptr;
+    std::vector<DoubleArrayUnit> units_;
+    std::size_t nextCheckPos_ = 1;
+};
+
+/**
+ * @brief 더블 어레이 조회 (메모리를 소유하지 않음, 할당 없음)
+ */
+class DoubleArrayTrieView {
+public:
+    DoubleArrayTrieView() = default;
+    DoubleArrayTrieView(const DoubleArrayUnit* units, std::size_t size) : units_(units), size_(size) {}
+
+    /**
+     * @brief 키 전체가 일치하면 값을 outValue에 쓰고 true
+     */
+    bool ExactMatch(std::string_view key, std::uint32_t& outValue) const;
+
+    /**
+     * @brief text의 접두사 중 키로 등록된 것을 짧은 순으로 최대 maxResults개 기록
+     *
+     * @return 기록한 개수
+     */
+    std::size_t CommonPrefixSearch(std::string_view text, TriePrefixMatch* results, std::size_t maxResults) const;
+
+    bool Empty() const { return size_ == 0; }
+    std::size_t Size() const { return size_; }
+
+private:
+    bool Step(std::int32_t& node, std::uint32_t label) const;
+    bool ValueAt(std::int32_t node, std::uint32_t& outValue) const;
+
+    const DoubleArrayUnit* units_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+}  // namespace dictionary
+}  // namespace toriyomi
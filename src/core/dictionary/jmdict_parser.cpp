@@ -0,0 +1,277 @@
+// ToriYomi - JMdict XML 파서 구현
+
+#include "jmdict_parser.h"
+#include "common/text/unicode_utils.h"
+#include <charconv>
+#include <iterator>
+
+namespace toriyomi {
+namespace dictionary {
+
+namespace {
+
+void SetError(std::string* errorMessage, std::string message) {
+    if (errorMessage) {
+        *errorMessage = std::move(message);
+    }
+}
+
+/**
+ * @brief XML 텍스트의 엔티티 해석 (JMdict 정의 엔티티는 이름만 남김)
+ */
+std::string DecodeText(std::string_view raw) {
+    std::string result;
+    result.reserve(raw.size());
+    std::size_t pos = 0;
+    while (pos < raw.size()) {
+        const std::size_t amp = raw.find('&', pos);
+        if (amp == std::string_view::npos) {
+            result.append(raw.substr(pos));
+            break;
+        }
+        result.append(raw.substr(pos, amp - pos));
+        const std::size_t semi = raw.find(';', amp);
+        if (semi == std::string_view::npos) {
+            result.append(raw.substr(amp));
+            break;
+        }
+
+        const std::string_view name = raw.substr(amp + 1, semi - amp - 1);
+        if (name == "amp") {
+            result += '&';
+        } else if (name == "lt") {
+            result += '<';
+        } else if (name == "gt") {
+            result += '>';
+        } else if (name == "quot") {
+            result += '"';
+        } else if (name == "apos") {
+            result += '\'';
+        } else if (name.size() > 1 && name.front() == '#') {
+            const bool hex = name[1] == 'x' || name[1] == 'X';
+            const std::string_view digits = name.substr(hex ? 2 : 1);
+            std::uint32_t codePoint = 0;
+            const auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), codePoint,
+                                                   hex ? 16 : 10);
+            if (ec == std::errc() && ptr == digits.data() + digits.size()) {
+                text::AppendUtf8(result, static_cast<char32_t>(codePoint));
+            }
+        } else {
+            result.append(name);
+        }
+        pos = semi + 1;
+    }
+    return result;
+}
+
+std::string_view Trim(std::string_view text) {
+    const auto begin = text.find_first_not_of(" \t\r\n");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    const auto end = text.find_last_not_of(" \t\r\n");
+    return text.substr(begin, end - begin + 1);
+}
+
+std::string_view AttributeValue(std::string_view attributes, std::string_view name) {
+    std::size_t pos = 0;
+    while ((pos = attributes.find(name, pos)) != std::string_view::npos) {
+        std::size_t cursor = pos + name.size();
+        const bool boundary = pos == 0 || attributes[pos - 1] == ' ' || attributes[pos - 1] == '\t' ||
+                              attributes[pos - 1] == '\n';
+        while (cursor < attributes.size() && attributes[cursor] == ' ') {
+            ++cursor;
+        }
+        if (boundary && cursor < attributes.size() && attributes[cursor] == '=') {
+            ++cursor;
+            while (cursor < attributes.size() && attributes[cursor] == ' ') {
+                ++cursor;
+            }
+            if (cursor < attributes.size() && (attributes[cursor] == '"' || attributes[cursor] == '\'')) {
+                const char quote = attributes[cursor];
+                const std::size_t end = attributes.find(quote, cursor + 1);
+                if (end != std::string_view::npos) {
+                    return attributes.substr(cursor + 1, end - cursor - 1);
+                }
+            }
+        }
+        pos += name.size();
+    }
+    return {};
+}
+
+/**
+ * @brief <entry> 하나를 채우는 상태
+ */
+class EntryState {
+public:
+    explicit EntryState(const JmdictParseOptions& options) : options_(options) {}
+
+    void Reset() {
+        entry_ = {};
+        sense_ = {};
+        inheritedPos_.clear();
+        inSense_ = false;
+    }
+
+    void BeginSense() {
+        sense_ = {};
+        inSense_ = true;
+    }
+
+    void EndSense() {
+        if (sense_.partsOfSpeech.empty()) {
+            sense_.partsOfSpeech = inheritedPos_;
+        } else {
+            inheritedPos_ = sense_.partsOfSpeech;
+        }
+        if (!sense_.glosses.empty()) {
+            entry_.senses.push_back(std::move(sense_));
+        }
+        sense_ = {};
+        inSense_ = false;
+    }
+
+    void OnElement(std::string_view name, std::string_view attributes, std::string value) {
+        if (name == "ent_seq") {
+            std::uint32_t sequence = 0;
+            std::from_chars(value.data(), value.data() + value.size(), sequence);
+            entry_.sequence = sequence;
+        } else if (name == "keb") {
+            entry_.kanji.push_back(std::move(value));
+        } else if (name == "reb") {
+            entry_.readings.push_back(std::move(value));
+        } else if (name == "ke_pri" || name == "re_pri") {
+            entry_.common = true;
+        } else if (name == "pos" && inSense_) {
+            sense_.partsOfSpeech.push_back(std::move(value));
+        } else if (name == "gloss" && inSense_) {
+            std::string_view lang = AttributeValue(attributes, "xml:lang");
+            if (lang.empty()) {
+                lang = "eng";
+            }
+            if (lang == options_.glossLanguage && !value.empty()) {
+                sense_.glosses.push_back(std::move(value));
+            }
+        }
+    }
+
+    DictionaryEntry&& Take() { return std::move(entry_); }
+
+private:
+    const JmdictParseOptions& options_;
+    DictionaryEntry entry_;
+    DictionarySense sense_;
+    std::vector<std::string> inheritedPos_;
+    bool inSense_ = false;
+};
+
+}  // namespace
+
+bool ParseJmdict(std::string_view xml,
+                 const std::function<void(DictionaryEntry&&)>& onEntry,
+                 const JmdictParseOptions& options,
+                 std::string* errorMessage) {
+    EntryState state(options);
+    bool inEntry = false;
+    std::string_view openName;
+    std::string_view openAttributes;
+    std::size_t textBegin = std::string_view::npos;
+
+    std::size_t pos = 0;
+    while ((pos = xml.find('<', pos)) != std::string_view::npos) {
+        // 주석, DOCTYPE(내부 엔티티 정의 포함), 처리 명령 건너뛰기
+        if (xml.compare(pos, 4, "<!--") == 0) {
+            const std::size_t end = xml.find("-->", pos + 4);
+            if (end == std::string_view::npos) {
+                SetError(errorMessage, "닫히지 않은 주석");
+                return false;
+            }
+            pos = end + 3;
+            continue;
+        }
+        if (xml.compare(pos, 2, "<?") == 0 || xml.compare(pos, 2, "<!") == 0) {
+            const std::size_t bracket = xml.find('[', pos);
+            const std::size_t close = xml.find('>', pos);
+            std::size_t end = close;
+            if (bracket != std::string_view::npos && bracket < close) {
+                end = xml.find("]>", bracket);
+                end = end == std::string_view::npos ? end : end + 1;
+            }
+            if (end == std::string_view::npos) {
+                SetError(errorMessage, "닫히지 않은 선언");
+                return false;
+            }
+            pos = end + 1;
+            continue;
+        }
+
+        const std::size_t close = xml.find('>', pos);
+        if (close == std::string_view::npos) {
+            SetError(errorMessage, "닫히지 않은 태그 (offset " + std::to_string(pos) + ")");
+            return false;
+        }
+        std::string_view tag = xml.substr(pos + 1, close - pos - 1);
+        const std::size_t tagStart = pos;
+        pos = close + 1;
+
+        if (!tag.empty() && tag.front() == '/') {
+            const std::string_view name = Trim(tag.substr(1));
+            if (name == "entry") {
+                if (inEntry) {
+                    onEntry(state.Take());
+                }
+                inEntry = false;
+            } else if (name == "sense") {
+                state.EndSense();
+            } else if (inEntry && name == openName && textBegin != std::string_view::npos) {
+                state.OnElement(name, openAttributes,
+                                DecodeText(Trim(xml.substr(textBegin, tagStart - textBegin))));
+            }
+            textBegin = std::string_view::npos;
+            continue;
+        }
+
+        const bool selfClosing = !tag.empty() && tag.back() == '/';
+        if (selfClosing) {
+            tag.remove_suffix(1);
+        }
+        const std::size_t nameEnd = tag.find_first_of(" \t\r\n");
+        const std::string_view name = tag.substr(0, nameEnd);
+        const std::string_view attributes = nameEnd == std::string_view::npos ? std::string_view() : tag.substr(nameEnd);
+
+        if (name == "entry") {
+            state.Reset();
+            inEntry = true;
+        } else if (name == "sense") {
+            state.BeginSense();
+        } else if (inEntry && !selfClosing) {
+            openName = name;
+            openAttributes = attributes;
+            textBegin = pos;
+            continue;
+        }
+        textBegin = std::string_view::npos;
+    }
+
+    if (inEntry) {
+        SetError(errorMessage, "닫히지 않은 <entry>");
+        return false;
+    }
+    return true;
+}
+
+bool ParseJmdict(std::istream& input,
+                 const std::function<void(DictionaryEntry&&)>& onEntry,
+                 const JmdictParseOptions& options,
+                 std::string* errorMessage) {
+    const std::string xml((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    if (input.bad()) {
+        SetError(errorMessage, "입력을 읽을 수 없습니다");
+        return false;
+    }
+    return ParseJmdict(xml, onEntry, options, errorMessage);
+}
+
+}  // namespace dictionary
+}  // namespace toriyomi
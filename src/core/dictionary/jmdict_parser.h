@@ -0,0 +1,51 @@
+// ToriYomi - JMdict XML 파서
+// 사전 컴파일러가 JMdict(JMdict_e 포함)를 DictionaryEntry로 읽어 들이는 데 사용
+
+#pragma once
+
+#include "dictionary_builder.h"
+#include <functional>
+#include <istream>
+#include <string>
+#include <string_view>
+
+namespace toriyomi {
+namespace dictionary {
+
+/**
+ * @brief JMdict 파싱 옵션
+ */
+struct JmdictParseOptions {
+    std::string glossLanguage = "eng";   // 남길 뜻풀이 언어 (xml:lang, 없으면 eng)
+};
+
+/**
+ * @brief JMdict XML 텍스트 파싱
+ *
+ * <entry>마다 한자 표기(keb), 읽기(reb), 우선순위(ke_pri/re_pri) 여부,
+ * 뜻(sense: pos + gloss)을 모아 onEntry를 호출합니다.
+ * 품사 등 JMdict 엔티티(&v1;)는 엔티티 이름("v1")으로 남기며,
+ * <pos>가 없는 sense는 JMdict 규칙대로 앞 sense의 품사를 이어받습니다.
+ * 선택한 언어의 뜻풀이가 없는 sense는 버립니다.
+ *
+ * @param xml JMdict XML 전체
+ * @param onEntry 엔트리마다 호출
+ * @param options 파싱 옵션
+ * @param errorMessage 실패 사유 (nullptr 허용)
+ * @return 형식 오류(닫히지 않은 태그 등)가 없으면 true
+ */
+bool ParseJmdict(std::string_view xml,
+                 const std::function<void(DictionaryEntry&&)>& onEntry,
+                 const JmdictParseOptions& options = {},
+                 std::string* errorMessage = nullptr);
+
+/**
+ * @brief 스트림 전체를 읽어 ParseJmdict 호출
+ */
+bool ParseJmdict(std::istream& input,
+                 const std::function<void(DictionaryEntry&&)>& onEntry,
+                 const JmdictParseOptions& options = {},
+                 std::string* errorMessage = nullptr);
+
+}  // namespace dictionary
+}  // namespace toriyomi
@@ -0,0 +1,57 @@
+#include "core/ocr/char_boxes.h"
+
+#include "core/ocr/ocr_engine.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace toriyomi {
+namespace ocr {
+
+std::vector<cv::Rect> CharBoxesFromRanges(const cv::Rect& lineBox,
+                                          const std::vector<std::pair<float, float>>& ranges) {
+    std::vector<cv::Rect> boxes;
+    if (ranges.empty() || lineBox.width <= 0 || lineBox.height <= 0) {
+        return boxes;
+    }
+
+    const size_t count = ranges.size();
+    std::vector<float> centers(count);
+    for (size_t i = 0; i < count; ++i) {
+        centers[i] = std::clamp((ranges[i].first + ranges[i].second) * 0.5f, 0.0f, 1.0f);
+        if (i > 0) {
+            centers[i] = std::max(centers[i], centers[i - 1]);
+        }
+    }
+
+    // 글자가 하나뿐이면 간격을 알 수 없으므로 줄 전체
+    const float pitch = count > 1 ? (centers.back() - centers.front()) / static_cast<float>(count - 1) : 1.0f;
+    std::vector<float> edges(count + 1);
+    edges.front() = count > 1 ? std::max(0.0f, centers.front() - pitch * 0.5f) : 0.0f;
+    edges.back() = count > 1 ? std::min(1.0f, centers.back() + pitch * 0.5f) : 1.0f;
+    for (size_t i = 1; i < count; ++i) {
+        edges[i] = (centers[i - 1] + centers[i]) * 0.5f;
+    }
+
+    const bool vertical = IsVerticalTextBox(lineBox);
+    const int origin = vertical ? lineBox.y : lineBox.x;
+    const int length = vertical ? lineBox.height : lineBox.width;
+    auto toPixel = [&](float fraction) {
+        return origin + static_cast<int>(std::lround(fraction * static_cast<float>(length)));
+    };
+
+    boxes.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const int begin = toPixel(edges[i]);
+        const int extent = std::max(1, toPixel(edges[i + 1]) - begin);
+        if (vertical) {
+            boxes.emplace_back(lineBox.x, begin, lineBox.width, extent);
+        } else {
+            boxes.emplace_back(begin, lineBox.y, extent, lineBox.height);
+        }
+    }
+    return boxes;
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
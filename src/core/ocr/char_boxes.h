@@ -0,0 +1,27 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <utility>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 인식 결과의 글자 구간을 화면 좌표 글자 영역으로 변환
+ *
+ * ranges는 CTC 디코딩에서 각 글자가 출력된 timestep 구간을
+ * 텍스트 줄 길이에 대한 비율([begin, end), 0.0 ~ 1.0)로 나타낸 것입니다.
+ * CTC 구간은 글자의 일부만 덮으므로 구간 중심 사이의 중점을 경계로 삼아
+ * 줄을 빈틈없이 나누고, 양 끝은 평균 글자 간격의 절반만큼 넓힙니다.
+ * 세로 줄(IsVerticalTextBox)은 위에서 아래로 나눕니다.
+ *
+ * @param lineBox 텍스트 줄 영역 (화면 좌표)
+ * @param ranges 글자별 구간 (읽기 순서)
+ * @return 글자별 영역 (ranges가 비어 있거나 lineBox가 비어 있으면 빈 목록)
+ */
+std::vector<cv::Rect> CharBoxesFromRanges(const cv::Rect& lineBox,
+                                          const std::vector<std::pair<float, float>>& ranges);
+
+}  // namespace ocr
+}  // namespace toriyomi
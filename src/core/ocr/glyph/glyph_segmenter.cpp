@@ -0,0 +1,162 @@
+#include "core/ocr/glyph/glyph_segmenter.h"
+
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <utility>
+
+namespace toriyomi {
+namespace ocr {
+
+namespace {
+// 축소 후 잉크 비율이 이 값(/255) 이상이면 잉크 비트로 취급 (얇은 획 보존)
+constexpr int kInkCoverageThreshold = 64;
+
+std::vector<std::pair<int, int>> FindInkRuns(const cv::Mat& projection) {
+    std::vector<std::pair<int, int>> runs;
+    const int length = static_cast<int>(projection.total());
+    const int* values = projection.ptr<int>();
+    int start = -1;
+    for (int i = 0; i < length; ++i) {
+        if (values[i] > 0) {
+            if (start < 0) {
+                start = i;
+            }
+        } else if (start >= 0) {
+            runs.emplace_back(start, i);
+            start = -1;
+        }
+    }
+    if (start >= 0) {
+        runs.emplace_back(start, length);
+    }
+    return runs;
+}
+}  // namespace
+
+int HammingDistance(const GlyphBitmap& lhs, const GlyphBitmap& rhs) {
+    int distance = 0;
+    for (int i = 0; i < kGlyphWords; ++i) {
+        distance += std::popcount(lhs.words[i] ^ rhs.words[i]);
+    }
+    return distance;
+}
+
+cv::Mat BinarizeForGlyphs(const cv::Mat& image) {
+    if (image.empty()) {
+        return {};
+    }
+
+    cv::Mat gray;
+    if (image.channels() == 3) {
+        cv::cvtColor(image, gray, cv::COLOR_BGR2GRAY);
+    } else if (image.channels() == 4) {
+        cv::cvtColor(image, gray, cv::COLOR_BGRA2GRAY);
+    } else {
+        gray = image;
+    }
+    if (gray.depth() != CV_8U) {
+        gray.convertTo(gray, CV_8U);
+    }
+
+    cv::Mat binary;
+    cv::threshold(gray, binary, 0, 255, cv::THRESH_BINARY | cv::THRESH_OTSU);
+    if (static_cast<std::size_t>(cv::countNonZero(binary)) * 2 > binary.total()) {
+        cv::bitwise_not(binary, binary);
+    }
+    return binary;
+}
+
+std::vector<cv::Rect> FindTextLines(const cv::Mat& binary, int minLineHeight) {
+    std::vector<cv::Rect> lines;
+    if (binary.empty()) {
+        return lines;
+    }
+
+    cv::Mat rowInk;
+    cv::reduce(binary, rowInk, 1, cv::REDUCE_SUM, CV_32S);
+    for (const auto& [top, bottom] : FindInkRuns(rowInk)) {
+        const int height = bottom - top;
+        if (height < minLineHeight) {
+            continue;
+        }
+
+        cv::Mat colInk;
+        cv::reduce(binary(cv::Rect(0, top, binary.cols, height)), colInk, 0, cv::REDUCE_SUM, CV_32S);
+        const auto columns = FindInkRuns(colInk);
+        if (columns.empty()) {
+            continue;
+        }
+        const int left = columns.front().first;
+        const int right = columns.back().second;
+        lines.emplace_back(left, top, right - left, height);
+    }
+    return lines;
+}
+
+std::vector<cv::Rect> SegmentGlyphCells(const cv::Mat& binary,
+                                        const cv::Rect& line,
+                                        float mergeRatio) {
+    std::vector<cv::Rect> cells;
+    const cv::Rect clipped = line & cv::Rect(0, 0, binary.cols, binary.rows);
+    if (clipped.empty()) {
+        return cells;
+    }
+
+    cv::Mat colInk;
+    cv::reduce(binary(clipped), colInk, 0, cv::REDUCE_SUM, CV_32S);
+    const auto runs = FindInkRuns(colInk);
+    if (runs.empty()) {
+        return cells;
+    }
+
+    const int maxCellWidth = std::max(1, static_cast<int>(std::lround(clipped.height * mergeRatio)));
+    auto flush = [&](const std::pair<int, int>& run) {
+        cells.emplace_back(clipped.x + run.first, clipped.y, run.second - run.first, clipped.height);
+    };
+
+    std::pair<int, int> current = runs.front();
+    for (std::size_t i = 1; i < runs.size(); ++i) {
+        if (runs[i].second - current.first <= maxCellWidth) {
+            current.second = runs[i].second;
+        } else {
+            flush(current);
+            current = runs[i];
+        }
+    }
+    flush(current);
+    return cells;
+}
+
+GlyphBitmap ExtractGlyphBitmap(const cv::Mat& binary, const cv::Rect& cell) {
+    GlyphBitmap glyph;
+    const cv::Rect clipped = cell & cv::Rect(0, 0, binary.cols, binary.rows);
+    if (clipped.empty()) {
+        return glyph;
+    }
+
+    const int side = std::max(clipped.width, clipped.height);
+    cv::Mat canvas = cv::Mat::zeros(side, side, CV_8U);
+    binary(clipped).copyTo(canvas(cv::Rect((side - clipped.width) / 2,
+                                           (side - clipped.height) / 2,
+                                           clipped.width,
+                                           clipped.height)));
+
+    cv::Mat small;
+    cv::resize(canvas, small, cv::Size(kGlyphSide, kGlyphSide), 0.0, 0.0, cv::INTER_AREA);
+    for (int y = 0; y < kGlyphSide; ++y) {
+        const uchar* row = small.ptr<uchar>(y);
+        for (int x = 0; x < kGlyphSide; ++x) {
+            if (row[x] >= kInkCoverageThreshold) {
+                const int bit = y * kGlyphSide + x;
+                glyph.words[bit / 64] |= (std::uint64_t{1} << (bit % 64));
+                ++glyph.inkCount;
+            }
+        }
+    }
+    return glyph;
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+constexpr int kGlyphSide = 24;                                      // 글리프 비트맵 한 변 (px)
+constexpr int kGlyphBits = kGlyphSide * kGlyphSide;                 // 576비트
+constexpr int kGlyphWords = (kGlyphBits + 63) / 64;                 // uint64 9개
+
+/**
+ * @brief 정규화된 24x24 이진 글리프 (1 = 잉크)
+ */
+struct GlyphBitmap {
+    std::array<std::uint64_t, kGlyphWords> words{};
+    int inkCount = 0;    // 설정된 비트 수 (해밍 거리 하한 계산용)
+};
+
+/**
+ * @brief 두 글리프 사이의 해밍 거리
+ */
+int HammingDistance(const GlyphBitmap& lhs, const GlyphBitmap& rhs);
+
+/**
+ * @brief Otsu 이진화 (잉크 = 255)
+ *
+ * 배경보다 적은 쪽 픽셀을 잉크로 보므로 흰 바탕/어두운 바탕 모두 처리합니다.
+ */
+cv::Mat BinarizeForGlyphs(const cv::Mat& image);
+
+/**
+ * @brief 가로 투영으로 텍스트 라인 찾기 (가로쓰기 전용)
+ *
+ * @param binary BinarizeForGlyphs() 결과
+ * @param minLineHeight 이보다 낮은 행 묶음은 노이즈로 무시
+ * @return 잉크 범위로 잘린 라인 영역 (위에서 아래 순서)
+ */
+std::vector<cv::Rect> FindTextLines(const cv::Mat& binary, int minLineHeight);
+
+/**
+ * @brief 세로 투영으로 라인을 글자 셀로 분할
+ *
+ * 「い」「川」처럼 획 사이가 떨어진 글자는 셀 폭이 라인 높이 * mergeRatio를
+ * 넘지 않는 범위에서 이웃 조각과 합칩니다. 셀 높이는 라인 높이와 같습니다.
+ */
+std::vector<cv::Rect> SegmentGlyphCells(const cv::Mat& binary,
+                                        const cv::Rect& line,
+                                        float mergeRatio);
+
+/**
+ * @brief 셀을 정사각형 캔버스 중앙에 놓고 24x24 비트맵으로 축소
+ *
+ * 캔버스 한 변은 max(셀 폭, 셀 높이)이므로 글자의 종횡비가 유지됩니다.
+ */
+GlyphBitmap ExtractGlyphBitmap(const cv::Mat& binary, const cv::Rect& cell);
+
+}  // namespace ocr
+}  // namespace toriyomi
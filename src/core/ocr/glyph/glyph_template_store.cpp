@@ -0,0 +1,72 @@
+#include "core/ocr/glyph/glyph_template_store.h"
+
+#include <algorithm>
+
+namespace toriyomi {
+namespace ocr {
+
+GlyphTemplateStore::GlyphTemplateStore(std::size_t maxTemplatesPerGlyph)
+    : maxTemplatesPerGlyph_(std::max<std::size_t>(1, maxTemplatesPerGlyph)) {
+}
+
+GlyphMatch GlyphTemplateStore::Match(const GlyphBitmap& glyph, int searchRadius) const {
+    GlyphMatch match;
+    const auto byInk = [](const Entry& entry, int ink) { return entry.glyph.inkCount < ink; };
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), glyph.inkCount - searchRadius, byInk);
+
+    for (; it != entries_.end() && it->glyph.inkCount <= glyph.inkCount + searchRadius; ++it) {
+        const int distance = HammingDistance(glyph, it->glyph);
+        if (distance > searchRadius) {
+            continue;
+        }
+
+        if (match.distance < 0 || distance < match.distance) {
+            if (match.distance >= 0 && it->text != match.text) {
+                match.runnerUpDistance = match.distance;
+            }
+            match.text = it->text;
+            match.distance = distance;
+        } else if (it->text != match.text &&
+                   (match.runnerUpDistance < 0 || distance < match.runnerUpDistance)) {
+            match.runnerUpDistance = distance;
+        }
+    }
+    return match;
+}
+
+bool GlyphTemplateStore::Add(const GlyphBitmap& glyph, const std::string& text, int dedupDistance) {
+    if (text.empty() || glyph.inkCount == 0) {
+        return false;
+    }
+
+    const auto byInk = [](const Entry& entry, int ink) { return entry.glyph.inkCount < ink; };
+    for (auto it = std::lower_bound(entries_.begin(), entries_.end(), glyph.inkCount - dedupDistance, byInk);
+         it != entries_.end() && it->glyph.inkCount <= glyph.inkCount + dedupDistance;
+         ++it) {
+        if (it->text == text && HammingDistance(glyph, it->glyph) <= dedupDistance) {
+            return false;
+        }
+    }
+
+    auto& count = countsByText_[text];
+    if (count >= maxTemplatesPerGlyph_) {
+        return false;
+    }
+    ++count;
+
+    auto position = std::lower_bound(entries_.begin(), entries_.end(), glyph.inkCount, byInk);
+    entries_.insert(position, Entry{glyph, text});
+    return true;
+}
+
+std::size_t GlyphTemplateStore::Size() const {
+    return entries_.size();
+}
+
+void GlyphTemplateStore::Clear() {
+    entries_.clear();
+    countsByText_.clear();
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "core/ocr/glyph/glyph_segmenter.h"
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 템플릿 검색 결과
+ */
+struct GlyphMatch {
+    std::string text;            // 가장 가까운 템플릿의 글자 (없으면 빈 문자열)
+    int distance = -1;           // 최근접 거리 (-1 = 검색 반경 안에 없음)
+    int runnerUpDistance = -1;   // 다른 글자 중 최근접 거리 (-1 = 검색 반경 안에 없음)
+};
+
+/**
+ * @brief 글자별 이진 템플릿 저장소
+ *
+ * 템플릿을 잉크 비트 수 순으로 정렬해 두고, |ink(a) - ink(b)| <= 해밍 거리라는
+ * 하한을 이용해 검색 반경 밖의 후보를 이분 탐색으로 건너뜁니다.
+ */
+class GlyphTemplateStore {
+public:
+    explicit GlyphTemplateStore(std::size_t maxTemplatesPerGlyph = 4);
+
+    /**
+     * @brief 검색 반경 이내에서 최근접/차순위(다른 글자) 템플릿 찾기
+     */
+    GlyphMatch Match(const GlyphBitmap& glyph, int searchRadius) const;
+
+    /**
+     * @brief 템플릿 추가
+     *
+     * 같은 글자의 거의 같은 템플릿(dedupDistance 이하)이 있으면 추가하지 않습니다.
+     * 다른 글자와 비슷한 템플릿은 그대로 추가하여, 매칭 시 마진 검사에서
+     * 두 글자가 함께 걸리도록(= 폴백되도록) 합니다.
+     *
+     * @return 실제로 추가되었는지 여부
+     */
+    bool Add(const GlyphBitmap& glyph, const std::string& text, int dedupDistance);
+
+    std::size_t Size() const;
+    void Clear();
+
+private:
+    struct Entry {
+        GlyphBitmap glyph;
+        std::string text;
+    };
+
+    std::size_t maxTemplatesPerGlyph_;
+    std::vector<Entry> entries_;    // inkCount 오름차순
+    std::unordered_map<std::string, std::size_t> countsByText_;
+};
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,230 @@
+#include "glyph_cache_ocr_engine.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <utility>
+
+namespace toriyomi {
+namespace ocr {
+
+namespace {
+
+// UTF-8 문자열을 코드포인트 단위로 분할 (공백 제외)
+std::vector<std::string> SplitGlyphs(const std::string& text) {
+    std::vector<std::string> glyphs;
+    std::size_t i = 0;
+    while (i < text.size()) {
+        const unsigned char lead = static_cast<unsigned char>(text[i]);
+        std::size_t length = 1;
+        if (lead >= 0xF0) {
+            length = 4;
+        } else if (lead >= 0xE0) {
+            length = 3;
+        } else if (lead >= 0xC0) {
+            length = 2;
+        }
+        length = std::min(length, text.size() - i);
+
+        std::string glyph = text.substr(i, length);
+        i += length;
+        if (glyph == " " || glyph == "\t" || glyph == "　") {
+            continue;
+        }
+        glyphs.push_back(std::move(glyph));
+    }
+    return glyphs;
+}
+
+// 루비처럼 낮은 라인 제거
+std::vector<cv::Rect> KeepBodyLines(std::vector<cv::Rect> lines, float minHeightRatio) {
+    int tallest = 0;
+    for (const auto& line : lines) {
+        tallest = std::max(tallest, line.height);
+    }
+    const float minHeight = tallest * minHeightRatio;
+    lines.erase(std::remove_if(lines.begin(), lines.end(),
+                               [minHeight](const cv::Rect& line) { return line.height < minHeight; }),
+                lines.end());
+    return lines;
+}
+
+}  // namespace
+
+GlyphCacheOcrEngine::GlyphCacheOcrEngine(std::shared_ptr<IOcrEngine> inner, GlyphCacheConfig config)
+    : inner_(std::move(inner)),
+      config_(config),
+      store_(config.maxTemplatesPerGlyph) {
+}
+
+GlyphCacheOcrEngine::~GlyphCacheOcrEngine() = default;
+
+bool GlyphCacheOcrEngine::Initialize(const std::string& configPath, const std::string& language) {
+    return inner_ && inner_->Initialize(configPath, language);
+}
+
+std::vector<TextSegment> GlyphCacheOcrEngine::RecognizeText(const cv::Mat& image) {
+    if (!inner_ || image.empty()) {
+        return {};
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TextSegment> cached;
+        if (TryRecognizeFromCacheLocked(image, cached)) {
+            ++stats_.cacheHits;
+            return cached;
+        }
+        ++stats_.fallbacks;
+    }
+
+    auto segments = inner_->RecognizeText(image);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    LearnLocked(image, segments);
+    return segments;
+}
+
+void GlyphCacheOcrEngine::Shutdown() {
+    if (inner_) {
+        inner_->Shutdown();
+    }
+    ClearTemplates();
+}
+
+bool GlyphCacheOcrEngine::IsInitialized() const {
+    return inner_ && inner_->IsInitialized();
+}
+
+std::string GlyphCacheOcrEngine::GetEngineName() const {
+    return inner_ ? inner_->GetEngineName() : std::string("GlyphCache");
+}
+
+void GlyphCacheOcrEngine::OnRegionChanged() {
+    if (inner_) {
+        inner_->OnRegionChanged();
+    }
+    // 폰트는 그대로이므로 템플릿은 유지하고 백오프만 해제
+    std::lock_guard<std::mutex> lock(mutex_);
+    consecutiveMisses_ = 0;
+    backoffRemaining_ = 0;
+}
+
+void GlyphCacheOcrEngine::ClearTemplates() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    store_.Clear();
+    consecutiveMisses_ = 0;
+    backoffRemaining_ = 0;
+}
+
+GlyphCacheStats GlyphCacheOcrEngine::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    GlyphCacheStats stats = stats_;
+    stats.templateCount = store_.Size();
+    return stats;
+}
+
+const std::shared_ptr<IOcrEngine>& GlyphCacheOcrEngine::GetInnerEngine() const {
+    return inner_;
+}
+
+bool GlyphCacheOcrEngine::TryRecognizeFromCacheLocked(const cv::Mat& image, std::vector<TextSegment>& segments) {
+    if (!config_.enabled || store_.Size() < config_.minTemplates) {
+        return false;
+    }
+    if (backoffRemaining_ > 0) {
+        --backoffRemaining_;
+        return false;
+    }
+
+    const cv::Mat binary = BinarizeForGlyphs(image);
+    const auto lines = KeepBodyLines(FindTextLines(binary, config_.minLineHeight), config_.minLineHeightRatio);
+    if (lines.empty()) {
+        RecordMissLocked();
+        return false;
+    }
+
+    const int searchRadius = config_.acceptDistance + config_.minMargin;
+    segments.clear();
+    segments.reserve(lines.size());
+    for (const auto& line : lines) {
+        const auto cells = SegmentGlyphCells(binary, line, config_.cellMergeRatio);
+        if (cells.empty()) {
+            continue;
+        }
+
+        TextSegment segment;
+        int worstDistance = 0;
+        for (const auto& cell : cells) {
+            const GlyphMatch match = store_.Match(ExtractGlyphBitmap(binary, cell), searchRadius);
+            const bool accepted = match.distance >= 0 &&
+                                  match.distance <= config_.acceptDistance &&
+                                  (match.runnerUpDistance < 0 ||
+                                   match.runnerUpDistance - match.distance >= config_.minMargin);
+            if (!accepted) {
+                RecordMissLocked();
+                return false;
+            }
+            segment.text += match.text;
+            segment.charBoxes.push_back(cell);
+            segment.boundingBox = segment.boundingBox.area() > 0 ? (segment.boundingBox | cell) : cell;
+            worstDistance = std::max(worstDistance, match.distance);
+        }
+
+        segment.confidence = 100.0f * (1.0f - static_cast<float>(worstDistance) / kGlyphBits);
+        segments.push_back(std::move(segment));
+    }
+
+    consecutiveMisses_ = 0;
+    return true;
+}
+
+void GlyphCacheOcrEngine::LearnLocked(const cv::Mat& image, const std::vector<TextSegment>& segments) {
+    if (!config_.enabled) {
+        return;
+    }
+
+    const cv::Rect bounds(0, 0, image.cols, image.rows);
+    for (const auto& segment : segments) {
+        if (segment.confidence < config_.learnConfidence) {
+            continue;
+        }
+        const cv::Rect roi = segment.boundingBox & bounds;
+        if (roi.empty()) {
+            continue;
+        }
+
+        const cv::Mat binary = BinarizeForGlyphs(image(roi));
+        const auto lines = KeepBodyLines(FindTextLines(binary, config_.minLineHeight), config_.minLineHeightRatio);
+        if (lines.size() != 1) {
+            ++stats_.skippedLines;
+            continue;
+        }
+
+        const auto cells = SegmentGlyphCells(binary, lines.front(), config_.cellMergeRatio);
+        const auto glyphs = SplitGlyphs(segment.text);
+        if (cells.empty() || cells.size() != glyphs.size()) {
+            ++stats_.skippedLines;
+            continue;
+        }
+
+        for (std::size_t i = 0; i < cells.size(); ++i) {
+            store_.Add(ExtractGlyphBitmap(binary, cells[i]), glyphs[i], config_.acceptDistance / 4);
+        }
+        ++stats_.learnedLines;
+    }
+
+    if (stats_.learnedLines > 0 && stats_.learnedLines % 100 == 0) {
+        SPDLOG_DEBUG("Glyph cache: {} templates, {} hits / {} fallbacks",
+                     store_.Size(), stats_.cacheHits, stats_.fallbacks);
+    }
+}
+
+void GlyphCacheOcrEngine::RecordMissLocked() {
+    if (++consecutiveMisses_ >= config_.missesBeforeBackoff) {
+        consecutiveMisses_ = 0;
+        backoffRemaining_ = config_.backoffFrames;
+    }
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
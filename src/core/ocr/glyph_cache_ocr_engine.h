@@ -0,0 +1,89 @@
+#pragma once
+
+#include "core/ocr/glyph/glyph_template_store.h"
+#include "ocr_engine.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 글리프 캐시 설정
+ *
+ * 거리 값은 24x24(576비트) 비트맵 기준 해밍 거리입니다.
+ */
+struct GlyphCacheConfig {
+    bool enabled = false;
+    float learnConfidence = 90.0f;          // 이 신뢰도 이상인 결과만 학습 (0.0 ~ 100.0)
+    int acceptDistance = 40;                // 셀을 채택할 최대 거리
+    int minMargin = 24;                     // 다른 글자 템플릿과의 최소 거리 차
+    std::size_t maxTemplatesPerGlyph = 4;   // 글자당 보관할 변형 수
+    std::size_t minTemplates = 64;          // 이만큼 학습되기 전에는 캐시 경로를 시도하지 않음
+    int minLineHeight = 8;                  // 이보다 낮은 행 묶음은 노이즈
+    float minLineHeightRatio = 0.6f;        // 가장 높은 라인 대비 이보다 낮은 라인(루비)은 무시
+    float cellMergeRatio = 1.1f;            // 셀 최대 폭 = 라인 높이 * 비율
+    int missesBeforeBackoff = 3;            // 연속 실패 횟수가 이만큼 되면
+    int backoffFrames = 30;                 // 이 프레임 수 동안 캐시 경로를 건너뜀
+};
+
+/**
+ * @brief 글리프 캐시 통계
+ */
+struct GlyphCacheStats {
+    std::uint64_t cacheHits = 0;       // 래핑된 엔진 없이 처리한 프레임
+    std::uint64_t fallbacks = 0;       // 래핑된 엔진으로 넘긴 프레임
+    std::uint64_t learnedLines = 0;    // 템플릿 학습에 사용된 라인
+    std::uint64_t skippedLines = 0;    // 셀 수와 글자 수가 달라 학습하지 못한 라인
+    std::size_t templateCount = 0;
+};
+
+/**
+ * @brief 고정 폰트용 글리프 캐시를 앞단에 둔 IOcrEngine 데코레이터
+ *
+ * 래핑된 엔진(PaddleOCR 등)의 고신뢰도 결과를 글자 셀로 분할해 이진 템플릿을 학습하고,
+ * 이후 프레임은 이진화 + 투영 분할 + 해밍 거리 매칭만으로 인식합니다.
+ * 셀 하나라도 애매하면 프레임 전체를 래핑된 엔진으로 넘깁니다.
+ * 현재는 가로쓰기 라인만 캐시 경로로 처리합니다.
+ */
+class GlyphCacheOcrEngine : public IOcrEngine {
+public:
+    GlyphCacheOcrEngine(std::shared_ptr<IOcrEngine> inner, GlyphCacheConfig config = {});
+    ~GlyphCacheOcrEngine() override;
+
+    bool Initialize(const std::string& configPath, const std::string& language = "jpn") override;
+    std::vector<TextSegment> RecognizeText(const cv::Mat& image) override;
+    void Shutdown() override;
+    bool IsInitialized() const override;
+    std::string GetEngineName() const override;
+    void OnRegionChanged() override;
+
+    /**
+     * @brief 학습한 템플릿 삭제 (게임/폰트 변경 시)
+     */
+    void ClearTemplates();
+
+    GlyphCacheStats GetStats() const;
+    const std::shared_ptr<IOcrEngine>& GetInnerEngine() const;
+
+private:
+    bool TryRecognizeFromCacheLocked(const cv::Mat& image, std::vector<TextSegment>& segments);
+    void LearnLocked(const cv::Mat& image, const std::vector<TextSegment>& segments);
+    void RecordMissLocked();
+
+    std::shared_ptr<IOcrEngine> inner_;
+    GlyphCacheConfig config_;
+
+    mutable std::mutex mutex_;
+    GlyphTemplateStore store_;
+    GlyphCacheStats stats_;
+    int consecutiveMisses_ = 0;
+    int backoffRemaining_ = 0;
+};
+
+}  // namespace ocr
+}  // namespace toriyomi
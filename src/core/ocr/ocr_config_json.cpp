@@ -0,0 +1,96 @@
+#include "core/ocr/ocr_config_json.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+std::filesystem::path ResolveConfigRelativePath(const std::filesystem::path& configPath,
+                                                const std::string& value) {
+    const std::filesystem::path path(value);
+    if (path.empty() || path.is_absolute()) {
+        return path;
+    }
+    return (configPath.parent_path() / path).lexically_normal();
+}
+
+bool ReadTextBoxFilterConfig(const nlohmann::json& doc,
+                             TextBoxFilterConfig& config,
+                             std::string& errorMessage) {
+    if (doc.contains("box_filter_enabled")) {
+        config.enabled = doc["box_filter_enabled"].get<bool>();
+    }
+    if (doc.contains("box_filter_min_area")) {
+        config.minArea = std::max(0, doc["box_filter_min_area"].get<int>());
+    }
+    if (doc.contains("box_filter_min_height")) {
+        config.minHeight = std::max(0, doc["box_filter_min_height"].get<int>());
+    }
+    if (doc.contains("box_filter_max_aspect")) {
+        config.maxAspectRatio = doc["box_filter_max_aspect"].get<float>();
+    }
+    if (doc.contains("box_filter_roi")) {
+        const auto roi = doc["box_filter_roi"].get<std::vector<float>>();
+        if (roi.size() != 4) {
+            errorMessage = "box_filter_roi must be [x, y, width, height] in normalized coordinates";
+            return false;
+        }
+        config.roiX = roi[0];
+        config.roiY = roi[1];
+        config.roiWidth = roi[2];
+        config.roiHeight = roi[3];
+    }
+    if (doc.contains("box_filter_min_roi_overlap")) {
+        config.minRoiOverlap = doc["box_filter_min_roi_overlap"].get<float>();
+    }
+    if (doc.contains("box_filter_drop_ruby")) {
+        config.dropRuby = doc["box_filter_drop_ruby"].get<bool>();
+    }
+    if (doc.contains("box_filter_ruby_height_ratio")) {
+        config.rubyHeightRatio = doc["box_filter_ruby_height_ratio"].get<float>();
+    }
+    return true;
+}
+
+void ReadGlyphCacheConfig(const nlohmann::json& doc, GlyphCacheConfig& config) {
+    if (doc.contains("glyph_cache_enabled")) {
+        config.enabled = doc["glyph_cache_enabled"].get<bool>();
+    }
+    if (doc.contains("glyph_cache_learn_confidence")) {
+        config.learnConfidence = doc["glyph_cache_learn_confidence"].get<float>();
+    }
+    if (doc.contains("glyph_cache_accept_distance")) {
+        config.acceptDistance = std::max(0, doc["glyph_cache_accept_distance"].get<int>());
+    }
+    if (doc.contains("glyph_cache_min_margin")) {
+        config.minMargin = std::max(0, doc["glyph_cache_min_margin"].get<int>());
+    }
+    if (doc.contains("glyph_cache_min_templates")) {
+        config.minTemplates = doc["glyph_cache_min_templates"].get<std::size_t>();
+    }
+    if (doc.contains("glyph_cache_backoff_frames")) {
+        config.backoffFrames = std::max(0, doc["glyph_cache_backoff_frames"].get<int>());
+    }
+}
+
+void ReadTiledDetectionConfig(const nlohmann::json& doc, TiledDetectionConfig& config) {
+    if (doc.contains("det_tiling_enabled")) {
+        config.enabled = doc["det_tiling_enabled"].get<bool>();
+    }
+    if (doc.contains("det_tiling_tile_size")) {
+        config.tileSize = std::max(64, doc["det_tiling_tile_size"].get<int>());
+    }
+    if (doc.contains("det_tiling_overlap")) {
+        config.overlap = std::max(0, doc["det_tiling_overlap"].get<int>());
+    }
+    if (doc.contains("det_tiling_min_frame_side")) {
+        config.minFrameSide = std::max(0, doc["det_tiling_min_frame_side"].get<int>());
+    }
+    if (doc.contains("det_batch_size")) {
+        config.detBatchSize = std::max(1, doc["det_batch_size"].get<int>());
+    }
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
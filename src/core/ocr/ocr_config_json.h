@@ -0,0 +1,46 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "core/ocr/glyph_cache_ocr_engine.h"
+#include "core/ocr/text_box_filter.h"
+#include "core/ocr/tiled_detection.h"
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 설정 JSON에 적힌 모델/사전 경로를 JSON 파일 위치 기준으로 해석
+ *
+ * 상대 경로는 작업 디렉터리가 아니라 JSON 파일이 있는 디렉터리 기준입니다.
+ * 빈 값과 절대 경로는 그대로 반환합니다.
+ */
+std::filesystem::path ResolveConfigRelativePath(const std::filesystem::path& configPath,
+                                                const std::string& value);
+
+/**
+ * @brief OCR 설정 JSON의 box_filter_* 키를 읽어 필터 설정에 반영
+ *
+ * Paddle/ONNX 백엔드가 같은 paddle_ocr.json을 공유하므로 공통으로 사용합니다.
+ *
+ * @return 값이 잘못된 경우 false (errorMessage 설정)
+ */
+bool ReadTextBoxFilterConfig(const nlohmann::json& doc,
+                             TextBoxFilterConfig& config,
+                             std::string& errorMessage);
+
+/**
+ * @brief OCR 설정 JSON의 glyph_cache_* 키를 읽어 글리프 캐시 설정에 반영
+ */
+void ReadGlyphCacheConfig(const nlohmann::json& doc, GlyphCacheConfig& config);
+
+/**
+ * @brief OCR 설정 JSON의 det_tiling_* / det_batch_size 키를 읽어 타일 검출 설정에 반영
+ */
+void ReadTiledDetectionConfig(const nlohmann::json& doc, TiledDetectionConfig& config);
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -2,6 +2,7 @@
 // 런타임에 다른 OCR 엔진을 생성
 
 #include "ocr_engine.h"
+#include "onnx_ocr_engine.h"
 #include "paddle_ocr_wrapper.h"
 
 namespace toriyomi {
@@ -16,6 +17,9 @@ std::unique_ptr<IOcrEngine> OcrEngineFactory::CreateEngine(OcrEngineType type) {
             // TODO: EasyOCR 구현 시 추가
             return nullptr;
 
+        case OcrEngineType::OnnxRuntime:
+            return std::make_unique<OnnxOcrEngine>();
+
         default:
             return nullptr;
     }
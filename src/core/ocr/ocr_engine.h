@@ -1,6 +1,8 @@
 #pragma once
 
 #include <opencv2/core.hpp>
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -15,8 +17,25 @@ struct TextSegment {
     std::string text;        // 인식된 텍스트 (UTF-8)
     cv::Rect boundingBox;    // 텍스트 영역 좌표 (x, y, width, height)
     float confidence;        // 인식 신뢰도 (0.0 ~ 100.0)
+    std::vector<cv::Rect> charBoxes;  // 글자(코드포인트)별 영역, 엔진이 제공하지 않으면 비어 있음
 };
 
+/**
+ * @brief 한 프레임의 OCR 결과
+ */
+struct OcrResult {
+    uint64_t sequence = 0;                                  // 1부터 프레임마다 1씩 증가
+    std::vector<TextSegment> segments;
+    std::chrono::steady_clock::time_point completedAt{};   // 인식을 마친 시각
+};
+
+/**
+ * @brief 세로쓰기 줄 판정 (인식 크롭을 90도 회전하는 기준과 동일한 세로/가로 1.5배)
+ */
+inline bool IsVerticalTextBox(const cv::Rect& box) {
+    return box.width > 0 && box.height >= box.width * 1.5;
+}
+
 /**
  * @brief OCR 엔진 추상 인터페이스
  * 
@@ -62,6 +81,14 @@ public:
     * @return 엔진 이름 (예: "PaddleOCR")
      */
     virtual std::string GetEngineName() const = 0;
+
+    /**
+     * @brief 인식 대상 영역(ROI)이 바뀌었음을 알림
+     * 
+     * ROI 단위로 캐시한 상태(방향 분류 결과 등)를 초기화하는 데 사용합니다.
+     * OCR 스레드에서 RecognizeText() 호출 전에 호출됩니다.
+     */
+    virtual void OnRegionChanged() {}
 };
 
 /**
@@ -69,7 +96,8 @@ public:
  */
 enum class OcrEngineType {
     PaddleOCR,    // PaddleOCR (기본 엔진)
-    EasyOCR       // EasyOCR (미래 구현)
+    EasyOCR,      // EasyOCR (미래 구현)
+    OnnxRuntime   // PP-OCRv5 ONNX 모델 + ONNX Runtime CPU
 };
 
 /**
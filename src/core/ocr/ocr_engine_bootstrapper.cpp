@@ -4,10 +4,17 @@
 #pragma execution_character_set("utf-8")
 #endif
 
+#include "core/ocr/ocr_config_json.h"
+#include "onnx_ocr_engine.h"
 #include "paddle_ocr_wrapper.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cctype>
+#include <fstream>
 #include <utility>
 
+#include <nlohmann/json.hpp>
+
 namespace toriyomi {
 namespace ocr {
 namespace {
@@ -18,15 +25,71 @@ const char* ToString(OcrEngineType type) {
             return "PaddleOCR";
         case OcrEngineType::EasyOCR:
             return "EasyOCR";
+        case OcrEngineType::OnnxRuntime:
+            return "ONNX Runtime";
         default:
             return "Unknown";
     }
 }
 
+std::optional<nlohmann::json> LoadConfigDocument(const std::string& configPath) {
+    std::ifstream stream(configPath);
+    if (!stream) {
+        return std::nullopt;
+    }
+    try {
+        nlohmann::json doc;
+        stream >> doc;
+        return doc;
+    } catch (const std::exception& ex) {
+        SPDLOG_WARN("Failed to read OCR config {}: {}", configPath, ex.what());
+    }
+    return std::nullopt;
+}
+
 }  // namespace
 
 OcrEngineBootstrapper::OcrEngineBootstrapper(OcrBootstrapConfig config)
-    : config_(std::move(config)) {}
+    : config_(std::move(config)) {
+    if (config_.paddleConfigPath.empty()) {
+        return;
+    }
+    auto doc = LoadConfigDocument(config_.paddleConfigPath);
+    if (!doc) {
+        return;
+    }
+    try {
+        if (doc->contains("engine")) {
+            const auto name = (*doc)["engine"].get<std::string>();
+            if (auto type = ParseEngineType(name)) {
+                preferredType_ = *type;
+            } else {
+                SPDLOG_WARN("Unknown OCR engine in config: {}", name);
+            }
+        }
+        ReadGlyphCacheConfig(*doc, config_.glyphCache);
+    } catch (const std::exception& ex) {
+        SPDLOG_WARN("Invalid OCR engine settings in {}: {}", config_.paddleConfigPath, ex.what());
+    }
+}
+
+std::optional<OcrEngineType> OcrEngineBootstrapper::ParseEngineType(const std::string& name) {
+    std::string lowered = name;
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    if (lowered == "paddle" || lowered == "paddleocr") {
+        return OcrEngineType::PaddleOCR;
+    }
+    if (lowered == "onnx" || lowered == "onnxruntime" || lowered == "ort") {
+        return OcrEngineType::OnnxRuntime;
+    }
+    if (lowered == "easyocr") {
+        return OcrEngineType::EasyOCR;
+    }
+    return std::nullopt;
+}
 
 void OcrEngineBootstrapper::SetPreferredEngine(OcrEngineType type) {
     preferredType_ = type;
@@ -60,6 +123,10 @@ std::shared_ptr<IOcrEngine> OcrEngineBootstrapper::CreateAndInitialize(OcrEngine
         return nullptr;
     }
 
+    if (config_.glyphCache.enabled) {
+        SPDLOG_INFO("Glyph cache fast path enabled for {}", ToString(type));
+        return std::make_shared<GlyphCacheOcrEngine>(std::move(engine), config_.glyphCache);
+    }
     return engine;
 }
 
@@ -74,6 +141,8 @@ bool OcrEngineBootstrapper::InitializeEngine(OcrEngineType type, const std::shar
         case OcrEngineType::EasyOCR:
             SPDLOG_WARN("EasyOCR engine is not implemented yet");
             return false;
+        case OcrEngineType::OnnxRuntime:
+            return InitializeOnnxRuntime(engine);
         default:
             return false;
     }
@@ -87,6 +156,7 @@ bool OcrEngineBootstrapper::InitializePaddleOcr(const std::shared_ptr<IOcrEngine
 
     PaddleOcrOptions resolvedOptions;
     bool hasOptions = false;
+    bool fromConfigFile = false;
     if (config_.overrideOptions) {
         resolvedOptions = *config_.overrideOptions;
         hasOptions = true;
@@ -97,6 +167,7 @@ bool OcrEngineBootstrapper::InitializePaddleOcr(const std::shared_ptr<IOcrEngine
         if (auto parsed = PaddleOcrOptions::FromJsonFile(config_.paddleConfigPath, errorMessage)) {
             resolvedOptions = *parsed;
             hasOptions = true;
+            fromConfigFile = true;
             SPDLOG_INFO("Loaded PaddleOCR config from {}", config_.paddleConfigPath);
         } else {
             SPDLOG_WARN("{}", errorMessage);
@@ -117,6 +188,17 @@ bool OcrEngineBootstrapper::InitializePaddleOcr(const std::shared_ptr<IOcrEngine
             return true;
         }
 
+        if (fromConfigFile) {
+            // JSON의 모델 경로가 배포 구조와 맞지 않아도 기본 det/rec/cls 구조로 한 번 더 시도
+            SPDLOG_WARN("PaddleOCR config models failed ({}), retrying with {}",
+                        paddle->GetLastError(), config_.paddleModelDirectory);
+            auto fallback = PaddleOcrOptions::FromModelRoot(config_.paddleModelDirectory, config_.paddleLanguage);
+            if (paddle->InitializeWithOptions(fallback)) {
+                SPDLOG_INFO("PaddleOCR initialized: {}", config_.paddleModelDirectory);
+                return true;
+            }
+        }
+
         SPDLOG_ERROR("PaddleOCR initialization failed via options");
         SPDLOG_ERROR("PaddleOCR detailed error: {}", paddle->GetLastError());
         return false;
@@ -131,5 +213,41 @@ bool OcrEngineBootstrapper::InitializePaddleOcr(const std::shared_ptr<IOcrEngine
     return false;
 }
 
+bool OcrEngineBootstrapper::InitializeOnnxRuntime(const std::shared_ptr<IOcrEngine>& engine) const {
+    if (!OnnxOcrEngine::IsAvailable()) {
+        SPDLOG_WARN("ONNX Runtime engine is not available in this build");
+        return false;
+    }
+
+    std::optional<OnnxOcrOptions> resolvedOptions;
+    if (!config_.paddleConfigPath.empty()) {
+        std::string errorMessage;
+        resolvedOptions = OnnxOcrOptions::FromJsonFile(config_.paddleConfigPath, errorMessage);
+        if (resolvedOptions) {
+            SPDLOG_INFO("Loaded ONNX OCR config from {}", config_.paddleConfigPath);
+        } else {
+            SPDLOG_WARN("{}", errorMessage);
+        }
+    }
+    if (!resolvedOptions) {
+        if (config_.paddleModelDirectory.empty()) {
+            SPDLOG_WARN("ONNX OCR model directory is missing");
+            return false;
+        }
+        resolvedOptions = OnnxOcrOptions::FromModelRoot(config_.paddleModelDirectory, config_.paddleLanguage);
+    }
+
+    if (auto* onnx = dynamic_cast<OnnxOcrEngine*>(engine.get())) {
+        if (onnx->InitializeWithOptions(*resolvedOptions)) {
+            SPDLOG_INFO("ONNX Runtime OCR initialized (det={})", resolvedOptions->detModelPath.string());
+            return true;
+        }
+        SPDLOG_ERROR("ONNX Runtime OCR detailed error: {}", onnx->GetLastError());
+        return false;
+    }
+
+    return engine->Initialize(config_.paddleModelDirectory, config_.paddleLanguage);
+}
+
 }  // namespace ocr
 }  // namespace toriyomi
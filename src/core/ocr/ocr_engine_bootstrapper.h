@@ -1,5 +1,6 @@
 #pragma once
 
+#include "core/ocr/glyph_cache_ocr_engine.h"
 #include "core/ocr/paddle/paddle_ocr_options.h"
 #include "ocr_engine.h"
 #include <memory>
@@ -16,12 +17,18 @@ struct OcrBootstrapConfig {
     std::string paddleConfigPath;                  // JSON/YAML 설정 경로 (선택)
     std::size_t paddlePipelineCount = 1;           // 앞으로 사용할 파이프라인 개수
     std::optional<PaddleOcrOptions> overrideOptions;
+    GlyphCacheConfig glyphCache;                   // 설정 파일의 glyph_cache_* 키가 덮어씀
 };
 
 class OcrEngineBootstrapper {
 public:
     explicit OcrEngineBootstrapper(OcrBootstrapConfig config = {});
 
+    /**
+     * @brief 설정 파일의 "engine" 키 해석 ("paddle", "onnxruntime" 등)
+     */
+    static std::optional<OcrEngineType> ParseEngineType(const std::string& name);
+
     void SetPreferredEngine(OcrEngineType type);
     OcrEngineType GetPreferredEngine() const;
 
@@ -32,6 +39,7 @@ public:
 
 private:
     bool InitializePaddleOcr(const std::shared_ptr<IOcrEngine>& engine) const;
+    bool InitializeOnnxRuntime(const std::shared_ptr<IOcrEngine>& engine) const;
 
     OcrBootstrapConfig config_;
     OcrEngineType preferredType_ = OcrEngineType::PaddleOCR;
@@ -0,0 +1,195 @@
+#include "core/ocr/onnx/onnx_ocr_options.h"
+
+#include "core/ocr/ocr_config_json.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+#include <yaml-cpp/yaml.h>
+
+namespace toriyomi {
+namespace ocr {
+namespace {
+constexpr const char* kDefaultOnnxDir = "onnx";
+constexpr const char* kDefaultDetModel = "det.onnx";
+constexpr const char* kDefaultRecModel = "rec.onnx";
+constexpr const char* kDefaultRecDir = "rec";
+constexpr const char* kInferenceConfig = "inference.yml";
+namespace fs = std::filesystem;
+
+int ResolveCpuThreads(int requested) {
+    if (requested > 0) {
+        return requested;
+    }
+    const unsigned concurrency = std::thread::hardware_concurrency();
+    return concurrency == 0 ? 4 : static_cast<int>(concurrency);
+}
+
+std::string NormalizeLanguage(std::string language) {
+    std::transform(language.begin(), language.end(), language.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    if (language.empty()) {
+        return "jpn";
+    }
+    return language;
+}
+
+bool IsYamlPath(const fs::path& path) {
+    auto extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return extension == ".yml" || extension == ".yaml";
+}
+
+}  // namespace
+
+OnnxOcrOptions OnnxOcrOptions::FromModelRoot(const std::filesystem::path& root,
+                                             const std::string& language) {
+    OnnxOcrOptions options;
+    options.detModelPath = root / kDefaultOnnxDir / kDefaultDetModel;
+    options.recModelPath = root / kDefaultOnnxDir / kDefaultRecModel;
+    options.recDictPath = root / kDefaultRecDir / kInferenceConfig;
+    options.language = NormalizeLanguage(language);
+    options.cpuThreads = ResolveCpuThreads(0);
+    return options;
+}
+
+std::optional<OnnxOcrOptions> OnnxOcrOptions::FromJsonFile(const std::filesystem::path& jsonPath,
+                                                           std::string& errorMessage) {
+    std::ifstream stream(jsonPath);
+    if (!stream) {
+        errorMessage = "Failed to open OCR config: " + jsonPath.string();
+        return std::nullopt;
+    }
+
+    nlohmann::json doc;
+    try {
+        stream >> doc;
+    } catch (const std::exception& ex) {
+        errorMessage = std::string{"Invalid OCR config JSON: "} + ex.what();
+        return std::nullopt;
+    }
+
+    OnnxOcrOptions opts;
+    auto get_optional_string = [&](const char* key) -> std::optional<std::string> {
+        if (!doc.contains(key)) {
+            return std::nullopt;
+        }
+        return doc[key].get<std::string>();
+    };
+
+    if (auto det = get_optional_string("onnx_det_model")) {
+        opts.detModelPath = ResolveConfigRelativePath(jsonPath, *det);
+    }
+    if (auto rec = get_optional_string("onnx_rec_model")) {
+        opts.recModelPath = ResolveConfigRelativePath(jsonPath, *rec);
+    }
+    if (auto dict = get_optional_string("onnx_rec_dict")) {
+        opts.recDictPath = ResolveConfigRelativePath(jsonPath, *dict);
+    } else if (auto label = get_optional_string("label_path")) {
+        opts.recDictPath = ResolveConfigRelativePath(jsonPath, *label);
+    } else if (auto recDir = get_optional_string("rec_model")) {
+        // Paddle rec 모델의 inference.yml에 문자 사전이 포함되어 있음
+        opts.recDictPath = ResolveConfigRelativePath(jsonPath, *recDir) / kInferenceConfig;
+    }
+    if (auto lang = get_optional_string("lang")) {
+        opts.language = NormalizeLanguage(*lang);
+    }
+
+    if (doc.contains("cpu_threads")) {
+        opts.cpuThreads = ResolveCpuThreads(doc["cpu_threads"].get<int>());
+    } else {
+        opts.cpuThreads = ResolveCpuThreads(0);
+    }
+    if (doc.contains("rec_batch_size")) {
+        opts.recBatchSize = std::max(1, doc["rec_batch_size"].get<int>());
+    }
+    if (doc.contains("det_limit_side_len")) {
+        opts.detLimitSideLen = std::max(32, doc["det_limit_side_len"].get<int>());
+    }
+    if (auto limitType = get_optional_string("det_limit_type")) {
+        opts.detLimitType = *limitType;
+    }
+    if (doc.contains("det_thresh")) {
+        opts.detThresh = doc["det_thresh"].get<float>();
+    }
+    if (doc.contains("det_box_thresh")) {
+        opts.detBoxThresh = doc["det_box_thresh"].get<float>();
+    }
+    if (doc.contains("det_unclip_ratio")) {
+        opts.detUnclipRatio = doc["det_unclip_ratio"].get<float>();
+    }
+    if (doc.contains("rec_score_thresh")) {
+        opts.recScoreThresh = doc["rec_score_thresh"].get<float>();
+    }
+
+    if (!ReadTextBoxFilterConfig(doc, opts.boxFilter, errorMessage)) {
+        return std::nullopt;
+    }
+    ReadTiledDetectionConfig(doc, opts.detTiling);
+
+    if (opts.detModelPath.empty() || opts.recModelPath.empty()) {
+        errorMessage = "ONNX OCR config must contain onnx_det_model and onnx_rec_model";
+        return std::nullopt;
+    }
+    if (opts.recDictPath.empty()) {
+        errorMessage = "ONNX OCR config must contain onnx_rec_dict (or rec_model with inference.yml)";
+        return std::nullopt;
+    }
+
+    return opts;
+}
+
+std::optional<std::vector<std::string>> LoadCtcCharacterDict(const std::filesystem::path& path,
+                                                             std::string& errorMessage) {
+    if (path.empty() || !fs::exists(path)) {
+        errorMessage = "Character dictionary not found: " + path.string();
+        return std::nullopt;
+    }
+
+    std::vector<std::string> characters;
+    if (IsYamlPath(path)) {
+        try {
+            const YAML::Node root = YAML::LoadFile(path.string());
+            const YAML::Node dict = root["PostProcess"]["character_dict"];
+            if (!dict || !dict.IsSequence()) {
+                errorMessage = "PostProcess.character_dict is missing in " + path.string();
+                return std::nullopt;
+            }
+            characters.reserve(dict.size());
+            for (const auto& item : dict) {
+                characters.push_back(item.as<std::string>());
+            }
+        } catch (const std::exception& ex) {
+            errorMessage = std::string{"Failed to parse character dictionary: "} + ex.what();
+            return std::nullopt;
+        }
+    } else {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) {
+            errorMessage = "Failed to open character dictionary: " + path.string();
+            return std::nullopt;
+        }
+        std::string line;
+        while (std::getline(stream, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            characters.push_back(line);
+        }
+    }
+
+    if (characters.empty()) {
+        errorMessage = "Character dictionary is empty: " + path.string();
+        return std::nullopt;
+    }
+    return characters;
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
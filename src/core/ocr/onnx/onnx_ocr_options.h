@@ -0,0 +1,60 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "core/ocr/text_box_filter.h"
+#include "core/ocr/tiled_detection.h"
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief ONNX Runtime 백엔드 설정
+ *
+ * PP-OCRv5 det/rec 모델을 ONNX로 내보낸 파일을 사용합니다.
+ * 문자 사전은 텍스트 파일(한 줄에 한 글자) 또는 Paddle rec 모델의 inference.yml을 받습니다.
+ */
+struct OnnxOcrOptions {
+    std::filesystem::path detModelPath;
+    std::filesystem::path recModelPath;
+    std::filesystem::path recDictPath;
+    std::string language = "jpn";
+
+    int cpuThreads = 0;                   // 0이면 하드웨어 동시성 사용
+    int recBatchSize = 6;
+
+    int detLimitSideLen = 960;            // 검출 입력 리사이즈 기준 변 길이
+    std::string detLimitType = "max";     // "max": 긴 변 제한, "min": 짧은 변 보장
+    int detMaxSideLimit = 4000;
+    float detThresh = 0.3f;
+    float detBoxThresh = 0.6f;
+    float detUnclipRatio = 1.5f;
+
+    int recImageHeight = 48;
+    int recImageWidth = 320;              // 배치 최소 폭 (PP-OCRv5 기본 입력 3x48x320)
+    float recScoreThresh = 0.0f;
+
+    TextBoxFilterConfig boxFilter;
+    TiledDetectionConfig detTiling;       // 타일은 순서대로 검출 (detBatchSize 미사용)
+
+    static OnnxOcrOptions FromModelRoot(const std::filesystem::path& root,
+                                        const std::string& language);
+    static std::optional<OnnxOcrOptions> FromJsonFile(const std::filesystem::path& jsonPath,
+                                                      std::string& errorMessage);
+};
+
+/**
+ * @brief CTC 문자 사전 로드
+ *
+ * @param path 텍스트 사전(.txt) 또는 inference.yml (PostProcess.character_dict)
+ * @param errorMessage 실패 시 오류 메시지
+ * @return 문자 목록 (blank/공백 토큰 제외), 실패 시 std::nullopt
+ */
+std::optional<std::vector<std::string>> LoadCtcCharacterDict(const std::filesystem::path& path,
+                                                             std::string& errorMessage);
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,126 @@
+#include "core/ocr/onnx/onnx_ocr_preprocess.h"
+
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace toriyomi {
+namespace ocr {
+namespace {
+constexpr int kDetStride = 32;
+
+int RoundToStride(float value) {
+    const int rounded = static_cast<int>(std::round(value / kDetStride)) * kDetStride;
+    return std::max(kDetStride, rounded);
+}
+}  // namespace
+
+cv::Size ComputeDetectionInputSize(const cv::Size& source,
+                                   int limitSideLen,
+                                   const std::string& limitType,
+                                   int maxSideLimit) {
+    if (source.width <= 0 || source.height <= 0) {
+        return cv::Size(kDetStride, kDetStride);
+    }
+
+    const int longSide = std::max(source.width, source.height);
+    const int shortSide = std::min(source.width, source.height);
+    float ratio = 1.0f;
+    if (limitType == "min") {
+        if (shortSide < limitSideLen) {
+            ratio = static_cast<float>(limitSideLen) / static_cast<float>(shortSide);
+        }
+    } else if (longSide > limitSideLen) {
+        ratio = static_cast<float>(limitSideLen) / static_cast<float>(longSide);
+    }
+
+    float height = source.height * ratio;
+    float width = source.width * ratio;
+    if (maxSideLimit > 0 && std::max(height, width) > maxSideLimit) {
+        const float clampRatio = static_cast<float>(maxSideLimit) / std::max(height, width);
+        height *= clampRatio;
+        width *= clampRatio;
+    }
+    return cv::Size(RoundToStride(width), RoundToStride(height));
+}
+
+void AppendChwBlob(const cv::Mat& bgr,
+                   const cv::Scalar& mean,
+                   const cv::Scalar& stddev,
+                   float scale,
+                   std::vector<float>& blob) {
+    CV_Assert(bgr.type() == CV_8UC3);
+
+    const size_t plane = static_cast<size_t>(bgr.rows) * bgr.cols;
+    const size_t offset = blob.size();
+    blob.resize(offset + plane * 3);
+    float* channels[3] = {blob.data() + offset, blob.data() + offset + plane, blob.data() + offset + plane * 2};
+
+    float mul[3];
+    float add[3];
+    for (int c = 0; c < 3; ++c) {
+        mul[c] = scale / static_cast<float>(stddev[c]);
+        add[c] = -static_cast<float>(mean[c]) / static_cast<float>(stddev[c]);
+    }
+
+    for (int y = 0; y < bgr.rows; ++y) {
+        const uchar* row = bgr.ptr<uchar>(y);
+        const size_t base = static_cast<size_t>(y) * bgr.cols;
+        for (int x = 0; x < bgr.cols; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                channels[c][base + x] = row[x * 3 + c] * mul[c] + add[c];
+            }
+        }
+    }
+}
+
+int ComputeRecognitionWidth(const cv::Size& crop, int recHeight, int maxWidth) {
+    if (crop.width <= 0 || crop.height <= 0) {
+        return 1;
+    }
+    const float ratio = static_cast<float>(crop.width) / static_cast<float>(crop.height);
+    const int width = static_cast<int>(std::ceil(recHeight * ratio));
+    return std::clamp(width, 1, std::max(1, maxWidth));
+}
+
+void AppendRecognitionBlob(const cv::Mat& crop,
+                           int recHeight,
+                           int batchWidth,
+                           std::vector<float>& blob) {
+    const size_t plane = static_cast<size_t>(recHeight) * batchWidth;
+    const size_t offset = blob.size();
+    blob.resize(offset + plane * 3, 0.0f);
+    if (crop.empty()) {
+        return;
+    }
+
+    const int resizedWidth = ComputeRecognitionWidth(crop.size(), recHeight, batchWidth);
+    cv::Mat resized;
+    cv::resize(crop, resized, cv::Size(resizedWidth, recHeight), 0.0, 0.0, cv::INTER_LINEAR);
+    if (resized.type() != CV_8UC3) {
+        cv::Mat converted;
+        if (resized.channels() == 1) {
+            cv::cvtColor(resized, converted, cv::COLOR_GRAY2BGR);
+        } else if (resized.channels() == 4) {
+            cv::cvtColor(resized, converted, cv::COLOR_BGRA2BGR);
+        } else {
+            resized.convertTo(converted, CV_8UC3);
+        }
+        resized = converted;
+    }
+
+    // (pixel / 255 - 0.5) / 0.5, 패딩 영역은 0 유지
+    constexpr float kScale = 2.0f / 255.0f;
+    for (int y = 0; y < recHeight; ++y) {
+        const uchar* row = resized.ptr<uchar>(y);
+        for (int x = 0; x < resizedWidth; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                blob[offset + c * plane + static_cast<size_t>(y) * batchWidth + x] =
+                    row[x * 3 + c] * kScale - 1.0f;
+            }
+        }
+    }
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
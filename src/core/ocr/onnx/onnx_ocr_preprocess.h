@@ -0,0 +1,50 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <string>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 검출 모델 입력 크기 계산 (DB 계열은 32의 배수 필요)
+ *
+ * @param source 원본 이미지 크기
+ * @param limitSideLen 기준 변 길이
+ * @param limitType "max"면 긴 변을 limitSideLen 이하로, "min"이면 짧은 변을 limitSideLen 이상으로
+ * @param maxSideLimit 긴 변 최대 길이
+ */
+cv::Size ComputeDetectionInputSize(const cv::Size& source,
+                                   int limitSideLen,
+                                   const std::string& limitType,
+                                   int maxSideLimit);
+
+/**
+ * @brief BGR 이미지를 정규화하여 CHW float 텐서로 추가
+ *
+ * value = (pixel * scale - mean[c]) / stddev[c]
+ */
+void AppendChwBlob(const cv::Mat& bgr,
+                   const cv::Scalar& mean,
+                   const cv::Scalar& stddev,
+                   float scale,
+                   std::vector<float>& blob);
+
+/**
+ * @brief 인식 크롭의 리사이즈 후 폭 (높이 고정, 종횡비 유지)
+ */
+int ComputeRecognitionWidth(const cv::Size& crop, int recHeight, int maxWidth);
+
+/**
+ * @brief 인식 크롭을 (3, recHeight, batchWidth) 텐서로 추가
+ *
+ * 높이를 맞춰 리사이즈한 뒤 [-1, 1]로 정규화하고 오른쪽을 0으로 채웁니다.
+ */
+void AppendRecognitionBlob(const cv::Mat& crop,
+                           int recHeight,
+                           int batchWidth,
+                           std::vector<float>& blob);
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,410 @@
+#include "onnx_ocr_engine.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+
+#if defined(TORIYOMI_HAS_ONNXRUNTIME)
+#include <opencv2/imgproc.hpp>
+#include <onnxruntime_cxx_api.h>
+
+#include "core/ocr/char_boxes.h"
+#include "core/ocr/onnx/onnx_ocr_preprocess.h"
+#include "core/ocr/text_box_filter.h"
+#include "core/ocr/tiled_detection.h"
+#include "paddleocr/src/common/processors.h"
+#include "paddleocr/src/modules/text_detection/processors.h"
+#include "paddleocr/src/modules/text_recognition/processors.h"
+#endif
+
+namespace toriyomi {
+namespace ocr {
+
+namespace {
+namespace fs = std::filesystem;
+}  // namespace
+
+#if defined(TORIYOMI_HAS_ONNXRUNTIME)
+
+namespace {
+constexpr float kDefaultConfidenceScale = 100.0f;
+const cv::Scalar kDetMean(0.485, 0.456, 0.406);
+const cv::Scalar kDetStd(0.229, 0.224, 0.225);
+constexpr float kDetScale = 1.0f / 255.0f;
+}  // namespace
+
+class OnnxOcrEngine::Runtime {
+public:
+    Runtime();
+    ~Runtime() = default;
+
+    bool Initialize(const OnnxOcrOptions& options, std::string& errorMessage);
+    bool Predict(const cv::Mat& image, std::vector<TextSegment>& segments);
+
+private:
+    struct SessionSlot {
+        std::unique_ptr<Ort::Session> session;
+        std::string inputName;
+        std::string outputName;
+    };
+
+    struct RecognizedLine {
+        std::string text;
+        float score = 0.0f;
+        std::vector<std::pair<float, float>> charRanges;  // 크롭 폭 대비 글자 구간
+    };
+
+    bool LoadSession(const fs::path& modelPath, SessionSlot& slot, std::string& errorMessage);
+    std::vector<std::vector<cv::Point2f>> Detect(const cv::Mat& image);
+    std::vector<std::vector<cv::Point2f>> DetectTile(const cv::Mat& image);
+    std::vector<RecognizedLine> Recognize(const std::vector<cv::Mat>& crops);
+    Ort::Value RunSession(SessionSlot& slot, std::vector<float>& blob, const std::vector<int64_t>& shape);
+
+    OnnxOcrOptions options_;
+    Ort::Env env_;
+    Ort::SessionOptions sessionOptions_;
+    Ort::MemoryInfo memoryInfo_;
+    SessionSlot det_;
+    SessionSlot rec_;
+    std::unique_ptr<DBPostProcess> dbPostProcess_;
+    std::unique_ptr<CTCLabelDecode> ctcDecode_;
+    std::unique_ptr<CropByPolys> cropByPolys_;
+    std::unique_ptr<TextBoxFilter> boxFilter_;
+};
+
+OnnxOcrEngine::Runtime::Runtime()
+    : env_(ORT_LOGGING_LEVEL_WARNING, "ToriYomi"),
+      memoryInfo_(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)) {}
+
+bool OnnxOcrEngine::Runtime::LoadSession(const fs::path& modelPath, SessionSlot& slot, std::string& errorMessage) {
+    if (modelPath.empty() || !fs::exists(modelPath)) {
+        errorMessage = "ONNX 모델 파일을 찾을 수 없습니다: " + modelPath.string();
+        return false;
+    }
+
+    slot.session = std::make_unique<Ort::Session>(env_, modelPath.c_str(), sessionOptions_);
+    Ort::AllocatorWithDefaultOptions allocator;
+    slot.inputName = slot.session->GetInputNameAllocated(0, allocator).get();
+    slot.outputName = slot.session->GetOutputNameAllocated(0, allocator).get();
+    return true;
+}
+
+bool OnnxOcrEngine::Runtime::Initialize(const OnnxOcrOptions& options, std::string& errorMessage) {
+    options_ = options;
+
+    auto characters = LoadCtcCharacterDict(options.recDictPath, errorMessage);
+    if (!characters) {
+        return false;
+    }
+
+    try {
+        sessionOptions_.SetIntraOpNumThreads(std::max(1, options.cpuThreads));
+        sessionOptions_.SetInterOpNumThreads(1);
+        sessionOptions_.SetExecutionMode(ExecutionMode::ORT_SEQUENTIAL);
+        sessionOptions_.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+
+        if (!LoadSession(options.detModelPath, det_, errorMessage) ||
+            !LoadSession(options.recModelPath, rec_, errorMessage)) {
+            return false;
+        }
+    } catch (const Ort::Exception& ex) {
+        errorMessage = std::string{"ONNX Runtime 세션 생성 실패: "} + ex.what();
+        return false;
+    }
+
+    DBPostProcessParams dbParams;
+    dbParams.thresh = options.detThresh;
+    dbParams.box_thresh = options.detBoxThresh;
+    dbParams.unclip_ratio = options.detUnclipRatio;
+    dbParams.box_type = "quad";
+    dbPostProcess_ = std::make_unique<DBPostProcess>(dbParams);
+    ctcDecode_ = std::make_unique<CTCLabelDecode>(*characters, true);
+    cropByPolys_ = std::make_unique<CropByPolys>("quad");
+    if (options.boxFilter.enabled) {
+        boxFilter_ = std::make_unique<TextBoxFilter>(options.boxFilter);
+    }
+
+    SPDLOG_INFO("ONNX Runtime OCR 초기화 완료 (det={}, rec={}, 사전 {}자)",
+                options.detModelPath.string(), options.recModelPath.string(), characters->size());
+    return true;
+}
+
+Ort::Value OnnxOcrEngine::Runtime::RunSession(SessionSlot& slot,
+                                              std::vector<float>& blob,
+                                              const std::vector<int64_t>& shape) {
+    Ort::Value input = Ort::Value::CreateTensor<float>(memoryInfo_, blob.data(), blob.size(),
+                                                       shape.data(), shape.size());
+    const char* inputNames[] = {slot.inputName.c_str()};
+    const char* outputNames[] = {slot.outputName.c_str()};
+    auto outputs = slot.session->Run(Ort::RunOptions{nullptr}, inputNames, &input, 1, outputNames, 1);
+    return std::move(outputs.front());
+}
+
+std::vector<std::vector<cv::Point2f>> OnnxOcrEngine::Runtime::Detect(const cv::Mat& image) {
+    std::vector<std::vector<cv::Point2f>> polys;
+    const auto tiles = PlanDetectionTiles(image.size(), options_.detTiling);
+    if (tiles.size() > 1) {
+        std::vector<std::vector<DetectionQuad>> tilePolys;
+        tilePolys.reserve(tiles.size());
+        for (const auto& tile : tiles) {
+            tilePolys.push_back(DetectTile(image(tile)));
+        }
+        polys = MergeTiledDetections(tilePolys, tiles, image.size(), options_.detTiling);
+    } else {
+        polys = DetectTile(image);
+    }
+    if (polys.empty()) {
+        return polys;
+    }
+    polys = ComponentsProcessor::SortQuadBoxes(polys);
+
+    if (boxFilter_) {
+        std::vector<cv::Rect> boxes;
+        boxes.reserve(polys.size());
+        for (const auto& poly : polys) {
+            boxes.push_back(cv::boundingRect(poly));
+        }
+        std::vector<std::vector<cv::Point2f>> kept;
+        for (const auto index : boxFilter_->Apply(boxes, image.size())) {
+            kept.push_back(std::move(polys[index]));
+        }
+        polys = std::move(kept);
+    }
+    return polys;
+}
+
+std::vector<std::vector<cv::Point2f>> OnnxOcrEngine::Runtime::DetectTile(const cv::Mat& image) {
+    const cv::Size inputSize = ComputeDetectionInputSize(image.size(), options_.detLimitSideLen,
+                                                         options_.detLimitType, options_.detMaxSideLimit);
+    cv::Mat resized;
+    cv::resize(image, resized, inputSize);
+
+    std::vector<float> blob;
+    blob.reserve(static_cast<size_t>(inputSize.area()) * 3);
+    AppendChwBlob(resized, kDetMean, kDetStd, kDetScale, blob);
+
+    Ort::Value output = RunSession(det_, blob, {1, 3, inputSize.height, inputSize.width});
+    const auto shape = output.GetTensorTypeAndShapeInfo().GetShape();
+    if (shape.size() != 4) {
+        SPDLOG_WARN("예상하지 못한 det 출력 차원: {}", shape.size());
+        return {};
+    }
+
+    int sizes[4] = {static_cast<int>(shape[0]), static_cast<int>(shape[1]),
+                    static_cast<int>(shape[2]), static_cast<int>(shape[3])};
+    cv::Mat pred(4, sizes, CV_32F, output.GetTensorMutableData<float>());
+    auto result = (*dbPostProcess_)(pred, {image.rows, image.cols});
+    if (!result.ok()) {
+        SPDLOG_WARN("DB 후처리 실패: {}", result.status().ToString());
+        return {};
+    }
+
+    return std::move(result.value().first);
+}
+
+std::vector<OnnxOcrEngine::Runtime::RecognizedLine> OnnxOcrEngine::Runtime::Recognize(
+    const std::vector<cv::Mat>& crops) {
+    std::vector<RecognizedLine> results(crops.size());
+    if (crops.empty()) {
+        return results;
+    }
+
+    // 종횡비 순으로 묶어 배치 내 패딩 최소화 (Paddle 파이프라인과 동일)
+    std::vector<size_t> order(crops.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto ratioOf = [&crops](size_t index) {
+        return static_cast<float>(crops[index].cols) / std::max(1, crops[index].rows);
+    };
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return ratioOf(lhs) < ratioOf(rhs);
+    });
+
+    const int recHeight = options_.recImageHeight;
+    const size_t batchSize = static_cast<size_t>(std::max(1, options_.recBatchSize));
+    std::vector<float> blob;
+    for (size_t begin = 0; begin < order.size(); begin += batchSize) {
+        const size_t end = std::min(order.size(), begin + batchSize);
+        int batchWidth = options_.recImageWidth;
+        for (size_t i = begin; i < end; ++i) {
+            batchWidth = std::max(batchWidth, ComputeRecognitionWidth(crops[order[i]].size(), recHeight,
+                                                                      OCRReisizeNormImg::MAX_IMG_W));
+        }
+
+        blob.clear();
+        blob.reserve((end - begin) * 3 * static_cast<size_t>(recHeight) * batchWidth);
+        for (size_t i = begin; i < end; ++i) {
+            AppendRecognitionBlob(crops[order[i]], recHeight, batchWidth, blob);
+        }
+
+        Ort::Value output = RunSession(rec_, blob,
+                                       {static_cast<int64_t>(end - begin), 3, recHeight, batchWidth});
+        const auto shape = output.GetTensorTypeAndShapeInfo().GetShape();
+        if (shape.size() != 3) {
+            SPDLOG_WARN("예상하지 못한 rec 출력 차원: {}", shape.size());
+            continue;
+        }
+        int sizes[3] = {static_cast<int>(shape[0]), static_cast<int>(shape[1]), static_cast<int>(shape[2])};
+        cv::Mat pred(3, sizes, CV_32F, output.GetTensorMutableData<float>());
+        std::vector<CTCCharTimesteps> timesteps;
+        auto decoded = ctcDecode_->Apply(pred, &timesteps);
+        if (!decoded.ok()) {
+            SPDLOG_WARN("CTC 디코딩 실패: {}", decoded.status().ToString());
+            continue;
+        }
+        for (size_t i = 0; i < decoded.value().size() && begin + i < end; ++i) {
+            RecognizedLine& line = results[order[begin + i]];
+            line.text = decoded.value()[i].first;
+            line.score = decoded.value()[i].second;
+            if (i >= timesteps.size() || timesteps[i].seq_len <= 0) {
+                continue;
+            }
+
+            // timestep은 패딩 포함 batchWidth를 덮고, 크롭은 왼쪽 contentWidth만 차지
+            const int contentWidth = ComputeRecognitionWidth(crops[order[begin + i]].size(), recHeight, batchWidth);
+            const float scale = static_cast<float>(batchWidth) /
+                                (static_cast<float>(timesteps[i].seq_len) * contentWidth);
+            line.charRanges.reserve(timesteps[i].char_ranges.size());
+            for (const auto& [first, last] : timesteps[i].char_ranges) {
+                line.charRanges.emplace_back(std::min(1.0f, first * scale), std::min(1.0f, last * scale));
+            }
+        }
+    }
+    return results;
+}
+
+bool OnnxOcrEngine::Runtime::Predict(const cv::Mat& image, std::vector<TextSegment>& segments) {
+    segments.clear();
+
+    const auto polys = Detect(image);
+    if (polys.empty()) {
+        return true;
+    }
+
+    auto crops = (*cropByPolys_)(image, polys);
+    if (!crops.ok()) {
+        SPDLOG_WARN("텍스트 영역 크롭 실패: {}", crops.status().ToString());
+        return false;
+    }
+
+    const auto recognized = Recognize(crops.value());
+    const cv::Rect imageRect(0, 0, image.cols, image.rows);
+    segments.reserve(recognized.size());
+    for (size_t i = 0; i < recognized.size() && i < polys.size(); ++i) {
+        const auto& line = recognized[i];
+        if (line.text.empty() || line.score < options_.recScoreThresh) {
+            continue;
+        }
+
+        TextSegment segment;
+        segment.text = line.text;
+        segment.confidence = line.score * kDefaultConfidenceScale;
+        segment.boundingBox = cv::boundingRect(polys[i]) & imageRect;
+        segment.charBoxes = CharBoxesFromRanges(segment.boundingBox, line.charRanges);
+        segments.push_back(std::move(segment));
+    }
+    return true;
+}
+
+#else
+
+class OnnxOcrEngine::Runtime {
+public:
+    bool Initialize(const OnnxOcrOptions&, std::string& errorMessage) {
+        errorMessage = "ONNX Runtime 지원 없이 빌드되었습니다 (TORIYOMI_ONNXRUNTIME_DIR 설정 필요)";
+        return false;
+    }
+    bool Predict(const cv::Mat&, std::vector<TextSegment>& segments) {
+        segments.clear();
+        return false;
+    }
+};
+
+#endif
+
+OnnxOcrEngine::OnnxOcrEngine() = default;
+OnnxOcrEngine::~OnnxOcrEngine() {
+    Shutdown();
+}
+
+bool OnnxOcrEngine::IsAvailable() {
+#if defined(TORIYOMI_HAS_ONNXRUNTIME)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool OnnxOcrEngine::Initialize(const std::string& modelDir, const std::string& language) {
+    return InitializeWithOptions(OnnxOcrOptions::FromModelRoot(modelDir, language));
+}
+
+bool OnnxOcrEngine::InitializeWithOptions(const OnnxOcrOptions& options) {
+    std::lock_guard<std::mutex> guard(runtimeMutex_);
+    ResetRuntimeLocked();
+
+    auto runtime = std::make_unique<Runtime>();
+    std::string errorMessage;
+    if (!runtime->Initialize(options, errorMessage)) {
+        lastError_ = errorMessage.empty() ? std::string{"ONNX Runtime 초기화 실패"} : errorMessage;
+        SPDLOG_ERROR("{}", lastError_);
+        return false;
+    }
+
+    runtime_ = std::move(runtime);
+    initialized_ = true;
+    lastError_.clear();
+    return true;
+}
+
+std::vector<TextSegment> OnnxOcrEngine::RecognizeText(const cv::Mat& image) {
+    std::lock_guard<std::mutex> guard(runtimeMutex_);
+
+    std::vector<TextSegment> segments;
+    if (!initialized_ || !runtime_) {
+        return segments;
+    }
+    if (image.empty()) {
+        lastError_ = "입력 이미지가 비어 있습니다";
+        return segments;
+    }
+
+    try {
+        if (!runtime_->Predict(image, segments)) {
+            lastError_ = "ONNX Runtime 추론 호출 실패";
+            segments.clear();
+        }
+    } catch (const std::exception& ex) {
+        lastError_ = std::string{"ONNX Runtime 추론 예외: "} + ex.what();
+        SPDLOG_ERROR("{}", lastError_);
+        segments.clear();
+    }
+    return segments;
+}
+
+void OnnxOcrEngine::Shutdown() {
+    std::lock_guard<std::mutex> guard(runtimeMutex_);
+    ResetRuntimeLocked();
+}
+
+bool OnnxOcrEngine::IsInitialized() const {
+    return initialized_;
+}
+
+std::string OnnxOcrEngine::GetEngineName() const {
+    return "ONNX Runtime";
+}
+
+std::string OnnxOcrEngine::GetLastError() const {
+    std::lock_guard<std::mutex> guard(runtimeMutex_);
+    return lastError_;
+}
+
+void OnnxOcrEngine::ResetRuntimeLocked() {
+    runtime_.reset();
+    initialized_ = false;
+    lastError_.clear();
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "core/ocr/onnx/onnx_ocr_options.h"
+#include "ocr_engine.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief ONNX Runtime(CPU)으로 PP-OCRv5 det/rec ONNX 모델을 실행하는 IOcrEngine 구현체입니다.
+ *
+ * TORIYOMI_HAS_ONNXRUNTIME 없이 빌드되면 초기화가 항상 실패합니다.
+ */
+class OnnxOcrEngine : public IOcrEngine {
+public:
+    OnnxOcrEngine();
+    ~OnnxOcrEngine() override;
+
+    bool Initialize(const std::string& modelDir, const std::string& language = "jpn") override;
+    std::vector<TextSegment> RecognizeText(const cv::Mat& image) override;
+    void Shutdown() override;
+    bool IsInitialized() const override;
+    std::string GetEngineName() const override;
+
+    /**
+     * @brief 마지막 오류 메시지 (디버깅 용도)
+     */
+    std::string GetLastError() const;
+
+    /**
+     * @brief 세부 옵션으로 직접 초기화 (Bootstrapper 전용)
+     */
+    bool InitializeWithOptions(const OnnxOcrOptions& options);
+
+    /**
+     * @brief ONNX Runtime 지원 포함 여부 (빌드 옵션)
+     */
+    static bool IsAvailable();
+
+private:
+    void ResetRuntimeLocked();
+
+    mutable std::mutex runtimeMutex_;
+    bool initialized_ = false;
+    std::string lastError_;
+
+    class Runtime;
+    std::unique_ptr<Runtime> runtime_;
+};
+
+}  // namespace ocr
+}  // namespace toriyomi
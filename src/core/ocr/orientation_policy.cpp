@@ -0,0 +1,93 @@
+#include "core/ocr/orientation_policy.h"
+
+#include <algorithm>
+
+namespace toriyomi {
+namespace ocr {
+
+StickyOrientationPolicy::StickyOrientationPolicy(OrientationPolicyConfig config)
+    : config_(config) {
+    config_.warmupFrames = std::max(1, config_.warmupFrames);
+    config_.recheckIntervalFrames = std::max(0, config_.recheckIntervalFrames);
+}
+
+std::optional<int> StickyOrientationPolicy::AngleForFrame() {
+    if (!lockedAngle_) {
+        return std::nullopt;
+    }
+
+    const bool intervalElapsed = config_.recheckIntervalFrames > 0 &&
+                                 framesSinceLock_ >= config_.recheckIntervalFrames;
+    if (recheckPending_ || intervalElapsed) {
+        BeginRelearn();
+        return std::nullopt;
+    }
+
+    ++framesSinceLock_;
+    ++skippedRuns_;
+    return lockedAngle_;
+}
+
+void StickyOrientationPolicy::RecordObservation(int angle) {
+    if (lockedAngle_) {
+        // 고정 상태에서 들어온 관측은 무시합니다 (AngleForFrame 규약 위반 방지)
+        return;
+    }
+
+    ++classifierRuns_;
+    ++votes_[angle];
+    ++observedFrames_;
+    if (observedFrames_ < config_.warmupFrames) {
+        return;
+    }
+
+    // 최다 득표 각도로 고정 (동률이면 작은 각도 우선 - 보통 0도)
+    auto best = votes_.begin();
+    for (auto it = votes_.begin(); it != votes_.end(); ++it) {
+        if (it->second > best->second) {
+            best = it;
+        }
+    }
+    lockedAngle_ = best->first;
+    framesSinceLock_ = 0;
+    recheckPending_ = false;
+    votes_.clear();
+    observedFrames_ = 0;
+}
+
+void StickyOrientationPolicy::ReportConfidence(float meanConfidence) {
+    if (lockedAngle_ && meanConfidence < config_.recheckConfidence) {
+        recheckPending_ = true;
+    }
+}
+
+void StickyOrientationPolicy::Reset() {
+    BeginRelearn();
+}
+
+bool StickyOrientationPolicy::IsLocked() const {
+    return lockedAngle_.has_value();
+}
+
+std::optional<int> StickyOrientationPolicy::GetLockedAngle() const {
+    return lockedAngle_;
+}
+
+uint64_t StickyOrientationPolicy::GetClassifierRuns() const {
+    return classifierRuns_;
+}
+
+uint64_t StickyOrientationPolicy::GetSkippedRuns() const {
+    return skippedRuns_;
+}
+
+void StickyOrientationPolicy::BeginRelearn() {
+    lockedAngle_.reset();
+    votes_.clear();
+    observedFrames_ = 0;
+    framesSinceLock_ = 0;
+    recheckPending_ = false;
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
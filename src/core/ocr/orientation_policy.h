@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 방향 분류 고정 정책 설정
+ */
+struct OrientationPolicyConfig {
+    int warmupFrames = 3;              // 다수결로 고정하기 전까지 분류기를 실행할 프레임 수
+    int recheckIntervalFrames = 300;   // 고정 후 주기적으로 재분류할 간격 (0이면 비활성)
+    float recheckConfidence = 60.0f;   // 평균 인식 신뢰도가 이 값 미만이면 재분류 (0.0 ~ 100.0)
+};
+
+/**
+ * @brief 방향 분류 결과를 ROI 단위로 고정하는 정책
+ *
+ * 게임 창은 회전하지 않으므로 처음 몇 프레임만 분류기를 돌려 다수결로
+ * 각도를 고정하고, 이후에는 주기적 재확인이나 낮은 인식 신뢰도가 감지될 때만
+ * 다시 분류합니다. 스레드 안전하지 않으므로 OCR 스레드 안에서만 사용합니다.
+ */
+class StickyOrientationPolicy {
+public:
+    explicit StickyOrientationPolicy(OrientationPolicyConfig config = {});
+
+    /**
+     * @brief 이번 프레임에 사용할 고정 각도
+     *
+     * @return 고정된 각도, 분류기를 실행해야 하면 std::nullopt
+     */
+    std::optional<int> AngleForFrame();
+
+    /**
+     * @brief 분류기 실행 결과 기록 (AngleForFrame()이 nullopt를 반환한 프레임에서 호출)
+     */
+    void RecordObservation(int angle);
+
+    /**
+     * @brief 프레임의 평균 인식 신뢰도 보고 (낮으면 재분류 예약)
+     */
+    void ReportConfidence(float meanConfidence);
+
+    /**
+     * @brief 학습 상태 초기화 (ROI 변경 시)
+     */
+    void Reset();
+
+    bool IsLocked() const;
+    std::optional<int> GetLockedAngle() const;
+    uint64_t GetClassifierRuns() const;
+    uint64_t GetSkippedRuns() const;
+
+private:
+    void BeginRelearn();
+
+    OrientationPolicyConfig config_;
+    std::map<int, int> votes_;
+    int observedFrames_ = 0;
+    std::optional<int> lockedAngle_;
+    int framesSinceLock_ = 0;
+    bool recheckPending_ = false;
+    uint64_t classifierRuns_ = 0;
+    uint64_t skippedRuns_ = 0;
+};
+
+}  // namespace ocr
+}  // namespace toriyomi
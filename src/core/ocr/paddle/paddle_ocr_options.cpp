@@ -1,5 +1,7 @@
 #include "core/ocr/paddle/paddle_ocr_options.h"
 
+#include "core/ocr/ocr_config_json.h"
+
 #include <algorithm>
 #include <cctype>
 #include <fstream>
@@ -111,16 +113,16 @@ std::optional<PaddleOcrOptions> PaddleOcrOptions::FromJsonFile(const std::filesy
     };
 
     if (auto det = get_optional_string("det_model")) {
-        opts.detModelDir = *det;
+        opts.detModelDir = ResolveConfigRelativePath(jsonPath, *det);
     }
     if (auto rec = get_optional_string("rec_model")) {
-        opts.recModelDir = *rec;
+        opts.recModelDir = ResolveConfigRelativePath(jsonPath, *rec);
     }
     if (auto cls = get_optional_string("cls_model")) {
-        opts.clsModelDir = *cls;
+        opts.clsModelDir = ResolveConfigRelativePath(jsonPath, *cls);
     }
     if (auto label = get_optional_string("label_path")) {
-        opts.labelPath = *label;
+        opts.labelPath = ResolveConfigRelativePath(jsonPath, *label);
     }
     if (auto lang = get_optional_string("lang")) {
         opts.language = NormalizeLanguage(*lang);
@@ -160,6 +162,23 @@ std::optional<PaddleOcrOptions> PaddleOcrOptions::FromJsonFile(const std::filesy
     if (doc.contains("enable_textline_orientation")) {
         opts.enableTextlineOrientation = doc["enable_textline_orientation"].get<bool>();
     }
+    if (doc.contains("sticky_orientation")) {
+        opts.stickyOrientation = doc["sticky_orientation"].get<bool>();
+    }
+    if (doc.contains("orientation_warmup_frames")) {
+        opts.orientationWarmupFrames = std::max(1, doc["orientation_warmup_frames"].get<int>());
+    }
+    if (doc.contains("orientation_recheck_interval")) {
+        opts.orientationRecheckInterval = std::max(0, doc["orientation_recheck_interval"].get<int>());
+    }
+    if (doc.contains("orientation_recheck_confidence")) {
+        opts.orientationRecheckConfidence = doc["orientation_recheck_confidence"].get<float>();
+    }
+
+    if (!ReadTextBoxFilterConfig(doc, opts.boxFilter, errorMessage)) {
+        return std::nullopt;
+    }
+    ReadTiledDetectionConfig(doc, opts.detTiling);
 
     if (opts.detModelDir.empty() || opts.recModelDir.empty()) {
         errorMessage = "Paddle OCR config must contain det_model and rec_model";
@@ -5,6 +5,9 @@
 #include <optional>
 #include <string>
 
+#include "core/ocr/text_box_filter.h"
+#include "core/ocr/tiled_detection.h"
+
 namespace toriyomi {
 namespace ocr {
 
@@ -32,6 +35,12 @@ struct PaddleOcrOptions {
     bool enableCls = false;
     bool enableDocOrientation = false;
     bool enableTextlineOrientation = false;
+    bool stickyOrientation = true;              // 방향 분류 결과를 ROI 단위로 고정
+    int orientationWarmupFrames = 3;            // 고정 전 분류기를 실행할 프레임 수
+    int orientationRecheckInterval = 300;       // 고정 후 재분류 주기 (프레임, 0이면 비활성)
+    float orientationRecheckConfidence = 60.0f; // 평균 신뢰도가 이 값 미만이면 재분류
+    TextBoxFilterConfig boxFilter;              // 인식 전 검출 박스 필터 (루비/노이즈 제거)
+    TiledDetectionConfig detTiling;             // 고해상도 프레임 타일 분할 검출
 
     static PaddleOcrOptions FromModelRoot(const std::filesystem::path& root,
                                           const std::string& language);
@@ -5,8 +5,14 @@
 #include <algorithm>
 #include <cctype>
 #include <filesystem>
+#include <map>
 #include <thread>
 
+#include "core/ocr/char_boxes.h"
+#include "core/ocr/orientation_policy.h"
+#include "core/ocr/text_box_filter.h"
+#include "core/ocr/tiled_detection.h"
+
 #include "paddleocr/src/pipelines/ocr/pipeline.h"
 #include "paddleocr/src/utils/utility.h"
 
@@ -47,6 +53,33 @@ std::string NormalizeLanguageCode(const std::string& language) {
     }
     return lowered.empty() ? std::string("ch") : lowered;
 }
+
+absl::optional<int> ToAbslOptional(const std::optional<int>& value) {
+    if (!value) {
+        return absl::nullopt;
+    }
+    return absl::optional<int>(*value);
+}
+
+// 라인별 방향 분류 결과의 프레임 단위 다수결 (분류 결과가 없으면 nullopt)
+std::optional<int> MajorityAngle(const std::vector<int>& angles) {
+    std::map<int, int> votes;
+    for (int angle : angles) {
+        if (angle >= 0) {
+            ++votes[angle];
+        }
+    }
+    if (votes.empty()) {
+        return std::nullopt;
+    }
+    auto best = votes.begin();
+    for (auto it = votes.begin(); it != votes.end(); ++it) {
+        if (it->second > best->second) {
+            best = it;
+        }
+    }
+    return best->first;
+}
 }
 
 class PaddleOcrWrapper::Runtime {
@@ -56,9 +89,25 @@ public:
 
     bool Initialize(const PaddleOcrOptions& options);
     bool Predict(const cv::Mat& image, std::vector<TextSegment>& segments);
+    void ResetOrientation();
 
 private:
+    std::vector<std::vector<cv::Point2f>> FilterBoxes(const std::vector<std::vector<cv::Point2f>>& polys,
+                                                      const cv::Size& imageSize) const;
+    void UpdateOrientationPolicies(const OCRPipelineResult& result,
+                                   const std::optional<int>& docAngle,
+                                   const std::optional<int>& textlineAngle,
+                                   const std::vector<TextSegment>& segments);
+
     std::unique_ptr<_OCRPipeline> pipeline_;
+    std::unique_ptr<TextBoxFilter> boxFilter_;
+
+    // 게임 화면은 회전하지 않으므로 방향 분류 결과를 ROI 단위로 고정
+    bool stickyOrientation_ = false;
+    bool docOrientationActive_ = false;
+    bool textlineOrientationActive_ = false;
+    StickyOrientationPolicy docOrientationPolicy_;
+    StickyOrientationPolicy textlineOrientationPolicy_;
 };
 
 bool PaddleOcrWrapper::Runtime::Initialize(const PaddleOcrOptions& options) {
@@ -99,6 +148,9 @@ bool PaddleOcrWrapper::Runtime::Initialize(const PaddleOcrOptions& options) {
     params.use_doc_unwarping = false;
     params.use_textline_orientation = options.enableTextlineOrientation;
     params.text_recognition_batch_size = std::max(1, options.recBatchSize);
+    if (options.detTiling.enabled) {
+        params.text_detection_batch_size = std::max(1, options.detTiling.detBatchSize);
+    }
     params.lang = NormalizeLanguageCode(options.language);
     params.device = deviceToString(options.device);
     params.enable_mkldnn = options.enableMkldnn && Utility::IsMkldnnAvailable();
@@ -121,14 +173,129 @@ bool PaddleOcrWrapper::Runtime::Initialize(const PaddleOcrOptions& options) {
         return false;
     }
 
+    const auto modelSettings = pipeline_->GetModelSettings();
+    auto settingEnabled = [&modelSettings](const char* key) {
+        const auto it = modelSettings.find(key);
+        return it != modelSettings.end() && it->second;
+    };
+    if (options.boxFilter.enabled) {
+        boxFilter_ = std::make_unique<TextBoxFilter>(options.boxFilter);
+        pipeline_->SetBoxFilter([this](const std::vector<std::vector<cv::Point2f>>& polys,
+                                       const cv::Size& imageSize) {
+            return FilterBoxes(polys, imageSize);
+        });
+    }
+
+    if (options.detTiling.enabled) {
+        const TiledDetectionConfig tiling = options.detTiling;
+        pipeline_->SetDetectionTiling(
+            [tiling](const cv::Size& imageSize) {
+                return PlanDetectionTiles(imageSize, tiling);
+            },
+            [tiling](const std::vector<std::vector<DetectionQuad>>& tilePolys,
+                     const std::vector<cv::Rect>& tiles,
+                     const cv::Size& imageSize) {
+                return MergeTiledDetections(tilePolys, tiles, imageSize, tiling);
+            });
+        SPDLOG_INFO("검출 타일 분할 사용 (타일 {}px, 겹침 {}px, 배치 {})",
+                    tiling.tileSize, tiling.overlap, tiling.detBatchSize);
+    }
+
+    docOrientationActive_ = settingEnabled("use_doc_preprocessor");
+    textlineOrientationActive_ = settingEnabled("use_textline_orientation");
+    stickyOrientation_ = options.stickyOrientation;
+
+    OrientationPolicyConfig policyConfig;
+    policyConfig.warmupFrames = options.orientationWarmupFrames;
+    policyConfig.recheckIntervalFrames = options.orientationRecheckInterval;
+    policyConfig.recheckConfidence = options.orientationRecheckConfidence;
+    docOrientationPolicy_ = StickyOrientationPolicy(policyConfig);
+    textlineOrientationPolicy_ = StickyOrientationPolicy(policyConfig);
+
     SPDLOG_INFO("PaddleOCR cpp_infer 파이프라인 초기화 완료 (언어: {})", params.lang.value_or("ch"));
     return static_cast<bool>(pipeline_);
 }
 
+std::vector<std::vector<cv::Point2f>> PaddleOcrWrapper::Runtime::FilterBoxes(
+    const std::vector<std::vector<cv::Point2f>>& polys,
+    const cv::Size& imageSize) const {
+    if (!boxFilter_) {
+        return polys;
+    }
+
+    std::vector<cv::Rect> boxes;
+    boxes.reserve(polys.size());
+    for (const auto& poly : polys) {
+        boxes.push_back(poly.empty() ? cv::Rect() : cv::boundingRect(poly));
+    }
+
+    const auto kept = boxFilter_->Apply(boxes, imageSize);
+    if (kept.size() == polys.size()) {
+        return polys;
+    }
+
+    std::vector<std::vector<cv::Point2f>> filtered;
+    filtered.reserve(kept.size());
+    for (const auto index : kept) {
+        filtered.push_back(polys[index]);
+    }
+    SPDLOG_DEBUG("검출 박스 필터: {}개 중 {}개 인식 전 제외", polys.size(), polys.size() - kept.size());
+    return filtered;
+}
+
+void PaddleOcrWrapper::Runtime::ResetOrientation() {
+    docOrientationPolicy_.Reset();
+    textlineOrientationPolicy_.Reset();
+}
+
+void PaddleOcrWrapper::Runtime::UpdateOrientationPolicies(const OCRPipelineResult& result,
+                                                          const std::optional<int>& docAngle,
+                                                          const std::optional<int>& textlineAngle,
+                                                          const std::vector<TextSegment>& segments) {
+    if (docOrientationActive_ && !docAngle && result.doc_preprocessor_res.angle >= 0) {
+        docOrientationPolicy_.RecordObservation(result.doc_preprocessor_res.angle);
+        if (docOrientationPolicy_.IsLocked()) {
+            SPDLOG_DEBUG("문서 방향 고정: {}도", *docOrientationPolicy_.GetLockedAngle());
+        }
+    }
+    if (textlineOrientationActive_ && !textlineAngle) {
+        if (auto majority = MajorityAngle(result.textline_orientation_angles)) {
+            textlineOrientationPolicy_.RecordObservation(*majority);
+            if (textlineOrientationPolicy_.IsLocked()) {
+                SPDLOG_DEBUG("텍스트 라인 방향 고정: {}", *textlineOrientationPolicy_.GetLockedAngle());
+            }
+        }
+    }
+
+    // 텍스트가 없는 프레임은 신뢰도 판단에서 제외 (빈 화면 때문에 재분류하지 않도록)
+    if (segments.empty()) {
+        return;
+    }
+    float confidenceSum = 0.0f;
+    for (const auto& segment : segments) {
+        confidenceSum += segment.confidence;
+    }
+    const float meanConfidence = confidenceSum / static_cast<float>(segments.size());
+    docOrientationPolicy_.ReportConfidence(meanConfidence);
+    textlineOrientationPolicy_.ReportConfidence(meanConfidence);
+}
+
 bool PaddleOcrWrapper::Runtime::Predict(const cv::Mat& image, std::vector<TextSegment>& segments) {
     if (!pipeline_) {
         return false;
     }
+    std::optional<int> docAngle;
+    std::optional<int> textlineAngle;
+    if (stickyOrientation_) {
+        if (docOrientationActive_) {
+            docAngle = docOrientationPolicy_.AngleForFrame();
+        }
+        if (textlineOrientationActive_) {
+            textlineAngle = textlineOrientationPolicy_.AngleForFrame();
+        }
+    }
+    pipeline_->SetOrientationOverrides(ToAbslOptional(docAngle), ToAbslOptional(textlineAngle));
+
     std::vector<cv::Mat> inputs = {image};
     (void)pipeline_->Predict(inputs);
     const auto pipeline_results = pipeline_->PipelineResult();
@@ -162,10 +329,17 @@ bool PaddleOcrWrapper::Runtime::Predict(const cv::Mat& image, std::vector<TextSe
         if (bbox.width > 0 && bbox.height > 0) {
             ClampRect(bbox, image.size());
             segment.boundingBox = bbox;
+            if (i < result.rec_char_ranges.size()) {
+                segment.charBoxes = CharBoxesFromRanges(bbox, result.rec_char_ranges[i]);
+            }
         }
 
         segments.push_back(std::move(segment));
     }
+
+    if (stickyOrientation_) {
+        UpdateOrientationPolicies(result, docAngle, textlineAngle, segments);
+    }
     return true;
 }
 
@@ -263,6 +437,13 @@ std::string PaddleOcrWrapper::GetEngineName() const {
     return "PaddleOCR";
 }
 
+void PaddleOcrWrapper::OnRegionChanged() {
+    std::lock_guard<std::mutex> guard(runtimeMutex_);
+    if (runtime_) {
+        runtime_->ResetOrientation();
+    }
+}
+
 std::string PaddleOcrWrapper::GetLastError() const {
     std::lock_guard<std::mutex> guard(runtimeMutex_);
     return lastError_;
@@ -23,6 +23,7 @@ public:
     void Shutdown() override;
     bool IsInitialized() const override;
     std::string GetEngineName() const override;
+    void OnRegionChanged() override;
 
     /**
      * @brief 마지막 오류 메시지 (디버깅 용도)
@@ -0,0 +1,146 @@
+#include "core/ocr/text_box_filter.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace toriyomi {
+namespace ocr {
+
+namespace {
+// 루비 박스는 기준 라인과 가로로 이만큼 이상 겹쳐야 함 (루비 폭 기준)
+constexpr float kRubyMinHorizontalOverlap = 0.5f;
+// 루비 하단과 기준 라인 상단 사이 허용 간격 (기준 라인 높이 기준)
+constexpr float kRubyMaxGapRatio = 0.5f;
+}  // namespace
+
+TextBoxFilter::TextBoxFilter(TextBoxFilterConfig config)
+    : config_(config) {
+    config_.roiX = std::clamp(config_.roiX, 0.0f, 1.0f);
+    config_.roiY = std::clamp(config_.roiY, 0.0f, 1.0f);
+    config_.roiWidth = std::clamp(config_.roiWidth, 0.0f, 1.0f - config_.roiX);
+    config_.roiHeight = std::clamp(config_.roiHeight, 0.0f, 1.0f - config_.roiY);
+}
+
+void TextBoxFilter::AddRule(std::string name, Rule rule) {
+    if (rule) {
+        rules_.push_back({std::move(name), std::move(rule)});
+    }
+}
+
+std::vector<BoxRejectReason> TextBoxFilter::Evaluate(const std::vector<cv::Rect>& boxes,
+                                                     const cv::Size& imageSize) const {
+    std::vector<BoxRejectReason> reasons(boxes.size(), BoxRejectReason::None);
+    if (!config_.enabled) {
+        return reasons;
+    }
+
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        const cv::Rect& box = boxes[i];
+        if (FailsArea(box)) {
+            reasons[i] = BoxRejectReason::Area;
+        } else if (FailsAspect(box)) {
+            reasons[i] = BoxRejectReason::Aspect;
+        } else if (OutsideRoi(box, imageSize)) {
+            reasons[i] = BoxRejectReason::OutsideRoi;
+        } else if (config_.dropRuby && LooksLikeRuby(i, boxes)) {
+            reasons[i] = BoxRejectReason::Ruby;
+        } else {
+            for (const auto& named : rules_) {
+                if (named.rule(i, boxes, imageSize)) {
+                    reasons[i] = BoxRejectReason::Custom;
+                    break;
+                }
+            }
+        }
+    }
+    return reasons;
+}
+
+std::vector<std::size_t> TextBoxFilter::Apply(const std::vector<cv::Rect>& boxes,
+                                              const cv::Size& imageSize) const {
+    const auto reasons = Evaluate(boxes, imageSize);
+    std::vector<std::size_t> kept;
+    kept.reserve(boxes.size());
+    for (std::size_t i = 0; i < reasons.size(); ++i) {
+        if (reasons[i] == BoxRejectReason::None) {
+            kept.push_back(i);
+        }
+    }
+    return kept;
+}
+
+const TextBoxFilterConfig& TextBoxFilter::GetConfig() const {
+    return config_;
+}
+
+bool TextBoxFilter::FailsArea(const cv::Rect& box) const {
+    if (box.width <= 0 || box.height <= 0) {
+        return true;
+    }
+    if (std::min(box.width, box.height) < config_.minHeight) {
+        return true;
+    }
+    return box.area() < config_.minArea;
+}
+
+bool TextBoxFilter::FailsAspect(const cv::Rect& box) const {
+    if (config_.maxAspectRatio <= 0.0f) {
+        return false;
+    }
+    const float longSide = static_cast<float>(std::max(box.width, box.height));
+    const float shortSide = static_cast<float>(std::max(1, std::min(box.width, box.height)));
+    return longSide / shortSide > config_.maxAspectRatio;
+}
+
+bool TextBoxFilter::OutsideRoi(const cv::Rect& box, const cv::Size& imageSize) const {
+    if (imageSize.width <= 0 || imageSize.height <= 0) {
+        return false;
+    }
+    const bool fullFrame = config_.roiX <= 0.0f && config_.roiY <= 0.0f &&
+                           config_.roiWidth >= 1.0f && config_.roiHeight >= 1.0f;
+    if (fullFrame) {
+        return false;
+    }
+
+    const cv::Rect roi(static_cast<int>(config_.roiX * imageSize.width),
+                       static_cast<int>(config_.roiY * imageSize.height),
+                       static_cast<int>(config_.roiWidth * imageSize.width),
+                       static_cast<int>(config_.roiHeight * imageSize.height));
+    const int overlap = (box & roi).area();
+    return static_cast<float>(overlap) < config_.minRoiOverlap * static_cast<float>(box.area());
+}
+
+bool TextBoxFilter::LooksLikeRuby(std::size_t index, const std::vector<cv::Rect>& boxes) const {
+    const cv::Rect& candidate = boxes[index];
+    const int candidateBottom = candidate.y + candidate.height;
+
+    for (std::size_t j = 0; j < boxes.size(); ++j) {
+        if (j == index) {
+            continue;
+        }
+        const cv::Rect& base = boxes[j];
+        if (candidate.height >= base.height * config_.rubyHeightRatio) {
+            continue;
+        }
+        if (candidate.width > base.width) {
+            continue;
+        }
+
+        const int overlap = std::min(candidate.x + candidate.width, base.x + base.width) -
+                            std::max(candidate.x, base.x);
+        if (overlap < candidate.width * kRubyMinHorizontalOverlap) {
+            continue;
+        }
+
+        // 검출 박스는 unclip으로 부풀려져 있어 약간 겹칠 수 있음
+        const bool sitsAbove = candidateBottom <= base.y + base.height / 4;
+        const bool directlyAbove = base.y - candidateBottom <= base.height * kRubyMaxGapRatio;
+        if (sitsAbove && directlyAbove) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 검출 박스 필터 설정
+ *
+ * ROI는 입력 이미지 크기에 대한 정규화 좌표 (0.0 ~ 1.0) 입니다.
+ */
+struct TextBoxFilterConfig {
+    bool enabled = true;
+    int minArea = 400;               // 최소 박스 면적 (px^2)
+    int minHeight = 6;               // 최소 짧은 변 길이 (px)
+    float maxAspectRatio = 50.0f;    // 긴 변 / 짧은 변 최대 비율
+    float roiX = 0.0f;
+    float roiY = 0.0f;
+    float roiWidth = 1.0f;
+    float roiHeight = 1.0f;
+    float minRoiOverlap = 0.5f;      // ROI 안에 들어와야 하는 박스 면적 비율
+    bool dropRuby = true;            // 큰 라인 바로 위의 작은 박스(후리가나) 제거
+    float rubyHeightRatio = 0.6f;    // 기준 라인 높이 대비 루비 최대 높이 비율
+};
+
+/**
+ * @brief 박스가 제외된 이유
+ */
+enum class BoxRejectReason {
+    None,
+    Area,
+    Aspect,
+    OutsideRoi,
+    Ruby,
+    Custom
+};
+
+/**
+ * @brief 텍스트 검출과 인식 사이에서 동작하는 기하 필터
+ *
+ * 면적, 종횡비, ROI 포함 여부, "큰 라인 바로 위의 작은 박스" 규칙으로
+ * 후리가나와 UI 글리프를 인식 전에 걸러내 rec 크롭 수를 줄입니다.
+ * 추가 규칙은 AddRule()로 연결할 수 있습니다.
+ */
+class TextBoxFilter {
+public:
+    /**
+     * @brief 사용자 규칙 (true를 반환하면 해당 박스 제외)
+     */
+    using Rule = std::function<bool(std::size_t index,
+                                    const std::vector<cv::Rect>& boxes,
+                                    const cv::Size& imageSize)>;
+
+    explicit TextBoxFilter(TextBoxFilterConfig config = {});
+
+    /**
+     * @brief 사용자 규칙 추가 (기본 규칙 이후에 평가됨)
+     */
+    void AddRule(std::string name, Rule rule);
+
+    /**
+     * @brief 박스별 제외 사유 계산
+     *
+     * @param boxes 검출 박스 (입력 이미지 좌표)
+     * @param imageSize 입력 이미지 크기
+     * @return boxes와 같은 길이의 제외 사유 목록
+     */
+    std::vector<BoxRejectReason> Evaluate(const std::vector<cv::Rect>& boxes,
+                                          const cv::Size& imageSize) const;
+
+    /**
+     * @brief 통과한 박스의 인덱스 목록 (입력 순서 유지)
+     */
+    std::vector<std::size_t> Apply(const std::vector<cv::Rect>& boxes,
+                                   const cv::Size& imageSize) const;
+
+    const TextBoxFilterConfig& GetConfig() const;
+
+private:
+    bool FailsArea(const cv::Rect& box) const;
+    bool FailsAspect(const cv::Rect& box) const;
+    bool OutsideRoi(const cv::Rect& box, const cv::Size& imageSize) const;
+    bool LooksLikeRuby(std::size_t index, const std::vector<cv::Rect>& boxes) const;
+
+    struct NamedRule {
+        std::string name;
+        Rule rule;
+    };
+
+    TextBoxFilterConfig config_;
+    std::vector<NamedRule> rules_;
+};
+
+}  // namespace ocr
+}  // namespace toriyomi
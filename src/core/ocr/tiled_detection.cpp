@@ -0,0 +1,181 @@
+#include "core/ocr/tiled_detection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace toriyomi {
+namespace ocr {
+
+namespace {
+
+// 최소 overlap을 보장하는 타일 수를 구한 뒤 시작 위치를 균등 분배
+std::vector<int> AxisStarts(int length, int tile, int overlap) {
+    if (length <= tile) {
+        return {0};
+    }
+    const int stride = std::max(1, tile - overlap);
+    const int count = 1 + (length - tile + stride - 1) / stride;
+    std::vector<int> starts;
+    starts.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        starts.push_back(static_cast<int>(std::lround(static_cast<double>(i) * (length - tile) / (count - 1))));
+    }
+    return starts;
+}
+
+struct PlacedBox {
+    DetectionQuad quad;     // 프레임 좌표
+    cv::Rect rect;          // quad 외접 사각형
+    std::size_t tile = 0;
+    bool touchesSeam = false;
+};
+
+cv::Rect BoundsOf(const DetectionQuad& quad) {
+    float minX = quad.front().x;
+    float maxX = quad.front().x;
+    float minY = quad.front().y;
+    float maxY = quad.front().y;
+    for (const auto& point : quad) {
+        minX = std::min(minX, point.x);
+        maxX = std::max(maxX, point.x);
+        minY = std::min(minY, point.y);
+        maxY = std::max(maxY, point.y);
+    }
+    const int left = static_cast<int>(std::floor(minX));
+    const int top = static_cast<int>(std::floor(minY));
+    return cv::Rect(left, top,
+                    static_cast<int>(std::ceil(maxX)) - left + 1,
+                    static_cast<int>(std::ceil(maxY)) - top + 1);
+}
+
+// 프레임 가장자리가 아닌 타일 경계(= 이웃 타일이 있는 쪽)에 닿았는지
+bool TouchesInnerSeam(const cv::Rect& box, const cv::Rect& tile, const cv::Size& frame, int margin) {
+    const bool left = tile.x > 0 && box.x - tile.x <= margin;
+    const bool top = tile.y > 0 && box.y - tile.y <= margin;
+    const bool right = tile.x + tile.width < frame.width && tile.x + tile.width - (box.x + box.width) <= margin;
+    const bool bottom = tile.y + tile.height < frame.height && tile.y + tile.height - (box.y + box.height) <= margin;
+    return left || top || right || bottom;
+}
+
+int Overlap1D(int aBegin, int aLength, int bBegin, int bLength) {
+    return std::min(aBegin + aLength, bBegin + bLength) - std::max(aBegin, bBegin);
+}
+
+bool ShouldMerge(const PlacedBox& a, const PlacedBox& b, const TiledDetectionConfig& config) {
+    const cv::Rect intersection = a.rect & b.rect;
+    const int minArea = std::min(a.rect.area(), b.rect.area());
+    if (minArea > 0 && intersection.area() >= config.containThreshold * minArea) {
+        return true;
+    }
+    if (!a.touchesSeam || !b.touchesSeam) {
+        return false;
+    }
+
+    const int xOverlap = Overlap1D(a.rect.x, a.rect.width, b.rect.x, b.rect.width);
+    const int yOverlap = Overlap1D(a.rect.y, a.rect.height, b.rect.y, b.rect.height);
+    // 가로쓰기 라인이 세로 경계에서 잘린 경우
+    const int minHeight = std::min(a.rect.height, b.rect.height);
+    if (xOverlap >= -config.seamMargin && yOverlap >= config.lineOverlapRatio * minHeight) {
+        return true;
+    }
+    // 세로쓰기 열이 가로 경계에서 잘린 경우
+    const int minWidth = std::min(a.rect.width, b.rect.width);
+    return yOverlap >= -config.seamMargin && xOverlap >= config.lineOverlapRatio * minWidth;
+}
+
+std::size_t FindRoot(std::vector<std::size_t>& parents, std::size_t index) {
+    while (parents[index] != index) {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+    return index;
+}
+
+}  // namespace
+
+std::vector<cv::Rect> PlanDetectionTiles(const cv::Size& frame, const TiledDetectionConfig& config) {
+    const cv::Rect whole(0, 0, frame.width, frame.height);
+    if (!config.enabled || frame.width <= 0 || frame.height <= 0 ||
+        std::max(frame.width, frame.height) <= config.minFrameSide ||
+        config.tileSize <= 0 || config.overlap >= config.tileSize) {
+        return {whole};
+    }
+
+    const int tileWidth = std::min(config.tileSize, frame.width);
+    const int tileHeight = std::min(config.tileSize, frame.height);
+    std::vector<cv::Rect> tiles;
+    for (const int y : AxisStarts(frame.height, tileHeight, config.overlap)) {
+        for (const int x : AxisStarts(frame.width, tileWidth, config.overlap)) {
+            tiles.emplace_back(x, y, tileWidth, tileHeight);
+        }
+    }
+    return tiles;
+}
+
+std::vector<DetectionQuad> MergeTiledDetections(const std::vector<std::vector<DetectionQuad>>& tilePolys,
+                                                const std::vector<cv::Rect>& tiles,
+                                                const cv::Size& frame,
+                                                const TiledDetectionConfig& config) {
+    std::vector<PlacedBox> boxes;
+    for (std::size_t t = 0; t < tilePolys.size() && t < tiles.size(); ++t) {
+        const cv::Point2f offset(static_cast<float>(tiles[t].x), static_cast<float>(tiles[t].y));
+        for (const auto& poly : tilePolys[t]) {
+            if (poly.empty()) {
+                continue;
+            }
+            PlacedBox box;
+            box.quad.reserve(poly.size());
+            for (const auto& point : poly) {
+                box.quad.push_back(point + offset);
+            }
+            box.rect = BoundsOf(box.quad);
+            box.tile = t;
+            box.touchesSeam = TouchesInnerSeam(box.rect, tiles[t], frame, config.seamMargin);
+            boxes.push_back(std::move(box));
+        }
+    }
+
+    std::vector<std::size_t> parents(boxes.size());
+    std::iota(parents.begin(), parents.end(), 0);
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        for (std::size_t j = i + 1; j < boxes.size(); ++j) {
+            if (boxes[i].tile == boxes[j].tile) {
+                continue;
+            }
+            if (ShouldMerge(boxes[i], boxes[j], config)) {
+                parents[FindRoot(parents, j)] = FindRoot(parents, i);
+            }
+        }
+    }
+
+    std::vector<cv::Rect> groupBounds(boxes.size());
+    std::vector<std::size_t> groupSizes(boxes.size(), 0);
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        const std::size_t root = FindRoot(parents, i);
+        groupBounds[root] = groupSizes[root] == 0 ? boxes[i].rect : (groupBounds[root] | boxes[i].rect);
+        ++groupSizes[root];
+    }
+
+    std::vector<DetectionQuad> merged;
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        if (FindRoot(parents, i) != i) {
+            continue;
+        }
+        if (groupSizes[i] == 1) {
+            merged.push_back(std::move(boxes[i].quad));
+            continue;
+        }
+        const cv::Rect& bounds = groupBounds[i];
+        const float left = static_cast<float>(bounds.x);
+        const float top = static_cast<float>(bounds.y);
+        const float right = static_cast<float>(bounds.x + bounds.width - 1);
+        const float bottom = static_cast<float>(bounds.y + bounds.height - 1);
+        merged.push_back({cv::Point2f(left, top), cv::Point2f(right, top),
+                          cv::Point2f(right, bottom), cv::Point2f(left, bottom)});
+    }
+    return merged;
+}
+
+}  // namespace ocr
+}  // namespace toriyomi
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace toriyomi {
+namespace ocr {
+
+/**
+ * @brief 고해상도 프레임 타일 분할 검출 설정
+ */
+struct TiledDetectionConfig {
+    bool enabled = false;
+    int tileSize = 1280;            // 타일 한 변 (px)
+    int overlap = 192;              // 이웃 타일과 겹치는 폭 (가장 큰 글자 높이 이상 권장)
+    int minFrameSide = 1600;        // 긴 변이 이보다 클 때만 분할
+    int detBatchSize = 4;           // 검출 모델에 한 번에 넣을 타일 수
+    float containThreshold = 0.8f;  // 작은 박스 면적 대비 교차 면적이 이 이상이면 중복
+    float lineOverlapRatio = 0.6f;  // 경계에서 잘린 조각을 같은 라인으로 볼 최소 겹침 비율
+    int seamMargin = 4;             // 타일 경계에서 이 거리 안이면 "경계에 닿음"
+};
+
+using DetectionQuad = std::vector<cv::Point2f>;
+
+/**
+ * @brief 프레임을 겹치는 타일로 분할
+ *
+ * 모든 타일은 같은 크기이며(배치 추론용), 마지막 타일은 프레임 끝에 맞춥니다.
+ * 분할이 필요 없으면 프레임 전체 하나만 반환합니다.
+ */
+std::vector<cv::Rect> PlanDetectionTiles(const cv::Size& frame, const TiledDetectionConfig& config);
+
+/**
+ * @brief 타일별 검출 결과를 프레임 좌표로 합치고 경계 중복 제거
+ *
+ * - 겹침 영역에서 두 타일이 같은 박스를 찾은 경우 하나로 합칩니다.
+ * - 타일 경계에서 잘린 라인 조각은 같은 라인이면 외접 사각형으로 이어 붙입니다.
+ * 합쳐지지 않은 박스는 원래 사각형(회전 포함)을 그대로 유지합니다.
+ *
+ * @param tilePolys 타일 좌표계의 검출 결과 (tiles와 같은 순서)
+ * @param tiles PlanDetectionTiles() 결과
+ * @param frame 원본 프레임 크기
+ */
+std::vector<DetectionQuad> MergeTiledDetections(const std::vector<std::vector<DetectionQuad>>& tilePolys,
+                                                const std::vector<cv::Rect>& tiles,
+                                                const cv::Size& frame,
+                                                const TiledDetectionConfig& config);
+
+}  // namespace ocr
+}  // namespace toriyomi
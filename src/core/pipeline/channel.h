@@ -0,0 +1,187 @@
+// ToriYomi - 단계 간 채널
+// 크기 제한 큐: 가득 차면 생산자를 기다리게 하거나(역압) 가장 오래된 항목을 버림
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <algorithm>
+#include <utility>
+
+namespace toriyomi {
+namespace pipeline {
+
+/**
+ * @brief 채널이 가득 찼을 때의 동작
+ */
+enum class OverflowPolicy {
+    Block,          // 소비자가 꺼낼 때까지 생산자 대기 (느린 소비자가 생산 속도를 정함)
+    DropOldest      // 가장 오래된 항목을 버리고 넣음 (최신 값만 의미 있을 때)
+};
+
+/**
+ * @brief 채널 지표
+ */
+struct ChannelStats {
+    std::size_t depth = 0;
+    std::size_t peakDepth = 0;
+    std::uint64_t pushed = 0;
+    std::uint64_t popped = 0;
+    std::uint64_t dropped = 0;          // DropOldest로 버린 수
+    std::uint64_t blockedWaits = 0;     // 공간이 없어 기다린 횟수
+    double blockedMs = 0.0;             // 기다린 총 시간
+};
+
+/**
+ * @brief 스레드 안전 단방향 채널
+ *
+ * Close() 후에는 넣을 수 없고, 남은 항목을 다 꺼내면 Pop이 std::nullopt를 돌려줍니다.
+ * 기다리는 생산자/소비자는 Close()로 모두 깨어납니다.
+ */
+template <typename T>
+class Channel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit Channel(std::size_t capacity, OverflowPolicy policy = OverflowPolicy::Block)
+        : capacity_(std::max<std::size_t>(1, capacity))
+        , policy_(policy) {
+    }
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    /**
+     * @brief 항목 넣기 (Block 정책이면 공간이 날 때까지 대기)
+     *
+     * @return 채널이 닫혀 넣지 못했으면 false
+     */
+    bool Push(T value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (policy_ == OverflowPolicy::Block) {
+            WaitForSpaceLocked(lock, std::nullopt);
+        }
+        if (closed_) {
+            return false;
+        }
+        if (queue_.size() >= capacity_) {
+            queue_.pop_front();
+            ++stats_.dropped;
+        }
+        queue_.push_back(std::move(value));
+        ++stats_.pushed;
+        stats_.peakDepth = std::max(stats_.peakDepth, queue_.size());
+        lock.unlock();
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief 공간이 생길 때까지 대기 (만들기 비싼 항목을 미리 만들지 않도록 생산 전에 호출)
+     *
+     * @return 공간이 있으면 true, 시간 초과/닫힘이면 false
+     */
+    template <typename Rep, typename Period>
+    bool WaitForSpace(std::chrono::duration<Rep, Period> timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return WaitForSpaceLocked(lock, Clock::now() + std::chrono::duration_cast<Clock::duration>(timeout));
+    }
+
+    bool WaitForSpace() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return WaitForSpaceLocked(lock, std::nullopt);
+    }
+
+    /**
+     * @brief 항목 꺼내기 (비어 있으면 대기)
+     *
+     * @return 닫히고 비었으면 std::nullopt
+     */
+    std::optional<T> Pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this]() { return closed_ || !queue_.empty(); });
+        return PopLocked(lock);
+    }
+
+    template <typename Rep, typename Period>
+    std::optional<T> PopFor(std::chrono::duration<Rep, Period> timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait_for(lock, timeout, [this]() { return closed_ || !queue_.empty(); });
+        return PopLocked(lock);
+    }
+
+    void Close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        notEmpty_.notify_all();
+        notFull_.notify_all();
+    }
+
+    bool IsClosed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    std::size_t Size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
+    std::size_t Capacity() const { return capacity_; }
+
+    ChannelStats GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ChannelStats stats = stats_;
+        stats.depth = queue_.size();
+        return stats;
+    }
+
+private:
+    bool WaitForSpaceLocked(std::unique_lock<std::mutex>& lock, std::optional<Clock::time_point> deadline) {
+        auto hasSpace = [this]() { return closed_ || queue_.size() < capacity_; };
+        if (hasSpace()) {
+            return !closed_;
+        }
+        const auto started = Clock::now();
+        ++stats_.blockedWaits;
+        if (deadline) {
+            notFull_.wait_until(lock, *deadline, hasSpace);
+        } else {
+            notFull_.wait(lock, hasSpace);
+        }
+        stats_.blockedMs += std::chrono::duration<double, std::milli>(Clock::now() - started).count();
+        return !closed_ && queue_.size() < capacity_;
+    }
+
+    std::optional<T> PopLocked(std::unique_lock<std::mutex>& lock) {
+        if (queue_.empty()) {
+            return std::nullopt;
+        }
+        std::optional<T> value(std::move(queue_.front()));
+        queue_.pop_front();
+        ++stats_.popped;
+        lock.unlock();
+        notFull_.notify_one();
+        return value;
+    }
+
+    const std::size_t capacity_;
+    const OverflowPolicy policy_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+    std::deque<T> queue_;
+    bool closed_ = false;
+    ChannelStats stats_;
+};
+
+}  // namespace pipeline
+}  // namespace toriyomi
@@ -0,0 +1,60 @@
+// ToriYomi - 확정 문장 발행 순서 관리 구현
+
+#include "core/pipeline/final_sentence_sequencer.h"
+
+#include <algorithm>
+
+namespace toriyomi {
+namespace pipeline {
+
+std::uint64_t FinalSentenceSequencer::BeginSession() {
+    lastFinalSentenceId_ = 0;
+    return ++session_;
+}
+
+std::uint64_t FinalSentenceSequencer::Reserve(std::uint64_t sentenceId) {
+    Slot slot;
+    slot.ticket = ++nextTicket_;
+    slot.session = session_;
+    slot.sentenceId = sentenceId;
+    pending_.push_back(slot);
+    return slot.ticket;
+}
+
+std::vector<std::uint64_t> FinalSentenceSequencer::Complete(std::uint64_t ticket, bool cancelled) {
+    std::vector<std::uint64_t> released;
+    auto it = std::find_if(pending_.begin(), pending_.end(),
+        [ticket](const Slot& slot) { return slot.ticket == ticket; });
+    if (it == pending_.end()) {
+        return released;
+    }
+    it->ready = true;
+    it->cancelled = cancelled;
+
+    // 앞 순번이 끝날 때까지 뒤 순번은 기다림
+    while (!pending_.empty() && pending_.front().ready) {
+        const Slot slot = pending_.front();
+        pending_.pop_front();
+        if (slot.cancelled) {
+            continue;
+        }
+        if (slot.session == session_) {
+            lastFinalSentenceId_ = slot.sentenceId;
+        }
+        released.push_back(slot.ticket);
+    }
+    return released;
+}
+
+bool FinalSentenceSequencer::IsPartialStale(std::uint64_t session,
+                                            std::uint64_t sentenceId,
+                                            bool revision) const {
+    if (session != session_) {
+        return true;
+    }
+    return sentenceId < lastFinalSentenceId_ ||
+           (sentenceId == lastFinalSentenceId_ && !revision);
+}
+
+}  // namespace pipeline
+}  // namespace toriyomi
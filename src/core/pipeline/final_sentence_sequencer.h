@@ -0,0 +1,73 @@
+// ToriYomi - 확정 문장 발행 순서 관리
+// 분석이 끝나는 순서와 관계없이 확정 문장을 감지 순서대로 발행하고, 늦게 끝난 부분 문장 분석을 가려냄
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace toriyomi {
+namespace pipeline {
+
+/**
+ * @brief 확정 문장 발행 순번 + 세션별 마지막 확정 문장 추적
+ *
+ * 형태소 분석 작업 스레드가 여럿이면 확정 문장도 끝나는 순서가 뒤바뀔 수 있으므로,
+ * 분석을 요청할 때 순번을 받고 앞 순번이 모두 끝난 것만 순서대로 내보냅니다.
+ *
+ * 문장 ID는 파이프라인을 새로 만들 때마다 1부터 다시 시작하므로, 부분 문장의 신선도는
+ * (세션, 문장 ID) 쌍으로 판단합니다. 이전 세션의 확정 문장이 재시작 뒤에 발행돼도
+ * 새 세션의 기준은 바뀌지 않습니다.
+ *
+ * 스레드 안전하지 않습니다 (UI 스레드에서만 호출).
+ */
+class FinalSentenceSequencer {
+public:
+    /**
+     * @brief 새 파이프라인 세션 시작 (마지막 확정 문장 ID 초기화)
+     * @return 새 세션 번호
+     */
+    std::uint64_t BeginSession();
+    std::uint64_t GetSession() const { return session_; }
+
+    /**
+     * @brief 현재 세션의 확정 문장 분석 요청 시 발행 순번 발급
+     */
+    std::uint64_t Reserve(std::uint64_t sentenceId);
+
+    /**
+     * @brief 분석 완료(또는 취소) 반영
+     *
+     * @param ticket Reserve가 돌려준 순번
+     * @param cancelled 분석하지 않고 버리는지 (뒤 순번이 막히지 않도록 자리만 비움)
+     * @return 이제 발행할 순번들 (요청 순서, 취소된 순번 제외)
+     */
+    std::vector<std::uint64_t> Complete(std::uint64_t ticket, bool cancelled = false);
+
+    /**
+     * @brief 늦게 끝난 부분 문장 분석인지 (이전 세션이거나, 같은 문장이 이미 확정됐거나, 다음 문장이 확정됨)
+     */
+    bool IsPartialStale(std::uint64_t session, std::uint64_t sentenceId, bool revision) const;
+
+    std::uint64_t GetLastFinalSentenceId() const { return lastFinalSentenceId_; }
+    std::size_t GetPendingCount() const { return pending_.size(); }
+
+private:
+    struct Slot {
+        std::uint64_t ticket = 0;
+        std::uint64_t session = 0;
+        std::uint64_t sentenceId = 0;
+        bool ready = false;
+        bool cancelled = false;
+    };
+
+    std::deque<Slot> pending_;                  // 요청 순서 (앞에서부터 완료된 것만 발행)
+    std::uint64_t session_ = 0;
+    std::uint64_t nextTicket_ = 0;
+    std::uint64_t lastFinalSentenceId_ = 0;     // 현재 세션에서 마지막으로 발행한 확정 문장
+};
+
+}  // namespace pipeline
+}  // namespace toriyomi
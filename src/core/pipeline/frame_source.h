@@ -0,0 +1,45 @@
+// ToriYomi - 파이프라인 캡처 단계 인터페이스
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+namespace toriyomi {
+namespace pipeline {
+
+/**
+ * @brief 프레임 공급원 (창 캡처, 테스트용 가짜 화면 등)
+ *
+ * Pipeline의 캡처 스레드 하나에서만 CaptureFrame을 호출합니다.
+ */
+class FrameSource {
+public:
+    virtual ~FrameSource() = default;
+
+    /**
+     * @brief 캡처 준비 (실패하면 파이프라인이 시작되지 않음)
+     */
+    virtual bool Start() = 0;
+
+    virtual void Stop() = 0;
+
+    /**
+     * @brief 한 프레임 캡처
+     *
+     * @return 실패/시간 초과면 빈 Mat (잠시 뒤 다시 시도)
+     */
+    virtual cv::Mat CaptureFrame() = 0;
+
+    /**
+     * @brief 대상이 다른 창에 가려져 있는지 (알 수 없으면 false)
+     */
+    virtual bool IsOccluded() const { return false; }
+
+    /**
+     * @brief 마지막 실패가 화면 변화 없음(DXGI 시간 초과 등) 때문인지 (그렇다면 캡처 간격만큼 쉬고 재시도)
+     */
+    virtual bool LastCaptureUnchanged() const { return false; }
+};
+
+}  // namespace pipeline
+}  // namespace toriyomi
@@ -0,0 +1,595 @@
+// ToriYomi - 캡처 → OCR → 문장 파이프라인 구현
+
+#include "pipeline.h"
+#include "core/capture/frame_change_detector.h"
+#include "core/sentence/sentence_assembler.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace toriyomi {
+namespace pipeline {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief 구독자 목록 (호출은 복사본으로 락 밖에서)
+ */
+template <typename Callback>
+using SubscriberList = std::vector<std::pair<Pipeline::SubscriptionId, Callback>>;
+
+template <typename Callback>
+bool EraseSubscriber(SubscriberList<Callback>& list, Pipeline::SubscriptionId id) {
+    auto it = std::find_if(list.begin(), list.end(), [id](const auto& entry) { return entry.first == id; });
+    if (it == list.end()) {
+        return false;
+    }
+    list.erase(it);
+    return true;
+}
+
+double ElapsedMs(Clock::time_point from, Clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+}  // namespace
+
+struct Pipeline::Impl {
+    struct CapturedFrame {
+        std::uint64_t sequence = 0;
+        cv::Mat image;
+        bool settled = false;       // 변화가 멈춘 화면 (결과를 바로 확정)
+    };
+
+    struct RecognizedFrame {
+        std::shared_ptr<const ocr::OcrResult> result;
+        bool settled = false;
+    };
+
+    Impl(std::shared_ptr<FrameSource> frameSource,
+         std::shared_ptr<ocr::IOcrEngine> ocrEngine,
+         PipelineOptions pipelineOptions)
+        : source(std::move(frameSource))
+        , engine(std::move(ocrEngine))
+        , options(pipelineOptions)
+        , frames(pipelineOptions.frameQueueCapacity, OverflowPolicy::Block)
+        , results(pipelineOptions.resultQueueCapacity, OverflowPolicy::Block)
+        , pacer(MakePacerOptions(pipelineOptions))
+        , trigger(SettleTriggerOptions{pipelineOptions.ocrSettleTime, pipelineOptions.fallbackOcrInterval})
+        , roiChange(pipelineOptions.roiChange) {
+        assembler.SetCaptureIntervalSeconds(
+            static_cast<double>(std::max<long long>(1, pipelineOptions.captureInterval.count())) / 1000.0);
+    }
+
+    static capture::CapturePacerOptions MakePacerOptions(const PipelineOptions& pipelineOptions) {
+        capture::CapturePacerOptions pacerOptions;
+        pacerOptions.baseInterval = pipelineOptions.captureInterval;
+        pacerOptions.activeInterval = pipelineOptions.activeCaptureInterval;
+        pacerOptions.maxInterval = pipelineOptions.maxCaptureInterval;
+        pacerOptions.retryDelay = pipelineOptions.retryDelay;
+        return pacerOptions;
+    }
+
+    std::shared_ptr<FrameSource> source;
+    std::shared_ptr<ocr::IOcrEngine> engine;
+    PipelineOptions options;
+
+    Channel<CapturedFrame> frames;
+    Channel<RecognizedFrame> results;
+
+    // 생명주기
+    std::mutex lifecycleMutex;
+    bool started = false;
+    bool stopped = false;
+    std::atomic<bool> stopping{false};
+    std::thread captureThread;
+    std::thread ocrThread;
+    std::thread sentenceThread;
+
+    // 캡처 대기 (정지 시 바로 깨움)
+    std::mutex wakeMutex;
+    std::condition_variable wakeCv;
+
+    // 캡처 간격 조절 (OCR 스레드가 처리 시간을 알려 줌)
+    mutable std::mutex pacerMutex;
+    capture::CapturePacer pacer;
+
+    // 변화 감지 시 OCR 시점 (캡처 스레드에서만 사용, 통계는 stats에 복사)
+    std::atomic<bool> changeDetectionEnabled{false};
+    SettleTrigger trigger;
+    capture::FrameChangeDetector roiChange;     // 캡처 스레드에서만 사용
+
+    mutable std::mutex frameMutex;
+    cv::Mat latestFrame;
+    std::uint64_t latestFrameSequence = 0;
+
+    mutable std::mutex resultMutex;
+    std::shared_ptr<const ocr::OcrResult> latestResult;
+    std::uint64_t nextResultSequence = 1;   // OCR 스레드에서만 사용
+
+    std::mutex cropMutex;
+    cv::Rect cropRegion;
+    bool cropEnabled = false;
+    bool cropChanged = false;
+
+    // 문장 단계 (UI 스레드의 Mark*/Clear* 호출과 공유)
+    std::mutex sentenceMutex;
+    sentence::SentenceAssembler assembler;
+    sentence::TypewriterTracker typewriter;
+
+    std::mutex subscriberMutex;
+    SubscriptionId nextSubscriptionId = 1;
+    SubscriberList<SentenceCallback> sentenceSubscribers;
+    SubscriberList<OcrResultCallback> ocrSubscribers;
+    SubscriberList<StatsCallback> statsSubscribers;
+    LogCallback logCallback;
+
+    mutable std::mutex statsMutex;
+    PipelineStats stats;
+    double totalOcrMs = 0.0;
+    Clock::time_point lastStatsPublished;   // OCR 스레드에서만 사용
+    std::atomic<bool> sourceOccluded{false};
+
+    void CaptureLoop();
+    void OcrLoop();
+    void SentenceLoop();
+    bool WaitUntil(Clock::time_point deadline);
+    cv::Mat ApplyCrop(const cv::Mat& frame);
+    cv::Mat RoiView(const cv::Mat& frame);
+    void PublishStatsIfDue(Clock::time_point now);
+    PipelineStats SnapshotStats() const;
+
+    template <typename Callback>
+    SubscriberList<Callback> Snapshot(const SubscriberList<Callback>& list) {
+        std::lock_guard<std::mutex> lock(subscriberMutex);
+        return list;
+    }
+};
+
+Pipeline::Pipeline(std::shared_ptr<FrameSource> source,
+                   std::shared_ptr<ocr::IOcrEngine> engine,
+                   PipelineOptions options)
+    : pImpl_(std::make_unique<Impl>(std::move(source), std::move(engine), options)) {
+}
+
+Pipeline::~Pipeline() {
+    Stop();
+}
+
+bool Pipeline::Start() {
+    std::lock_guard<std::mutex> lock(pImpl_->lifecycleMutex);
+    if (pImpl_->started || pImpl_->stopped) {
+        return false;
+    }
+    if (!pImpl_->source || !pImpl_->engine || !pImpl_->engine->IsInitialized()) {
+        return false;
+    }
+    if (!pImpl_->source->Start()) {
+        return false;
+    }
+
+    pImpl_->started = true;
+    pImpl_->lastStatsPublished = Clock::now();
+    // 소비자부터 시작해 첫 프레임이 기다리지 않게 함
+    pImpl_->sentenceThread = std::thread(&Impl::SentenceLoop, pImpl_.get());
+    pImpl_->ocrThread = std::thread(&Impl::OcrLoop, pImpl_.get());
+    pImpl_->captureThread = std::thread(&Impl::CaptureLoop, pImpl_.get());
+    return true;
+}
+
+void Pipeline::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->lifecycleMutex);
+        if (pImpl_->stopped) {
+            return;
+        }
+        pImpl_->stopped = true;
+        if (!pImpl_->started) {
+            return;
+        }
+    }
+
+    // 채널을 모두 닫아 어느 단계가 다음 단계를 기다리고 있어도 깨어나게 한 뒤 생산자부터 종료
+    pImpl_->stopping = true;
+    pImpl_->frames.Close();
+    pImpl_->results.Close();
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->wakeMutex);
+    }
+    pImpl_->wakeCv.notify_all();
+
+    for (auto* thread : {&pImpl_->captureThread, &pImpl_->ocrThread, &pImpl_->sentenceThread}) {
+        if (thread->joinable()) {
+            thread->join();
+        }
+    }
+    pImpl_->source->Stop();
+}
+
+bool Pipeline::IsRunning() const {
+    std::lock_guard<std::mutex> lock(pImpl_->lifecycleMutex);
+    return pImpl_->started && !pImpl_->stopped;
+}
+
+Pipeline::SubscriptionId Pipeline::SubscribeSentences(SentenceCallback callback) {
+    std::lock_guard<std::mutex> lock(pImpl_->subscriberMutex);
+    const SubscriptionId id = pImpl_->nextSubscriptionId++;
+    pImpl_->sentenceSubscribers.emplace_back(id, std::move(callback));
+    return id;
+}
+
+Pipeline::SubscriptionId Pipeline::SubscribeOcrResults(OcrResultCallback callback) {
+    std::lock_guard<std::mutex> lock(pImpl_->subscriberMutex);
+    const SubscriptionId id = pImpl_->nextSubscriptionId++;
+    pImpl_->ocrSubscribers.emplace_back(id, std::move(callback));
+    return id;
+}
+
+Pipeline::SubscriptionId Pipeline::SubscribeStats(StatsCallback callback) {
+    std::lock_guard<std::mutex> lock(pImpl_->subscriberMutex);
+    const SubscriptionId id = pImpl_->nextSubscriptionId++;
+    pImpl_->statsSubscribers.emplace_back(id, std::move(callback));
+    return id;
+}
+
+void Pipeline::Unsubscribe(SubscriptionId id) {
+    std::lock_guard<std::mutex> lock(pImpl_->subscriberMutex);
+    EraseSubscriber(pImpl_->sentenceSubscribers, id) ||
+        EraseSubscriber(pImpl_->ocrSubscribers, id) ||
+        EraseSubscriber(pImpl_->statsSubscribers, id);
+}
+
+void Pipeline::SetLogCallback(LogCallback callback) {
+    std::lock_guard<std::mutex> lock(pImpl_->subscriberMutex);
+    pImpl_->logCallback = std::move(callback);
+}
+
+void Pipeline::SetCaptureInterval(std::chrono::milliseconds interval) {
+    const long long clamped = std::max<long long>(1, interval.count());
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->pacerMutex);
+        pImpl_->pacer.SetBaseInterval(std::chrono::milliseconds(clamped));
+    }
+    std::lock_guard<std::mutex> lock(pImpl_->sentenceMutex);
+    pImpl_->assembler.SetCaptureIntervalSeconds(static_cast<double>(clamped) / 1000.0);
+}
+
+void Pipeline::SetCropRegion(const cv::Rect& rect) {
+    std::lock_guard<std::mutex> lock(pImpl_->cropMutex);
+    if (!pImpl_->cropEnabled || !(pImpl_->cropRegion == rect)) {
+        pImpl_->cropChanged = true;
+    }
+    pImpl_->cropRegion = rect;
+    pImpl_->cropEnabled = true;
+}
+
+void Pipeline::ClearCropRegion() {
+    std::lock_guard<std::mutex> lock(pImpl_->cropMutex);
+    if (pImpl_->cropEnabled) {
+        pImpl_->cropChanged = true;
+    }
+    pImpl_->cropEnabled = false;
+}
+
+void Pipeline::SetTypewriterOptions(const sentence::TypewriterOptions& options) {
+    std::lock_guard<std::mutex> lock(pImpl_->sentenceMutex);
+    pImpl_->typewriter.SetOptions(options);
+}
+
+void Pipeline::SetChangeDetection(bool enable) {
+    pImpl_->changeDetectionEnabled = enable;
+}
+
+void Pipeline::MarkSentenceInFlight(std::string_view text) {
+    std::lock_guard<std::mutex> lock(pImpl_->sentenceMutex);
+    pImpl_->assembler.MarkSentenceInFlight(text);
+}
+
+void Pipeline::ClearSentenceInFlight(std::string_view text) {
+    std::lock_guard<std::mutex> lock(pImpl_->sentenceMutex);
+    pImpl_->assembler.ClearSentenceInFlight(text);
+}
+
+void Pipeline::MarkSentencePublished(std::string_view text) {
+    std::lock_guard<std::mutex> lock(pImpl_->sentenceMutex);
+    pImpl_->assembler.MarkSentencePublished(text);
+}
+
+void Pipeline::ResetSentences() {
+    std::lock_guard<std::mutex> lock(pImpl_->sentenceMutex);
+    pImpl_->assembler.Reset();
+    pImpl_->typewriter.Reset();
+}
+
+PipelineStats Pipeline::GetStats() const {
+    return pImpl_->SnapshotStats();
+}
+
+cv::Mat Pipeline::GetLatestFrame(std::uint64_t* sequence) const {
+    std::lock_guard<std::mutex> lock(pImpl_->frameMutex);
+    if (sequence) {
+        *sequence = pImpl_->latestFrameSequence;
+    }
+    return pImpl_->latestFrame;
+}
+
+std::shared_ptr<const ocr::OcrResult> Pipeline::GetLatestResult() const {
+    std::lock_guard<std::mutex> lock(pImpl_->resultMutex);
+    return pImpl_->latestResult;
+}
+
+// === Impl 메서드 구현 ===
+
+bool Pipeline::Impl::WaitUntil(Clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    wakeCv.wait_until(lock, deadline, [this]() { return stopping.load(); });
+    return !stopping;
+}
+
+void Pipeline::Impl::CaptureLoop() {
+    {
+        std::lock_guard<std::mutex> lock(pacerMutex);
+        pacer.Reset(Clock::now());
+    }
+    std::uint64_t sequence = 0;
+    bool triggerActive = false;
+    roiChange.Reset();
+    while (!stopping) {
+        // 역압: OCR이 앞 프레임을 가져갈 때까지 다음 캡처를 미룸 (기다린 뒤 찍어 최신 화면을 넘김)
+        Clock::time_point deadline;
+        {
+            std::lock_guard<std::mutex> lock(pacerMutex);
+            deadline = pacer.NextDeadline();
+        }
+        if (!frames.WaitForSpace() || !WaitUntil(deadline)) {
+            break;
+        }
+
+        cv::Mat frame = source->CaptureFrame();
+        sourceOccluded = source->IsOccluded();
+        const Clock::time_point now = Clock::now();
+        if (frame.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(statsMutex);
+                ++stats.captureFailures;
+            }
+            std::lock_guard<std::mutex> lock(pacerMutex);
+            pacer.OnCaptureFailed(source->LastCaptureUnchanged(), now);
+            continue;
+        }
+
+        // ROI 안쪽만 비교해 시계/효과 애니메이션 등 바깥 변화로 빨라지지 않게 하고,
+        // 압축 잡음 같은 작은 흔들림은 변화로 보지 않아 화면이 안정될 수 있게 함
+        const bool changed = roiChange.Update(RoiView(frame));
+        {
+            std::lock_guard<std::mutex> lock(pacerMutex);
+            pacer.OnFrame(changed, now);
+        }
+
+        ++sequence;
+        {
+            std::lock_guard<std::mutex> lock(frameMutex);
+            latestFrame = frame;
+            latestFrameSequence = sequence;
+        }
+
+        // 변화 감지: ROI가 멈춘 프레임(또는 주기 프레임)만 OCR로 보냄, 미리보기는 모든 프레임 사용
+        bool sendToOcr = true;
+        bool settled = false;
+        if (changeDetectionEnabled) {
+            // 막 켰으면 지금 화면도 한 번은 읽도록 변화로 취급
+            const bool justEnabled = !triggerActive;
+            if (justEnabled) {
+                trigger.Reset();
+                triggerActive = true;
+            }
+            const TriggerReason reason = trigger.Update(changed || justEnabled, now);
+            sendToOcr = reason != TriggerReason::None;
+            settled = reason == TriggerReason::Settled;
+        } else {
+            triggerActive = false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            ++stats.framesCaptured;
+            stats.trigger = trigger.GetStats();
+        }
+        if (!sendToOcr) {
+            continue;
+        }
+        if (!frames.Push({sequence, std::move(frame), settled})) {
+            break;
+        }
+    }
+}
+
+cv::Mat Pipeline::Impl::RoiView(const cv::Mat& frame) {
+    cv::Rect crop;
+    bool applyCrop = false;
+    {
+        std::lock_guard<std::mutex> lock(cropMutex);
+        crop = cropRegion;
+        applyCrop = cropEnabled;
+    }
+    if (applyCrop) {
+        const cv::Rect safeRect = crop & cv::Rect(0, 0, frame.cols, frame.rows);
+        if (safeRect.width > 0 && safeRect.height > 0) {
+            return frame(safeRect);
+        }
+    }
+    return frame;
+}
+
+cv::Mat Pipeline::Impl::ApplyCrop(const cv::Mat& frame) {
+    cv::Rect crop;
+    bool applyCrop = false;
+    bool regionChanged = false;
+    {
+        std::lock_guard<std::mutex> lock(cropMutex);
+        crop = cropRegion;
+        applyCrop = cropEnabled;
+        regionChanged = cropChanged;
+        cropChanged = false;
+    }
+
+    if (regionChanged) {
+        engine->OnRegionChanged();
+    }
+    if (applyCrop) {
+        const cv::Rect safeRect = crop & cv::Rect(0, 0, frame.cols, frame.rows);
+        if (safeRect.width > 0 && safeRect.height > 0) {
+            return frame(safeRect).clone();
+        }
+    }
+    return frame;
+}
+
+void Pipeline::Impl::OcrLoop() {
+    while (auto frame = frames.Pop()) {
+        if (stopping) {
+            break;
+        }
+
+        const cv::Mat image = ApplyCrop(frame->image);
+        const Clock::time_point started = Clock::now();
+        auto segments = engine->RecognizeText(image);
+        const Clock::time_point completed = Clock::now();
+        if (stopping) {
+            break;
+        }
+        if (!changeDetectionEnabled) {
+            // 변화 감지 중에는 캡처가 OCR로 가지 않으므로 캡처 간격을 OCR 속도에 묶지 않음
+            std::lock_guard<std::mutex> lock(pacerMutex);
+            pacer.OnOcrCompleted(completed - started);
+        }
+
+        auto result = std::make_shared<ocr::OcrResult>();
+        result->sequence = nextResultSequence++;
+        result->segments = std::move(segments);
+        result->completedAt = completed;
+        std::shared_ptr<const ocr::OcrResult> published = std::move(result);
+
+        {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            latestResult = published;
+        }
+        {
+            const double ocrMs = ElapsedMs(started, completed);
+            std::lock_guard<std::mutex> lock(statsMutex);
+            ++stats.framesRecognized;
+            totalOcrMs += ocrMs;
+            stats.lastOcrMs = ocrMs;
+            stats.averageOcrMs = totalOcrMs / static_cast<double>(stats.framesRecognized);
+        }
+
+        for (const auto& [id, callback] : Snapshot(ocrSubscribers)) {
+            callback(published);
+        }
+        if (!results.Push({published, frame->settled})) {
+            break;
+        }
+        PublishStatsIfDue(completed);
+    }
+}
+
+void Pipeline::Impl::SentenceLoop() {
+    while (auto result = results.Pop()) {
+        if (stopping) {
+            break;
+        }
+
+        std::vector<std::string> logs;
+        auto logHook = [&logs](const std::string& message) { logs.push_back(message); };
+        std::vector<sentence::TypewriterEvent> events;
+        std::uint64_t suppressed = 0;
+        {
+            std::lock_guard<std::mutex> lock(sentenceMutex);
+            const auto& ocrResult = *result->result;
+            const auto frameText = assembler.AssembleFrame(ocrResult.segments, logHook);
+            auto updates = typewriter.Update(frameText ? std::string_view(*frameText) : std::string_view(),
+                                             ocrResult.completedAt);
+            if (result->settled) {
+                // 화면이 멈춘 뒤 읽은 결과이므로 settleTime을 기다리지 않고 확정
+                auto flushed = typewriter.Flush();
+                updates.insert(updates.end(), std::make_move_iterator(flushed.begin()),
+                               std::make_move_iterator(flushed.end()));
+            }
+            for (auto& event : updates) {
+                // 백로그 깜빡임 등으로 최근 문장이 다시 보이면 부분/확정 모두 건너뜀
+                // (개정은 추적기가 같은 문장이 늘어난 것으로 판정한 것이므로 제외)
+                if (!event.revision && assembler.IsDuplicate(event.text)) {
+                    ++suppressed;
+                    continue;
+                }
+                events.push_back(std::move(event));
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            stats.sentenceEvents += events.size();
+            stats.duplicatesSuppressed += suppressed;
+        }
+
+        if (!logs.empty()) {
+            LogCallback log;
+            {
+                std::lock_guard<std::mutex> lock(subscriberMutex);
+                log = logCallback;
+            }
+            if (log) {
+                for (const auto& message : logs) {
+                    log(message);
+                }
+            }
+        }
+        if (!events.empty()) {
+            const auto subscribers = Snapshot(sentenceSubscribers);
+            for (const auto& event : events) {
+                for (const auto& [id, callback] : subscribers) {
+                    callback(event);
+                }
+            }
+        }
+    }
+}
+
+void Pipeline::Impl::PublishStatsIfDue(Clock::time_point now) {
+    if (now - lastStatsPublished < options.statsInterval) {
+        return;
+    }
+    lastStatsPublished = now;
+    const auto subscribers = Snapshot(statsSubscribers);
+    if (subscribers.empty()) {
+        return;
+    }
+    const PipelineStats snapshot = SnapshotStats();
+    for (const auto& [id, callback] : subscribers) {
+        callback(snapshot);
+    }
+}
+
+PipelineStats Pipeline::Impl::SnapshotStats() const {
+    PipelineStats snapshot;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        snapshot = stats;
+    }
+    const ChannelStats frameStats = frames.GetStats();
+    snapshot.frameQueueDepth = frameStats.depth;
+    snapshot.backpressureWaits = frameStats.blockedWaits;
+    snapshot.backpressureMs = frameStats.blockedMs;
+    snapshot.sourceOccluded = sourceOccluded;
+    {
+        std::lock_guard<std::mutex> lock(pacerMutex);
+        snapshot.pacing = pacer.GetStats();
+    }
+    return snapshot;
+}
+
+}  // namespace pipeline
+}  // namespace toriyomi
@@ -0,0 +1,151 @@
+// ToriYomi - 캡처 → OCR → 문장 파이프라인
+// 단계별 스레드를 채널로 잇고, 느린 단계의 역압을 캡처 속도까지 전달하며 시작/정지 순서를 관리
+
+#pragma once
+
+#include "core/capture/capture_pacer.h"
+#include "core/capture/frame_change_detector.h"
+#include "core/ocr/ocr_engine.h"
+#include "core/pipeline/channel.h"
+#include "core/pipeline/frame_source.h"
+#include "core/pipeline/settle_trigger.h"
+#include "core/sentence/typewriter_tracker.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace toriyomi {
+namespace pipeline {
+
+/**
+ * @brief 파이프라인 설정
+ */
+struct PipelineOptions {
+    std::chrono::milliseconds captureInterval{1000};    // 기준 캡처 간격 (마감 기준, 지연이 누적되지 않음)
+    std::chrono::milliseconds activeCaptureInterval{250};   // ROI 화면이 바뀌는 동안 (기준보다 길면 기준)
+    std::chrono::milliseconds maxCaptureInterval{3000};     // ROI 화면이 그대로일 때 백오프 상한
+    std::chrono::milliseconds retryDelay{10};           // 캡처 실패 후 재시도 간격
+    std::size_t frameQueueCapacity = 2;                 // 가득 차면 캡처가 OCR을 기다림
+    std::size_t resultQueueCapacity = 4;                // 가득 차면 OCR이 문장 단계를 기다림
+    std::chrono::milliseconds statsInterval{1000};      // 통계 구독자 호출 최소 간격
+    std::chrono::milliseconds ocrSettleTime{200};       // 변화 감지 시 ROI가 이만큼 그대로면 OCR
+    std::chrono::milliseconds fallbackOcrInterval{5000};    // 변화 감지 시 주기 OCR 간격 (0이면 사용 안 함)
+    capture::FrameChangeOptions roiChange;              // ROI 변화 판단 (캡처 간격 조절, 변화 감지 공용)
+};
+
+/**
+ * @brief 파이프라인 통계
+ */
+struct PipelineStats {
+    std::uint64_t framesCaptured = 0;
+    std::uint64_t captureFailures = 0;
+    std::uint64_t backpressureWaits = 0;    // OCR이 밀려 캡처가 기다린 횟수
+    double backpressureMs = 0.0;
+    std::size_t frameQueueDepth = 0;
+    std::uint64_t framesRecognized = 0;
+    double lastOcrMs = 0.0;
+    double averageOcrMs = 0.0;
+    std::uint64_t sentenceEvents = 0;
+    std::uint64_t duplicatesSuppressed = 0;
+    bool sourceOccluded = false;
+    capture::CapturePacingStats pacing;     // 캡처 간격 조절 결정
+    SettleTriggerStats trigger;             // 변화 감지 시 OCR 트리거 결정
+};
+
+/**
+ * @brief 캡처 → OCR → 문장 조립/타자기 추적 파이프라인
+ *
+ * 캡처, OCR, 문장 단계가 각자 스레드에서 돌고 크기 제한 채널(Block 정책)로 이어져
+ * OCR이 밀리면 캡처도 멈춥니다 (오래된 프레임을 쌓았다 버리지 않음).
+ * 캡처 간격은 CapturePacer가 ROI 화면 변화와 OCR 처리 시간에 맞춰 조절합니다.
+ * 변화 감지를 켜면 SettleTrigger가 ROI가 멈춘 프레임만 OCR로 보내고, 그 결과는 바로 확정합니다.
+ * 시작은 소비자부터, 정지는 생산자부터 진행하며 한 번 정지한 파이프라인은 다시 시작하지 않습니다.
+ *
+ * 구독 콜백은 단계 스레드에서 호출되므로 오래 걸리는 일은 다른 스레드로 넘겨야 하고,
+ * 콜백 안에서 Stop()을 부르면 안 됩니다.
+ */
+class Pipeline {
+public:
+    using SubscriptionId = std::uint64_t;
+    using SentenceCallback = std::function<void(const sentence::TypewriterEvent&)>;
+    using OcrResultCallback = std::function<void(std::shared_ptr<const ocr::OcrResult>)>;
+    using StatsCallback = std::function<void(const PipelineStats&)>;
+    using LogCallback = std::function<void(const std::string&)>;
+
+    Pipeline(std::shared_ptr<FrameSource> source,
+             std::shared_ptr<ocr::IOcrEngine> engine,
+             PipelineOptions options = {});
+    ~Pipeline();
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    /**
+     * @brief 공급원을 준비하고 문장 → OCR → 캡처 순으로 스레드 시작
+     *
+     * @return 공급원/엔진이 준비되지 않았거나 이미 시작/정지했으면 false
+     */
+    bool Start();
+
+    /**
+     * @brief 캡처 → OCR → 문장 순으로 멈추고 스레드 종료를 기다림 (여러 번 호출해도 됨)
+     */
+    void Stop();
+
+    bool IsRunning() const;
+
+    // 구독 (Start 전후 언제든 가능)
+    SubscriptionId SubscribeSentences(SentenceCallback callback);
+    SubscriptionId SubscribeOcrResults(OcrResultCallback callback);
+    SubscriptionId SubscribeStats(StatsCallback callback);
+    void Unsubscribe(SubscriptionId id);
+
+    /**
+     * @brief 문장 조립 중 의심 프레임 등 진단 메시지 (문장 스레드에서 호출)
+     */
+    void SetLogCallback(LogCallback callback);
+
+    // 실행 중 설정
+    void SetCaptureInterval(std::chrono::milliseconds interval);
+    void SetCropRegion(const cv::Rect& rect);
+    void ClearCropRegion();
+    void SetTypewriterOptions(const sentence::TypewriterOptions& options);
+
+    /**
+     * @brief 변화 감지 활성화/비활성화
+     *
+     * 활성화 시 모든 프레임을 OCR하지 않고, ROI가 바뀌다가 ocrSettleTime 동안 그대로일 때
+     * 한 번만 OCR합니다 (fallbackOcrInterval마다 한 번은 추가로 OCR).
+     * 안정된 화면의 결과이므로 타자기 추적을 기다리지 않고 바로 확정 문장을 내보냅니다.
+     *
+     * @param enable true면 활성화, false면 캡처한 모든 프레임을 OCR (기본)
+     */
+    void SetChangeDetection(bool enable);
+
+    // 토큰화 결과에 따른 중복 억제 상태 (UI 스레드 등 어디서든 호출 가능)
+    void MarkSentenceInFlight(std::string_view text);
+    void ClearSentenceInFlight(std::string_view text);
+    void MarkSentencePublished(std::string_view text);
+    void ResetSentences();
+
+    PipelineStats GetStats() const;
+
+    /**
+     * @brief 마지막으로 캡처한 프레임 (복사 없이 버퍼 공유, 읽기 전용)
+     *
+     * @param sequence 프레임 번호를 받을 포인터 (새 프레임마다 1씩 증가, 없으면 0)
+     */
+    cv::Mat GetLatestFrame(std::uint64_t* sequence = nullptr) const;
+
+    std::shared_ptr<const ocr::OcrResult> GetLatestResult() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+}  // namespace pipeline
+}  // namespace toriyomi
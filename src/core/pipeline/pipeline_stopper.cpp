@@ -0,0 +1,79 @@
+#include "core/pipeline/pipeline_stopper.h"
+
+#include <chrono>
+#include <utility>
+
+namespace toriyomi {
+namespace pipeline {
+
+PipelineStopper::~PipelineStopper() {
+    WaitAll();
+}
+
+void PipelineStopper::StopAsync(std::unique_ptr<Pipeline> pipeline,
+                                std::vector<StopStep> attachments,
+                                FinishedCallback onFinished) {
+    inFlight_.fetch_add(1);
+    auto task = std::async(std::launch::async,
+        [this, pipeline = std::move(pipeline), attachments = std::move(attachments),
+         onFinished = std::move(onFinished)]() mutable {
+            auto summary = StopNow(std::move(pipeline), std::move(attachments));
+            summary.remaining = inFlight_.fetch_sub(1) - 1;
+            if (onFinished) {
+                onFinished(summary);
+            }
+        });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 끝난 정리의 future는 작업 스레드 안에서 지울 수 없으므로 (자기 자신을 기다림) 다음 요청 때 정리
+    PruneFinished();
+    tasks_.push_back(std::move(task));
+}
+
+PipelineStopSummary PipelineStopper::StopNow(std::unique_ptr<Pipeline> pipeline,
+                                             std::vector<StopStep> attachments) {
+    PipelineStopSummary summary;
+
+    for (auto& step : attachments) {
+        if (step) {
+            step();
+            summary.attachmentsStopped = true;
+        }
+    }
+    attachments.clear();
+
+    if (pipeline) {
+        pipeline->Stop();
+        pipeline.reset();
+        summary.pipelineStopped = true;
+    }
+
+    return summary;
+}
+
+std::size_t PipelineStopper::InFlight() const {
+    return inFlight_.load();
+}
+
+void PipelineStopper::WaitAll() {
+    std::vector<std::future<void>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks.swap(tasks_);
+    }
+    for (auto& task : tasks) {
+        if (task.valid()) {
+            task.wait();
+        }
+    }
+}
+
+void PipelineStopper::PruneFinished() {
+    std::erase_if(tasks_, [](const std::future<void>& task) {
+        return !task.valid() ||
+               task.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+}
+
+}  // namespace pipeline
+}  // namespace toriyomi
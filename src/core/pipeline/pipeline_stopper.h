@@ -0,0 +1,76 @@
+// ToriYomi - 캡처 세션 정리
+// 파이프라인과 함께 멈출 부속 자원(오버레이 등)을 UI 스레드 밖에서 순서대로 멈추고 진행 중인 정리를 추적
+
+#pragma once
+
+#include "core/pipeline/pipeline.h"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace toriyomi {
+namespace pipeline {
+
+/**
+ * @brief 정리 한 건의 결과
+ */
+struct PipelineStopSummary {
+    bool attachmentsStopped = false;    // 부속 자원 정지 단계를 실행함
+    bool pipelineStopped = false;       // Pipeline::Stop을 실행함
+    std::size_t remaining = 0;          // 이 정리가 끝난 뒤에도 진행 중인 정리 수
+};
+
+/**
+ * @brief 캡처 세션을 멈추는 쪽 (세션 하나가 아니라 앱 전체에서 하나)
+ *
+ * 부속 자원 → 파이프라인 순으로 멈춥니다. 파이프라인 안의 캡처 → OCR → 문장 순서와 스레드 대기는
+ * Pipeline::Stop이 처리합니다. 멈춘 자원은 작업 스레드에서 해제되고, 소멸자는 진행 중인 정리를
+ * 모두 기다립니다.
+ */
+class PipelineStopper {
+public:
+    using StopStep = std::function<void()>;
+    using FinishedCallback = std::function<void(const PipelineStopSummary&)>;
+
+    PipelineStopper() = default;
+    ~PipelineStopper();
+
+    PipelineStopper(const PipelineStopper&) = delete;
+    PipelineStopper& operator=(const PipelineStopper&) = delete;
+
+    /**
+     * @brief 작업 스레드에서 정리하고 끝나면 onFinished 호출 (작업 스레드에서 호출됨)
+     *
+     * @param attachments 파이프라인보다 먼저 실행할 정지 단계 (자원을 캡처해 소유해도 됨)
+     */
+    void StopAsync(std::unique_ptr<Pipeline> pipeline,
+                   std::vector<StopStep> attachments,
+                   FinishedCallback onFinished);
+
+    /**
+     * @brief 호출한 스레드에서 바로 정리 (시작 실패 직후처럼 스레드가 거의 없을 때)
+     */
+    static PipelineStopSummary StopNow(std::unique_ptr<Pipeline> pipeline,
+                                       std::vector<StopStep> attachments = {});
+
+    std::size_t InFlight() const;
+
+    /**
+     * @brief 진행 중인 정리가 모두 끝날 때까지 대기 (onFinished 호출까지 포함)
+     */
+    void WaitAll();
+
+private:
+    void PruneFinished();
+
+    mutable std::mutex mutex_;
+    std::vector<std::future<void>> tasks_;
+    std::atomic<std::size_t> inFlight_{0};
+};
+
+}  // namespace pipeline
+}  // namespace toriyomi
@@ -0,0 +1,57 @@
+// ToriYomi - 화면 안정 시 OCR 트리거 구현
+
+#include "core/pipeline/settle_trigger.h"
+
+namespace toriyomi {
+namespace pipeline {
+
+SettleTrigger::SettleTrigger(SettleTriggerOptions options)
+    : options_(options) {
+}
+
+void SettleTrigger::SetOptions(const SettleTriggerOptions& options) {
+    options_ = options;
+}
+
+TriggerReason SettleTrigger::Update(bool changed, Clock::time_point now) {
+    ++stats_.framesSeen;
+    if (!started_) {
+        // 주기 요청은 첫 프레임부터 셈
+        started_ = true;
+        lastTrigger_ = now;
+    }
+    if (changed) {
+        ++stats_.changedFrames;
+        pendingChange_ = true;
+        lastChange_ = now;
+    }
+
+    if (pendingChange_ && !changed && now - lastChange_ >= options_.settleTime) {
+        pendingChange_ = false;
+        lastTrigger_ = now;
+        ++stats_.settledTriggers;
+        return TriggerReason::Settled;
+    }
+
+    // 계속 바뀌는 화면에서도 한 번씩은 읽고, 안정된 화면도 가끔 다시 읽어 놓친 변화를 보정
+    const bool fallbackDue = options_.fallbackInterval.count() > 0 &&
+        now - lastTrigger_ >= options_.fallbackInterval;
+    if (fallbackDue) {
+        lastTrigger_ = now;
+        ++stats_.fallbackTriggers;
+        return TriggerReason::Fallback;
+    }
+
+    ++stats_.framesHeld;
+    return TriggerReason::None;
+}
+
+void SettleTrigger::Reset() {
+    pendingChange_ = false;
+    started_ = false;
+    lastChange_ = {};
+    lastTrigger_ = {};
+}
+
+}  // namespace pipeline
+}  // namespace toriyomi
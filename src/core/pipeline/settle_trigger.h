@@ -0,0 +1,87 @@
+// ToriYomi - 화면 안정 시 OCR 트리거
+// ROI가 바뀌다가 멈추면 한 번만 OCR을 요청하고, 오래 요청이 없으면 느린 주기로 한 번씩 요청
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace toriyomi {
+namespace pipeline {
+
+/**
+ * @brief 트리거 설정
+ */
+struct SettleTriggerOptions {
+    // 마지막 변화 뒤 이 시간 이상 지나서 찍은 프레임이 그대로면 OCR (글자가 다 나타났다고 봄)
+    std::chrono::milliseconds settleTime{200};
+    // 안정되지 않거나(애니메이션 등) 변화가 없어도 이 간격으로 한 번은 OCR (0이면 사용 안 함)
+    std::chrono::milliseconds fallbackInterval{5000};
+};
+
+/**
+ * @brief OCR을 요청한 이유
+ */
+enum class TriggerReason {
+    None,       // 요청하지 않음 (변화 중이거나 이미 읽은 화면)
+    Settled,    // 변화가 멈춤
+    Fallback    // 주기 요청
+};
+
+/**
+ * @brief 트리거 통계
+ */
+struct SettleTriggerStats {
+    std::uint64_t framesSeen = 0;
+    std::uint64_t changedFrames = 0;
+    std::uint64_t settledTriggers = 0;
+    std::uint64_t fallbackTriggers = 0;
+    std::uint64_t framesHeld = 0;       // OCR로 보내지 않은 프레임
+};
+
+/**
+ * @brief 캡처와 OCR 사이에서 OCR 시점을 정하는 트리거
+ *
+ * 고정 간격 OCR은 반쯤 나타난 문장을 읽거나 다 나타난 뒤에도 한참 기다리므로,
+ * 프레임마다 ROI 변화 여부만 받아 변화가 멈춘 순간에 한 번만 OCR을 요청합니다.
+ * 문장 하나에 여러 번 돌던 OCR이 한 번으로 줄어듭니다.
+ *
+ * 시각은 호출하는 쪽이 넘겨 주므로 테스트에서 가짜 시계를 쓸 수 있습니다.
+ * 스레드 안전하지 않습니다 (캡처 스레드에서 순서대로 호출).
+ */
+class SettleTrigger {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit SettleTrigger(SettleTriggerOptions options = {});
+
+    void SetOptions(const SettleTriggerOptions& options);
+    const SettleTriggerOptions& GetOptions() const { return options_; }
+
+    /**
+     * @brief 새 프레임 반영
+     *
+     * @param changed 직전 프레임과 ROI 내용이 다른지 (첫 프레임은 true로 넘김)
+     * @param now 프레임 시각
+     * @return 이 프레임으로 OCR을 돌려야 하면 그 이유, 아니면 TriggerReason::None
+     */
+    TriggerReason Update(bool changed, Clock::time_point now);
+
+    /**
+     * @brief 상태 초기화 (ROI 변경 등, 다음 안정 화면을 새로 읽음)
+     */
+    void Reset();
+
+    SettleTriggerStats GetStats() const { return stats_; }
+
+private:
+    SettleTriggerOptions options_;
+    bool pendingChange_ = false;        // 마지막 요청 뒤 변화가 있었는지
+    bool started_ = false;
+    Clock::time_point lastChange_{};
+    Clock::time_point lastTrigger_{};
+    SettleTriggerStats stats_;
+};
+
+}  // namespace pipeline
+}  // namespace toriyomi
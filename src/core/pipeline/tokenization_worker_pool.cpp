@@ -0,0 +1,138 @@
+// ToriYomi - 형태소 분석 작업 풀 구현
+
+#include "tokenization_worker_pool.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace toriyomi {
+namespace pipeline {
+
+TokenizationWorkerPool::TokenizationWorkerPool(TokenizationWorkerPoolOptions options)
+    : options_(options) {
+    options_.workerCount = std::max<std::size_t>(1, options_.workerCount);
+    options_.maxQueueDepth = std::max<std::size_t>(1, options_.maxQueueDepth);
+    workers_.reserve(options_.workerCount);
+    for (std::size_t i = 0; i < options_.workerCount; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+TokenizationWorkerPool::~TokenizationWorkerPool() {
+    Shutdown();
+}
+
+bool TokenizationWorkerPool::Submit(TokenizationJob job) {
+    std::vector<TokenizationJob> cancelled;
+    bool accepted = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            cancelled.push_back(std::move(job));
+        } else {
+            accepted = true;
+            // 같은 문장의 이전 부분 분석, 이전 문장의 부분 분석은 더 이상 보여줄 일이 없음
+            for (auto it = partials_.begin(); it != partials_.end();) {
+                if (it->job.key <= job.key) {
+                    cancelled.push_back(std::move(it->job));
+                    it = partials_.erase(it);
+                    ++metrics_.superseded;
+                } else {
+                    ++it;
+                }
+            }
+
+            const bool supersedable = job.supersedable;
+            auto& queue = supersedable ? partials_ : finals_;
+            queue.push_back({std::move(job), Clock::now()});
+            ++metrics_.submitted;
+
+            // 넘치면 가장 오래된 부분 분석부터 버림 (확정 분석은 버리지 않음)
+            while (partials_.size() > options_.maxQueueDepth) {
+                cancelled.push_back(std::move(partials_.front().job));
+                partials_.pop_front();
+                ++metrics_.dropped;
+            }
+            metrics_.peakQueueDepth = std::max(metrics_.peakQueueDepth, finals_.size() + partials_.size());
+        }
+    }
+
+    for (auto& dropped : cancelled) {
+        if (dropped.cancel) {
+            dropped.cancel();
+        }
+    }
+    cv_.notify_one();
+    return accepted;
+}
+
+void TokenizationWorkerPool::Shutdown() {
+    std::deque<QueuedJob> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_ && workers_.empty()) {
+            return;
+        }
+        stopping_ = true;
+        pending.swap(finals_);
+        std::move(partials_.begin(), partials_.end(), std::back_inserter(pending));
+        partials_.clear();
+        metrics_.dropped += pending.size();
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+
+    for (auto& queued : pending) {
+        if (queued.job.cancel) {
+            queued.job.cancel();
+        }
+    }
+}
+
+TokenizationWorkerPoolMetrics TokenizationWorkerPool::GetMetrics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TokenizationWorkerPoolMetrics metrics = metrics_;
+    metrics.queueDepth = finals_.size() + partials_.size();
+    return metrics;
+}
+
+void TokenizationWorkerPool::WorkerLoop() {
+    while (true) {
+        QueuedJob queued;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stopping_ || !finals_.empty() || !partials_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            // 확정 문장은 들어온 순서대로, 부분 문장은 최신 것부터
+            if (!finals_.empty()) {
+                queued = std::move(finals_.front());
+                finals_.pop_front();
+            } else {
+                queued = std::move(partials_.back());
+                partials_.pop_back();
+            }
+        }
+
+        if (queued.job.run) {
+            queued.job.run();
+        }
+
+        const double latencyMs =
+            std::chrono::duration<double, std::milli>(Clock::now() - queued.submittedAt).count();
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++metrics_.completed;
+        totalLatencyMs_ += latencyMs;
+        metrics_.averageLatencyMs = totalLatencyMs_ / static_cast<double>(metrics_.completed);
+        metrics_.maxLatencyMs = std::max(metrics_.maxLatencyMs, latencyMs);
+    }
+}
+
+}  // namespace pipeline
+}  // namespace toriyomi
@@ -0,0 +1,110 @@
+// ToriYomi - 형태소 분석 작업 풀
+// 문장마다 스레드를 만들지 않고 고정 작업 스레드와 크기 제한 큐로 분석 작업을 처리
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace toriyomi {
+namespace pipeline {
+
+/**
+ * @brief 작업 풀 설정
+ */
+struct TokenizationWorkerPoolOptions {
+    std::size_t workerCount = 2;
+    std::size_t maxQueueDepth = 8;      // 대기 중인 부분 문장 작업 상한 (넘치면 오래된 것부터 버림)
+};
+
+/**
+ * @brief 작업 풀 지표 (지연은 제출부터 실행 완료까지)
+ */
+struct TokenizationWorkerPoolMetrics {
+    std::size_t queueDepth = 0;
+    std::size_t peakQueueDepth = 0;
+    std::uint64_t submitted = 0;
+    std::uint64_t completed = 0;
+    std::uint64_t superseded = 0;       // 같은/새 문장의 작업에 밀려 취소
+    std::uint64_t dropped = 0;          // 부분 문장 큐가 넘쳐 취소, 또는 종료 시 취소
+    double averageLatencyMs = 0.0;
+    double maxLatencyMs = 0.0;
+};
+
+/**
+ * @brief 작업 하나
+ *
+ * key는 문장 ID처럼 단조 증가하는 값입니다. supersedable 작업(부분 문장)은 key가 같거나 더 큰
+ * 작업이 들어오면 아직 시작하지 않았을 때 취소됩니다. supersedable이 아닌 작업(확정 문장)은
+ * 취소되지 않습니다 (Shutdown 제외).
+ */
+struct TokenizationJob {
+    std::uint64_t key = 0;
+    bool supersedable = false;
+    std::function<void()> run;
+    std::function<void()> cancel;       // 실행하지 않고 버릴 때 (Submit/Shutdown을 부른 스레드에서 호출)
+};
+
+/**
+ * @brief 고정 작업 스레드 + 확정 작업 FIFO 큐 + 부분 작업 최신 우선 큐
+ *
+ * 대사를 빨리 넘길 때 문장마다 스레드가 몰려 생기던 부하를 막기 위해 고정 스레드로 실행합니다.
+ * 확정 문장 작업은 들어온 순서대로 먼저 실행하고 버리지 않으며, 부분 문장 작업은 남는 시간에
+ * 가장 최근 것부터 실행하고 밀려난 것은 실행하지 않습니다.
+ * 작업 스레드가 여럿이면 확정 작업도 끝나는 순서는 다를 수 있으므로 발행 순서는 호출하는 쪽이 맞춥니다.
+ */
+class TokenizationWorkerPool {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit TokenizationWorkerPool(TokenizationWorkerPoolOptions options = {});
+    ~TokenizationWorkerPool();
+
+    TokenizationWorkerPool(const TokenizationWorkerPool&) = delete;
+    TokenizationWorkerPool& operator=(const TokenizationWorkerPool&) = delete;
+
+    /**
+     * @brief 작업 제출
+     *
+     * @return 종료 중이라 받지 못했으면 false (cancel 호출됨)
+     */
+    bool Submit(TokenizationJob job);
+
+    /**
+     * @brief 대기 중인 작업을 취소하고 실행 중인 작업이 끝나길 기다린 뒤 스레드 종료
+     */
+    void Shutdown();
+
+    TokenizationWorkerPoolMetrics GetMetrics() const;
+    std::size_t WorkerCount() const { return workers_.size(); }
+
+private:
+    struct QueuedJob {
+        TokenizationJob job;
+        Clock::time_point submittedAt;
+    };
+
+    void WorkerLoop();
+
+    TokenizationWorkerPoolOptions options_;
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<QueuedJob> finals_;      // 확정 작업 (앞에서 꺼냄)
+    std::deque<QueuedJob> partials_;    // 부분 작업 (뒤쪽이 최신, 뒤에서 꺼냄)
+    bool stopping_ = false;
+
+    TokenizationWorkerPoolMetrics metrics_;
+    double totalLatencyMs_ = 0.0;
+};
+
+}  // namespace pipeline
+}  // namespace toriyomi
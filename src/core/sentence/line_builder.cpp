@@ -0,0 +1,374 @@
+// ToriYomi - 줄 조립 구현
+
+#include "line_builder.h"
+#include "core/ocr/ocr_engine.h"
+#include "common/text/unicode_utils.h"
+#include <algorithm>
+#include <tuple>
+
+namespace toriyomi {
+namespace sentence {
+
+namespace {
+
+/**
+ * @brief 가로쓰기 기준 좌표로 옮긴 상자 (세로쓰기면 x' = y, y' = -(x + width))
+ *
+ * 세로쓰기 열은 가로 줄이 되고, 오른쪽 열일수록 위쪽 줄, 열 오른쪽의 루비는 줄 위쪽이 됩니다.
+ */
+struct Item {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    std::size_t index = 0;      // 입력 상자 번호
+    bool rubyCandidate = false;
+
+    int Right() const { return x + width; }
+    int Bottom() const { return y + height; }
+    int CenterX() const { return x + width / 2; }
+    int CenterY() const { return y + height / 2; }
+};
+
+/**
+ * @brief 중심 높이가 비슷한 상자 묶음 (다단이면 여러 단의 줄이 한 묶음에 들어옴)
+ */
+struct Band {
+    int anchorY = 0;                // 첫 상자(가장 위)의 중심
+    std::vector<Item> items;        // x 순
+};
+
+/**
+ * @brief 줄 묶음 안의 큰 간격 (단 경계 후보)
+ */
+struct Gutter {
+    int left = 0;                   // 간격 왼쪽 상자들의 오른쪽 끝
+    int right = 0;                  // 간격 오른쪽 첫 상자의 x
+    std::size_t item = 0;           // 간격 오른쪽 첫 상자 번호 (묶음 안)
+    std::size_t runBefore = 1;      // 이 묶음까지 같은 자리에 간격이 이어진 묶음 수
+    std::size_t runAfter = 1;       // 이 묶음부터 이어지는 묶음 수
+};
+
+bool Overlaps(const Gutter& lhs, const Gutter& rhs) {
+    return lhs.left < rhs.right && rhs.left < lhs.right;
+}
+
+/**
+ * @brief 한 단 안의 한 줄
+ */
+struct Piece {
+    std::size_t band = 0;
+    int left = 0;
+    int right = 0;
+    std::size_t column = 0;
+    std::vector<Item> items;
+};
+
+bool IsPunctuation(char32_t cp) {
+    if (cp < 0x80) {
+        return (cp >= 0x21 && cp <= 0x2F) || (cp >= 0x3A && cp <= 0x40) ||
+               (cp >= 0x5B && cp <= 0x60) || (cp >= 0x7B && cp <= 0x7E);
+    }
+    if ((cp >= 0x2010 && cp <= 0x2027) || (cp >= 0x2030 && cp <= 0x205E)) {
+        return true;
+    }
+    if ((cp >= 0xFF01 && cp <= 0xFF0F) || (cp >= 0xFF1A && cp <= 0xFF20) ||
+        (cp >= 0xFF3B && cp <= 0xFF40) || (cp >= 0xFF5B && cp <= 0xFF65)) {
+        return true;
+    }
+    return text::ClassifyCodePoint(cp) == text::Script::Punctuation;
+}
+
+/**
+ * @brief 영문 단어끼리 이어 붙일 때만 공백 삽입
+ */
+bool NeedsSpace(std::string_view left, std::string_view right) {
+    auto isAscii = [](std::string_view value) {
+        for (std::size_t pos = 0; pos < value.size();) {
+            const char32_t cp = text::DecodeUtf8(value, pos);
+            if (text::IsWhitespace(cp)) {
+                continue;
+            }
+            if (cp < 0x2E80) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (left.empty() || right.empty()) {
+        return false;
+    }
+
+    std::size_t leftPos = text::PreviousUtf8Start(left, left.size());
+    std::size_t rightPos = 0;
+    const char32_t leftLast = text::DecodeUtf8(left, leftPos);
+    const char32_t rightFirst = text::DecodeUtf8(right, rightPos);
+    if (text::IsWhitespace(leftLast) || IsPunctuation(leftLast)) {
+        return false;
+    }
+    if (text::IsWhitespace(rightFirst) || IsPunctuation(rightFirst)) {
+        return false;
+    }
+    return isAscii(left) && isAscii(right);
+}
+
+bool AllKana(std::string_view value) {
+    for (std::size_t pos = 0; pos < value.size();) {
+        if (!text::IsKana(text::DecodeUtf8(value, pos))) {
+            return false;
+        }
+    }
+    return !value.empty();
+}
+
+Item ToCanonical(const cv::Rect& box, bool vertical, std::size_t index) {
+    Item item;
+    item.index = index;
+    if (vertical) {
+        item.x = box.y;
+        item.y = -(box.x + box.width);
+        item.width = box.height;
+        item.height = box.width;
+    } else {
+        item.x = box.x;
+        item.y = box.y;
+        item.width = box.width;
+        item.height = box.height;
+    }
+    return item;
+}
+
+/**
+ * @brief 중심 y 순으로 훑어 줄 묶음을 만듦 (정렬 한 번, 입력 순서와 무관)
+ */
+std::vector<Band> GroupBands(std::vector<Item> items, int tolerance) {
+    std::sort(items.begin(), items.end(), [](const Item& lhs, const Item& rhs) {
+        return std::make_tuple(lhs.CenterY(), lhs.x, lhs.index) < std::make_tuple(rhs.CenterY(), rhs.x, rhs.index);
+    });
+
+    std::vector<Band> bands;
+    for (const auto& item : items) {
+        if (bands.empty() || item.CenterY() - bands.back().anchorY > tolerance) {
+            bands.push_back({item.CenterY(), {}});
+        }
+        bands.back().items.push_back(item);
+    }
+    for (auto& band : bands) {
+        std::sort(band.items.begin(), band.items.end(), [](const Item& lhs, const Item& rhs) {
+            return std::tie(lhs.x, lhs.index) < std::tie(rhs.x, rhs.index);
+        });
+    }
+    return bands;
+}
+
+/**
+ * @brief 후보가 바탕 글자 위에 얹힌 루비인지 (가로로 40% 이상 겹치고 바탕 아래 1/3보다 위)
+ */
+bool SitsAboveAsRuby(const Item& candidate, const Item& base) {
+    const int overlap = std::min(candidate.Right(), base.Right()) - std::max(candidate.x, base.x);
+    if (overlap <= 0 || overlap < std::min(candidate.width, base.width) * 0.4) {
+        return false;
+    }
+    const bool sitsAboveBase = candidate.Bottom() <= base.Bottom() - std::max(4, base.height / 3);
+    const int centerX = candidate.CenterX();
+    const bool nearCenter = centerX >= base.x - base.width * 0.25 && centerX <= base.x + base.width * 1.25;
+    return sitsAboveBase && nearCenter;
+}
+
+/**
+ * @brief 후보 바로 아래 줄 묶음(최대 두 개)에서 x로 이진 탐색해 바탕 글자를 찾음
+ */
+bool HasRubyBase(const Item& candidate, const std::vector<Band>& bands) {
+    auto band = std::upper_bound(bands.begin(), bands.end(), candidate.CenterY(),
+                                 [](int centerY, const Band& value) { return centerY < value.anchorY; });
+    for (int checked = 0; band != bands.end() && checked < 2; ++band, ++checked) {
+        const auto& items = band->items;
+        const auto next = std::upper_bound(items.begin(), items.end(), candidate.CenterX(),
+                                           [](int centerX, const Item& value) { return centerX < value.x; });
+        const std::size_t pivot = static_cast<std::size_t>(next - items.begin());
+        const std::size_t first = pivot >= 2 ? pivot - 2 : 0;
+        const std::size_t last = std::min(items.size(), pivot + 2);
+        for (std::size_t i = first; i < last; ++i) {
+            if (SitsAboveAsRuby(candidate, items[i])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+LineBuilder::LineBuilder(LineBuilderOptions options)
+    : options_(options) {
+}
+
+bool LineBuilder::IsVerticalLayout(const std::vector<TextBox>& boxes) {
+    int verticalVotes = 0;
+    int horizontalVotes = 0;
+    for (const auto& box : boxes) {
+        // 한 글자 상자는 정사각형에 가까워 방향을 알 수 없음
+        if (text::CountCodePoints(box.text) < 2) {
+            continue;
+        }
+        if (ocr::IsVerticalTextBox(box.box)) {
+            ++verticalVotes;
+        } else if (box.box.height > 0 && box.box.width >= box.box.height * 1.5) {
+            ++horizontalVotes;
+        }
+    }
+    return verticalVotes > horizontalVotes;
+}
+
+LineLayout LineBuilder::Build(const std::vector<TextBox>& boxes) const {
+    LineLayout layout;
+    if (boxes.empty()) {
+        return layout;
+    }
+    layout.vertical = IsVerticalLayout(boxes);
+
+    // 기준 글자 높이: 루비일 수 없는 상자(한자 포함/긴 글)의 평균, 없으면 전체 평균
+    // (루비 상자가 많은 화면에서 평균이 작아져 루비를 놓치지 않도록)
+    std::vector<Item> items;
+    items.reserve(boxes.size());
+    long long heightSum = 0;
+    long long bodyHeightSum = 0;
+    long long bodyCount = 0;
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        Item item = ToCanonical(boxes[i].box, layout.vertical, i);
+        item.rubyCandidate = text::CountCodePoints(boxes[i].text) <= options_.maxRubyChars && AllKana(boxes[i].text);
+        heightSum += item.height;
+        if (!item.rubyCandidate) {
+            bodyHeightSum += item.height;
+            ++bodyCount;
+        }
+        items.push_back(item);
+    }
+    const long long referenceHeight = bodyCount > 0 ? bodyHeightSum / bodyCount
+                                                    : heightSum / static_cast<long long>(items.size());
+    const int avgHeight = std::max(1, static_cast<int>(referenceHeight));
+    const int tolerance = std::max(options_.minLineTolerance, static_cast<int>(avgHeight * options_.lineToleranceRatio));
+    const int rubyHeightLimit = std::max(8, static_cast<int>(avgHeight * options_.rubyHeightRatio));
+
+    std::vector<Item> regular;
+    std::vector<Item> candidates;
+    regular.reserve(items.size());
+    for (auto& item : items) {
+        item.rubyCandidate = item.rubyCandidate && item.height < rubyHeightLimit;
+        (item.rubyCandidate ? candidates : regular).push_back(item);
+    }
+
+    std::vector<Band> bands = GroupBands(regular, tolerance);
+    if (!candidates.empty()) {
+        bool keptCandidate = false;
+        for (const auto& candidate : candidates) {
+            if (HasRubyBase(candidate, bands)) {
+                ++layout.rubyCount;
+            } else {
+                regular.push_back(candidate);
+                keptCandidate = true;
+            }
+        }
+        if (keptCandidate) {
+            bands = GroupBands(std::move(regular), tolerance);
+        }
+    }
+
+    // 줄 안에서 간격이 크게 벌어진 곳 중 연속한 여러 줄에서 같은 자리에 반복되는 것만 단 경계로 봄
+    // (한 줄에만 있는 큰 간격은 띄어 쓴 구절이라 나누면 아래 줄이 끼어들어 순서가 뒤섞임)
+    const int columnGap = std::max(1, static_cast<int>(avgHeight * options_.columnGapRatio));
+    std::vector<std::vector<Gutter>> gutters(bands.size());
+    for (std::size_t b = 0; b < bands.size(); ++b) {
+        const auto& bandItems = bands[b].items;
+        int right = bandItems.empty() ? 0 : bandItems.front().Right();
+        for (std::size_t i = 1; i < bandItems.size(); ++i) {
+            if (bandItems[i].x - right > columnGap) {
+                gutters[b].push_back({right, bandItems[i].x, i});
+            }
+            right = std::max(right, bandItems[i].Right());
+        }
+    }
+    for (std::size_t b = 1; b < bands.size(); ++b) {
+        for (auto& gutter : gutters[b]) {
+            for (const auto& above : gutters[b - 1]) {
+                if (Overlaps(gutter, above)) {
+                    gutter.runBefore = std::max(gutter.runBefore, above.runBefore + 1);
+                }
+            }
+        }
+    }
+    for (std::size_t b = bands.size(); b-- > 1;) {
+        for (auto& above : gutters[b - 1]) {
+            for (const auto& gutter : gutters[b]) {
+                if (Overlaps(gutter, above)) {
+                    above.runAfter = std::max(above.runAfter, gutter.runAfter + 1);
+                }
+            }
+        }
+    }
+
+    std::vector<Piece> pieces;
+    for (std::size_t b = 0; b < bands.size(); ++b) {
+        auto gutter = gutters[b].begin();
+        for (std::size_t i = 0; i < bands[b].items.size(); ++i) {
+            const auto& item = bands[b].items[i];
+            bool split = false;
+            if (gutter != gutters[b].end() && gutter->item == i) {
+                split = gutter->runBefore + gutter->runAfter - 1 >= options_.minColumnBands;
+                ++gutter;
+            }
+            if (i == 0 || split) {
+                pieces.push_back({b, item.x, item.Right(), 0, {}});
+            }
+            auto& piece = pieces.back();
+            piece.right = std::max(piece.right, item.Right());
+            piece.items.push_back(item);
+        }
+    }
+
+    // x 범위가 겹치는 줄끼리 한 단으로 묶음 (구간 병합)
+    std::vector<std::size_t> byLeft(pieces.size());
+    for (std::size_t i = 0; i < byLeft.size(); ++i) {
+        byLeft[i] = i;
+    }
+    std::sort(byLeft.begin(), byLeft.end(), [&](std::size_t lhs, std::size_t rhs) {
+        return pieces[lhs].left < pieces[rhs].left;
+    });
+    std::size_t column = 0;
+    int columnRight = 0;
+    for (std::size_t i = 0; i < byLeft.size(); ++i) {
+        auto& piece = pieces[byLeft[i]];
+        if (i > 0 && piece.left > columnRight) {
+            ++column;
+        }
+        columnRight = i == 0 ? piece.right : std::max(columnRight, piece.right);
+        piece.column = column;
+    }
+    std::sort(pieces.begin(), pieces.end(), [](const Piece& lhs, const Piece& rhs) {
+        return std::tie(lhs.column, lhs.band, lhs.left) < std::tie(rhs.column, rhs.band, rhs.left);
+    });
+
+    layout.lines.reserve(pieces.size());
+    for (const auto& piece : pieces) {
+        TextLine line;
+        std::string joined;
+        for (const auto& item : piece.items) {
+            const auto& source = boxes[item.index];
+            if (NeedsSpace(joined, source.text)) {
+                joined.push_back(' ');
+            }
+            joined.append(source.text);
+            line.box = line.segmentCount == 0 ? source.box : (line.box | source.box);
+            ++line.segmentCount;
+        }
+        line.text.assign(text::TrimWhitespace(joined));
+        if (!line.text.empty()) {
+            layout.lines.push_back(std::move(line));
+        }
+    }
+    return layout;
+}
+
+}  // namespace sentence
+}  // namespace toriyomi
@@ -0,0 +1,84 @@
+// ToriYomi - 줄 조립
+// 텍스트 상자를 줄(세로쓰기면 열)로 묶고 후리가나(루비)를 걸러냄
+
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace toriyomi {
+namespace sentence {
+
+/**
+ * @brief 줄 조립 입력 (앞뒤 공백을 뗀 UTF-8 텍스트와 화면 좌표)
+ */
+struct TextBox {
+    std::string text;
+    cv::Rect box;
+};
+
+/**
+ * @brief 조립한 한 줄
+ */
+struct TextLine {
+    std::string text;
+    cv::Rect box;                   // 줄에 속한 상자들의 합
+    std::size_t segmentCount = 0;
+};
+
+/**
+ * @brief 조립 결과 (읽는 순서대로)
+ */
+struct LineLayout {
+    std::vector<TextLine> lines;
+    bool vertical = false;          // 세로쓰기로 판정했는지
+    std::size_t rubyCount = 0;      // 루비로 보고 뺀 상자 수
+};
+
+/**
+ * @brief LineBuilder 설정 (길이는 줄 방향에 수직인 글자 높이 기준, 세로쓰기면 너비)
+ */
+struct LineBuilderOptions {
+    // 같은 줄로 볼 중심 간 거리 = max(minLineTolerance, 평균 글자 높이 * lineToleranceRatio)
+    int minLineTolerance = 24;
+    double lineToleranceRatio = 0.6;
+    // 평균 높이의 이 비율보다 작고 maxRubyChars 이하의 가나뿐인 상자는 루비 후보
+    double rubyHeightRatio = 0.6;
+    std::size_t maxRubyChars = 4;
+    // 같은 줄 안에서 상자 간격이 평균 높이의 이 배수를 넘으면 다른 단(column) 경계 후보
+    double columnGapRatio = 3.0;
+    // 경계 후보가 이 수 이상의 연속한 줄에서 같은 자리에 있어야 실제로 단을 나눔
+    std::size_t minColumnBands = 2;
+};
+
+/**
+ * @brief 텍스트 상자를 줄 단위로 묶어 읽는 순서로 정렬
+ *
+ * 한 번 정렬한 뒤 줄 중심 순으로 훑어(sweep) 줄을 나누고, 루비 후보는 바로 아래 줄을
+ * 이진 탐색해 바탕 글자를 찾으므로 O(n log n)입니다 (상자가 수백 개인 메뉴/백로그 화면 대응).
+ * 세로로 긴 상자가 많으면 세로쓰기로 보고 좌표를 돌려 같은 방식으로 처리합니다
+ * (열은 오른쪽부터, 루비는 열 오른쪽). 여러 줄에 걸쳐 같은 자리의 간격이 크게 벌어지면
+ * 다단으로 보고 왼쪽 단(세로쓰기면 위쪽 단)을 먼저 읽습니다.
+ */
+class LineBuilder {
+public:
+    explicit LineBuilder(LineBuilderOptions options = {});
+
+    void SetOptions(const LineBuilderOptions& options) { options_ = options; }
+    const LineBuilderOptions& GetOptions() const { return options_; }
+
+    LineLayout Build(const std::vector<TextBox>& boxes) const;
+
+    /**
+     * @brief 세로쓰기 배치인지 (여러 글자 상자 중 세로로 긴 것이 더 많으면)
+     */
+    static bool IsVerticalLayout(const std::vector<TextBox>& boxes);
+
+private:
+    LineBuilderOptions options_;
+};
+
+}  // namespace sentence
+}  // namespace toriyomi
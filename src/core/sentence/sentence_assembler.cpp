@@ -0,0 +1,198 @@
+// ToriYomi - 문장 조립 구현
+
+#include "sentence_assembler.h"
+#include "common/text/unicode_utils.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+namespace toriyomi {
+namespace sentence {
+
+namespace {
+constexpr float kMinConfidence = 60.0f;
+constexpr int kMinArea = 400;
+
+bool ContainsCjk(std::string_view text) {
+    for (std::size_t pos = 0; pos < text.size();) {
+        if (text::IsJapaneseScript(text::DecodeUtf8(text, pos))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+void SentenceAssembler::SetCaptureIntervalSeconds(double seconds) {
+    captureIntervalSeconds_ = std::clamp(seconds, 0.1, 5.0);
+}
+
+void SentenceAssembler::SetSimilarityOptions(const SimilarityOptions& options) {
+    similarity_ = options;
+    publishedHistory_.SetOptions(options);
+}
+
+void SentenceAssembler::SetLineBuilderOptions(const LineBuilderOptions& options) {
+    lineBuilder_.SetOptions(options);
+}
+
+void SentenceAssembler::Reset() {
+    pendingSentence_.clear();
+    pendingHits_ = 0;
+    publishedHistory_.Clear();
+    sentenceInFlight_.clear();
+}
+
+std::optional<std::string> SentenceAssembler::TryAssemble(const SegmentList& segments,
+                                                          const LogCallback& logCallback) {
+    auto assembled = AssembleFrame(segments, logCallback);
+    if (!assembled) {
+        pendingSentence_.clear();
+        pendingHits_ = 0;
+        return std::nullopt;
+    }
+
+    if (IsDuplicate(*assembled)) {
+        pendingSentence_.clear();
+        pendingHits_ = 0;
+        return std::nullopt;
+    }
+
+    // 한두 글자 OCR 흔들림은 같은 문장으로 보고 안정 카운트를 이어감 (최신 판독으로 교체)
+    if (!pendingSentence_.empty() && IsSimilar(*assembled, pendingSentence_)) {
+        pendingHits_++;
+    } else {
+        pendingHits_ = 1;
+    }
+    pendingSentence_ = *assembled;
+
+    if (pendingHits_ < RequiredStableFrames()) {
+        return std::nullopt;
+    }
+
+    pendingSentence_.clear();
+    pendingHits_ = 0;
+    return assembled;
+}
+
+std::optional<std::string> SentenceAssembler::AssembleFrame(const SegmentList& segments,
+                                                            const LogCallback& logCallback) const {
+    if (segments.empty()) {
+        return std::nullopt;
+    }
+
+    auto normalized = NormalizeSegments(segments);
+    if (normalized.empty()) {
+        return std::nullopt;
+    }
+
+    std::vector<TextBox> boxes;
+    boxes.reserve(normalized.size());
+    for (const auto& segment : normalized) {
+        boxes.push_back(segment.box);
+    }
+    const LineLayout layout = lineBuilder_.Build(boxes);
+
+    std::string combined;
+    for (const auto& line : layout.lines) {
+        // 2글자 이하의 영문/기호 줄은 UI 잔상이나 오인식
+        if (text::CountCodePoints(line.text) <= 2 && !ContainsCjk(line.text)) {
+            continue;
+        }
+        if (!combined.empty()) {
+            combined.push_back('\n');
+        }
+        combined.append(line.text);
+    }
+
+    if (combined.empty()) {
+        return std::nullopt;
+    }
+    if (text::CountCodePoints(combined) <= 1 && normalized.size() > 1) {
+        LogSuspiciousFrame(normalized, logCallback);
+    }
+    return combined;
+}
+
+bool SentenceAssembler::IsDuplicate(std::string_view text) const {
+    if (!sentenceInFlight_.empty() && IsSimilar(text, sentenceInFlight_)) {
+        return true;
+    }
+    return publishedHistory_.ContainsSimilar(text);
+}
+
+bool SentenceAssembler::IsSimilar(std::string_view lhs, std::string_view rhs) const {
+    return IsNearDuplicateUtf8(lhs, rhs, similarity_);
+}
+
+void SentenceAssembler::MarkSentenceInFlight(std::string_view text) {
+    sentenceInFlight_.assign(text);
+}
+
+void SentenceAssembler::ClearSentenceInFlight(std::string_view text) {
+    if (sentenceInFlight_ == text) {
+        sentenceInFlight_.clear();
+    }
+}
+
+void SentenceAssembler::MarkSentencePublished(std::string_view text) {
+    publishedHistory_.Add(text);
+}
+
+int SentenceAssembler::RequiredStableFrames() const {
+    return (captureIntervalSeconds_ <= 0.5) ? 1 : 2;
+}
+
+std::vector<SentenceAssembler::NormalizedSegment> SentenceAssembler::NormalizeSegments(const SegmentList& segments) const {
+    std::vector<NormalizedSegment> result;
+    result.reserve(segments.size());
+
+    for (const auto& segment : segments) {
+        if (segment.confidence < kMinConfidence) {
+            continue;
+        }
+
+        const int area = segment.boundingBox.width * segment.boundingBox.height;
+        if (area < kMinArea) {
+            continue;
+        }
+
+        const std::string_view text = text::TrimWhitespace(segment.text);
+        if (text.empty()) {
+            continue;
+        }
+
+        NormalizedSegment normalized;
+        normalized.box.text.assign(text);
+        normalized.box.box = segment.boundingBox;
+        normalized.confidence = segment.confidence;
+        result.push_back(std::move(normalized));
+    }
+
+    return result;
+}
+
+void SentenceAssembler::LogSuspiciousFrame(const std::vector<NormalizedSegment>& segments,
+                                           const LogCallback& logCallback) const {
+    if (!logCallback) {
+        return;
+    }
+
+    std::ostringstream message;
+    message << "OCR 디버그 - " << segments.size() << "개 세그먼트: ";
+    message << std::fixed << std::setprecision(1);
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+        const auto& seg = segments[i];
+        if (i > 0) {
+            message << "; ";
+        }
+        message << seg.box.text << " (" << seg.box.box.x << ',' << seg.box.box.y << ' '
+                << seg.box.box.width << 'x' << seg.box.box.height << " conf=" << seg.confidence << ')';
+    }
+    logCallback(message.str());
+}
+
+}  // namespace sentence
+}  // namespace toriyomi
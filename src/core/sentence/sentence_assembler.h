@@ -0,0 +1,83 @@
+// ToriYomi - 문장 조립
+// OCR 세그먼트(UTF-8)를 줄 단위로 묶어 한 문장으로 만들고, 안정 프레임/중복을 판정
+
+#pragma once
+
+#include "core/ocr/ocr_engine.h"
+#include "core/sentence/line_builder.h"
+#include "core/sentence/sentence_similarity.h"
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace toriyomi {
+namespace sentence {
+
+/**
+ * @brief 프레임별 OCR 결과를 문장으로 조립
+ *
+ * Qt에 의존하지 않으므로 OCR 스레드나 헤드리스 도구에서 그대로 쓸 수 있습니다.
+ * 스레드 안전하지 않습니다 (한 스레드에서 순서대로 호출).
+ */
+class SentenceAssembler {
+public:
+    using LogCallback = std::function<void(const std::string&)>;
+
+    void SetCaptureIntervalSeconds(double seconds);
+    void Reset();
+
+    /**
+     * @brief 같은 문장으로 볼 OCR 오차 범위 (안정 프레임 판정과 중복 억제에 공통 적용)
+     */
+    void SetSimilarityOptions(const SimilarityOptions& options);
+
+    void SetLineBuilderOptions(const LineBuilderOptions& options);
+
+    /**
+     * @brief 안정 프레임 수만큼 같은 문장이 보이고 최근 문장과 겹치지 않으면 반환
+     */
+    std::optional<std::string> TryAssemble(const std::vector<ocr::TextSegment>& segments,
+                                           const LogCallback& logCallback = {});
+
+    /**
+     * @brief 안정 프레임/중복 확인 없이 이번 프레임의 문장만 조립 (타자기 추적용)
+     */
+    std::optional<std::string> AssembleFrame(const std::vector<ocr::TextSegment>& segments,
+                                             const LogCallback& logCallback = {}) const;
+
+    /**
+     * @brief 최근 발행했거나 분석 중인 문장과 거의 같은지
+     */
+    bool IsDuplicate(std::string_view text) const;
+
+    void MarkSentenceInFlight(std::string_view text);
+    void ClearSentenceInFlight(std::string_view text);
+    void MarkSentencePublished(std::string_view text);
+
+private:
+    using SegmentList = std::vector<ocr::TextSegment>;
+
+    struct NormalizedSegment {
+        TextBox box;
+        float confidence = 0.0f;
+    };
+
+    std::vector<NormalizedSegment> NormalizeSegments(const SegmentList& segments) const;
+    void LogSuspiciousFrame(const std::vector<NormalizedSegment>& segments, const LogCallback& logCallback) const;
+
+    int RequiredStableFrames() const;
+    bool IsSimilar(std::string_view lhs, std::string_view rhs) const;
+
+    LineBuilder lineBuilder_;
+    double captureIntervalSeconds_ = 1.0;
+    std::string pendingSentence_;
+    int pendingHits_ = 0;
+    SimilarityOptions similarity_;
+    RecentSentenceHistory publishedHistory_;
+    std::string sentenceInFlight_;
+};
+
+}  // namespace sentence
+}  // namespace toriyomi
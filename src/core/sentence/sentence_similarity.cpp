@@ -0,0 +1,173 @@
+// ToriYomi - 문장 유사도 구현
+
+#include "sentence_similarity.h"
+#include "common/text/unicode_utils.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace toriyomi {
+namespace sentence {
+
+namespace {
+
+using Word = std::uint64_t;
+constexpr std::size_t kWordBits = 64;
+
+/**
+ * @brief 패턴 글자별 일치 비트마스크 (글자 종류만큼만, 코드포인트 정렬)
+ */
+class PatternMasks {
+public:
+    explicit PatternMasks(std::u32string_view pattern)
+        : blockCount_((pattern.size() + kWordBits - 1) / kWordBits) {
+        symbols_.assign(pattern.begin(), pattern.end());
+        std::sort(symbols_.begin(), symbols_.end());
+        symbols_.erase(std::unique(symbols_.begin(), symbols_.end()), symbols_.end());
+        masks_.assign(symbols_.size() * blockCount_, 0);
+        for (std::size_t i = 0; i < pattern.size(); ++i) {
+            const std::size_t symbol = Find(pattern[i]);
+            masks_[symbol * blockCount_ + i / kWordBits] |= Word{1} << (i % kWordBits);
+        }
+    }
+
+    std::size_t BlockCount() const { return blockCount_; }
+
+    /**
+     * @brief 글자 ch의 블록별 마스크 (패턴에 없는 글자면 nullptr = 모두 0)
+     */
+    const Word* Masks(char32_t ch) const {
+        const std::size_t symbol = Find(ch);
+        return symbol < symbols_.size() ? &masks_[symbol * blockCount_] : nullptr;
+    }
+
+private:
+    std::size_t Find(char32_t ch) const {
+        const auto it = std::lower_bound(symbols_.begin(), symbols_.end(), ch);
+        return it != symbols_.end() && *it == ch ? static_cast<std::size_t>(it - symbols_.begin()) : symbols_.size();
+    }
+
+    std::size_t blockCount_;
+    std::vector<char32_t> symbols_;
+    std::vector<Word> masks_;
+};
+
+/**
+ * @brief 한 블록(패턴 64행)을 텍스트 한 글자만큼 진행 (Myers 1999 / Hyyrö 블록 방식)
+ *
+ * @param hin 블록 위쪽 행의 수평 변화량 (-1, 0, +1)
+ * @return 블록 맨 아래 행의 수평 변화량
+ */
+int AdvanceBlock(Word& pv, Word& mv, Word eq, int hin, Word* phOut, Word* mhOut) {
+    const Word hinNegative = hin < 0 ? 1 : 0;
+    const Word hinPositive = hin > 0 ? 1 : 0;
+    const Word xv = eq | mv;
+    eq |= hinNegative;
+    const Word xh = (((eq & pv) + pv) ^ pv) | eq;
+    Word ph = mv | ~(xh | pv);
+    Word mh = pv & xh;
+    *phOut = ph;
+    *mhOut = mh;
+
+    int hout = static_cast<int>(ph >> (kWordBits - 1)) - static_cast<int>(mh >> (kWordBits - 1));
+    ph = (ph << 1) | hinPositive;
+    mh = (mh << 1) | hinNegative;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+    return hout;
+}
+
+}  // namespace
+
+std::size_t EditDistance(std::u32string_view a, std::u32string_view b) {
+    // 짧은 쪽을 패턴(행)으로
+    if (a.size() > b.size()) {
+        std::swap(a, b);
+    }
+    if (a.empty()) {
+        return b.size();
+    }
+
+    const PatternMasks masks(a);
+    const std::size_t blocks = masks.BlockCount();
+    const std::size_t lastBit = (a.size() - 1) % kWordBits;
+    std::vector<Word> pv(blocks, ~Word{0});
+    std::vector<Word> mv(blocks, 0);
+    std::size_t score = a.size();
+
+    for (const char32_t ch : b) {
+        const Word* eq = masks.Masks(ch);
+        int hin = 1;   // 0행은 D[0][j] = j
+        for (std::size_t k = 0; k < blocks; ++k) {
+            Word ph = 0;
+            Word mh = 0;
+            hin = AdvanceBlock(pv[k], mv[k], eq ? eq[k] : 0, hin, &ph, &mh);
+            if (k + 1 == blocks) {
+                // 마지막 블록은 패턴 마지막 행(lastBit)의 변화량만 반영 (그 위 비트는 채움 행)
+                score += (ph >> lastBit) & 1;
+                score -= (mh >> lastBit) & 1;
+            }
+        }
+    }
+    return score;
+}
+
+std::u32string DecodeCodePoints(std::string_view utf8) {
+    std::u32string result;
+    result.reserve(utf8.size());
+    for (std::size_t pos = 0; pos < utf8.size();) {
+        result.push_back(text::DecodeUtf8(utf8, pos));
+    }
+    return result;
+}
+
+std::size_t EditDistanceUtf8(std::string_view a, std::string_view b) {
+    return EditDistance(DecodeCodePoints(a), DecodeCodePoints(b));
+}
+
+bool IsNearDuplicate(std::u32string_view a, std::u32string_view b, const SimilarityOptions& options) {
+    if (a == b) {
+        return true;
+    }
+    const std::size_t longer = std::max(a.size(), b.size());
+    if (longer < options.minFuzzyChars) {
+        return false;
+    }
+    const std::size_t allowed = std::max(options.minAllowedEdits,
+                                         static_cast<std::size_t>(static_cast<double>(longer) * options.maxEditRatio));
+    // 길이 차이만으로 넘으면 계산하지 않음
+    const std::size_t lengthGap = a.size() > b.size() ? a.size() - b.size() : b.size() - a.size();
+    if (lengthGap > allowed) {
+        return false;
+    }
+    return EditDistance(a, b) <= allowed;
+}
+
+bool IsNearDuplicateUtf8(std::string_view a, std::string_view b, const SimilarityOptions& options) {
+    if (a == b) {
+        return true;
+    }
+    return IsNearDuplicate(DecodeCodePoints(a), DecodeCodePoints(b), options);
+}
+
+RecentSentenceHistory::RecentSentenceHistory(std::size_t capacity, SimilarityOptions options)
+    : capacity_(std::max<std::size_t>(1, capacity)),
+      options_(options) {
+}
+
+void RecentSentenceHistory::Add(std::string_view text) {
+    entries_.push_front(DecodeCodePoints(text));
+    while (entries_.size() > capacity_) {
+        entries_.pop_back();
+    }
+}
+
+bool RecentSentenceHistory::ContainsSimilar(std::string_view text) const {
+    const std::u32string decoded = DecodeCodePoints(text);
+    return std::any_of(entries_.begin(), entries_.end(), [&](const std::u32string& entry) {
+        return IsNearDuplicate(entry, decoded, options_);
+    });
+}
+
+}  // namespace sentence
+}  // namespace toriyomi
@@ -0,0 +1,78 @@
+// ToriYomi - 문장 유사도
+// OCR 흔들림(ー/一, っ/つ 등)으로 한두 글자만 다른 문장을 같은 문장으로 보기 위한 편집 거리
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+
+namespace toriyomi {
+namespace sentence {
+
+/**
+ * @brief 코드포인트 단위 레벤슈타인 거리 (Myers 비트 병렬, 64글자 블록)
+ *
+ * 짧은 쪽을 패턴으로 삼아 O(ceil(m/64) * n)에 계산합니다.
+ */
+std::size_t EditDistance(std::u32string_view a, std::u32string_view b);
+
+/**
+ * @brief UTF-8 문자열의 편집 거리 (코드포인트 단위)
+ */
+std::size_t EditDistanceUtf8(std::string_view a, std::string_view b);
+
+std::u32string DecodeCodePoints(std::string_view utf8);
+
+/**
+ * @brief 거의 같은 문장 판정 기준
+ *
+ * 허용 편집 수 = max(minAllowedEdits, 긴 쪽 글자 수 * maxEditRatio).
+ * minFuzzyChars보다 짧은 문장은 정확히 같아야 합니다.
+ */
+struct SimilarityOptions {
+    double maxEditRatio = 0.1;
+    std::size_t minAllowedEdits = 1;
+    std::size_t minFuzzyChars = 4;
+};
+
+/**
+ * @brief 두 문장이 OCR 오차 범위 안에서 같은지
+ */
+bool IsNearDuplicate(std::u32string_view a, std::u32string_view b, const SimilarityOptions& options = {});
+bool IsNearDuplicateUtf8(std::string_view a, std::string_view b, const SimilarityOptions& options = {});
+
+/**
+ * @brief 최근 발행한 문장 몇 개를 기억해 다시 보이는 문장(백로그 깜빡임 등)을 걸러냄
+ *
+ * 스레드 안전하지 않습니다.
+ */
+class RecentSentenceHistory {
+public:
+    static constexpr std::size_t kDefaultCapacity = 8;
+
+    explicit RecentSentenceHistory(std::size_t capacity = kDefaultCapacity,
+                                   SimilarityOptions options = {});
+
+    void Add(std::string_view text);
+
+    /**
+     * @brief 기억한 문장 중 거의 같은 것이 있는지
+     */
+    bool ContainsSimilar(std::string_view text) const;
+
+    void SetOptions(const SimilarityOptions& options) { options_ = options; }
+    const SimilarityOptions& GetOptions() const { return options_; }
+
+    std::size_t Size() const { return entries_.size(); }
+    void Clear() { entries_.clear(); }
+
+private:
+    std::size_t capacity_;
+    SimilarityOptions options_;
+    std::deque<std::u32string> entries_;   // 최근 것이 앞
+};
+
+}  // namespace sentence
+}  // namespace toriyomi
@@ -0,0 +1,171 @@
+// ToriYomi - 타자기 효과 추적 구현
+
+#include "typewriter_tracker.h"
+#include "common/text/unicode_utils.h"
+
+namespace toriyomi {
+namespace sentence {
+
+namespace {
+
+std::size_t CountChars(std::string_view text) {
+    std::size_t count = 0;
+    for (std::size_t pos = 0; pos < text.size(); ++count) {
+        text::DecodeUtf8(text, pos);
+    }
+    return count;
+}
+
+/**
+ * @brief 문장을 끝내는 글자로 끝나는지 (。！？」』… 등)
+ */
+bool EndsWithTerminalPunctuation(std::string_view text) {
+    if (text.empty()) {
+        return false;
+    }
+    std::size_t pos = text.size() - 1;
+    while (pos > 0 && (static_cast<unsigned char>(text[pos]) & 0xC0) == 0x80) {
+        --pos;
+    }
+    switch (text::DecodeUtf8(text, pos)) {
+        case U'。': case U'！': case U'？': case U'」': case U'』': case U'…': case U'）':
+        case U'!': case U'?': case U'.':
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+TypewriterTracker::TypewriterTracker(TypewriterOptions options)
+    : options_(options) {
+}
+
+void TypewriterTracker::SetOptions(const TypewriterOptions& options) {
+    options_ = options;
+}
+
+void TypewriterTracker::Reset() {
+    current_.clear();
+    currentChars_ = 0;
+    lastPartialChars_ = 0;
+    finalized_ = false;
+    revision_ = false;
+}
+
+bool TypewriterTracker::IsExtension(std::string_view previous, std::string_view current) {
+    if (previous.empty()) {
+        return false;
+    }
+    std::size_t prevPos = 0;
+    std::size_t curPos = 0;
+    std::size_t compared = 0;
+    std::size_t mismatches = 0;
+    while (prevPos < previous.size()) {
+        if (curPos >= current.size()) {
+            return false;   // 늘어나지 않고 같거나 짧음
+        }
+        if (text::DecodeUtf8(previous, prevPos) != text::DecodeUtf8(current, curPos)) {
+            ++mismatches;
+        }
+        ++compared;
+    }
+    return curPos < current.size() && mismatches <= compared / 8;
+}
+
+std::vector<TypewriterEvent> TypewriterTracker::Update(std::string_view text, Clock::time_point now) {
+    std::vector<TypewriterEvent> events;
+
+    if (text.empty()) {
+        // 텍스트 상자가 사라짐: 보이던 문장은 끝까지 나타난 것으로 봄
+        if (!current_.empty() && !finalized_) {
+            EmitFinal(events);
+        }
+        Reset();
+        return events;
+    }
+
+    if (text == current_) {
+        if (!finalized_ && now - lastChange_ >= options_.settleTime) {
+            EmitFinal(events);
+        }
+        return events;
+    }
+
+    if (IsExtension(current_, text)) {
+        current_.assign(text);
+        currentChars_ = CountChars(current_);
+        lastChange_ = now;
+        if (finalized_) {
+            finalized_ = false;
+            revision_ = true;
+        }
+        AfterGrowth(events);
+        return events;
+    }
+
+    // OCR 흔들림: 이전 판독을 유지하고 안정 시간도 이어서 셈
+    if (IsNearDuplicateUtf8(current_, text, options_.similarity)) {
+        if (!finalized_ && now - lastChange_ >= options_.settleTime) {
+            EmitFinal(events);
+        }
+        return events;
+    }
+
+    // 미확정 문장보다 짧은 앞부분만 보이면 OCR 누락으로 보고 무시
+    // (확정된 문장이면 같은 글자로 시작하는 다음 문장이 나타나는 중)
+    if (!finalized_ && IsExtension(text, current_)) {
+        return events;
+    }
+
+    if (!current_.empty() && !finalized_) {
+        EmitFinal(events);
+    }
+    StartSentence(text, now, events);
+    return events;
+}
+
+std::vector<TypewriterEvent> TypewriterTracker::Flush() {
+    std::vector<TypewriterEvent> events;
+    if (!current_.empty() && !finalized_) {
+        EmitFinal(events);
+    }
+    return events;
+}
+
+void TypewriterTracker::StartSentence(std::string_view text, Clock::time_point now,
+                                      std::vector<TypewriterEvent>& events) {
+    ++sentenceId_;
+    current_.assign(text);
+    currentChars_ = CountChars(current_);
+    lastPartialChars_ = 0;
+    lastChange_ = now;
+    finalized_ = false;
+    revision_ = false;
+    AfterGrowth(events);
+}
+
+void TypewriterTracker::AfterGrowth(std::vector<TypewriterEvent>& events) {
+    if (options_.finalizeOnTerminalPunctuation && EndsWithTerminalPunctuation(current_)) {
+        EmitFinal(events);
+        return;
+    }
+
+    const bool first = lastPartialChars_ == 0;
+    const bool enough = first ? currentChars_ >= options_.minPartialChars
+                              : currentChars_ >= lastPartialChars_ + options_.partialStepChars;
+    if (enough) {
+        lastPartialChars_ = currentChars_;
+        events.push_back({TypewriterEvent::Kind::Partial, sentenceId_, current_, revision_});
+    }
+}
+
+void TypewriterTracker::EmitFinal(std::vector<TypewriterEvent>& events) {
+    finalized_ = true;
+    lastPartialChars_ = currentChars_;
+    events.push_back({TypewriterEvent::Kind::Final, sentenceId_, current_, revision_});
+}
+
+}  // namespace sentence
+}  // namespace toriyomi
@@ -0,0 +1,104 @@
+// ToriYomi - 타자기 효과 추적
+// 한 글자씩 나타나는 비주얼 노벨 텍스트를 따라가며 부분 문장과 확정 문장을 발행
+
+#pragma once
+
+#include "core/sentence/sentence_similarity.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace toriyomi {
+namespace sentence {
+
+/**
+ * @brief TypewriterTracker 설정
+ */
+struct TypewriterOptions {
+    // 마지막으로 글자가 늘어난 뒤 이 시간 동안 그대로면 확정 (캡처 간격보다 길어야 함)
+    std::chrono::milliseconds settleTime{1100};
+    // 새 문장의 첫 부분 문장을 내보낼 최소 글자 수
+    std::size_t minPartialChars = 2;
+    // 직전 부분 문장보다 이만큼 늘어날 때마다 부분 문장 발행 (형태소 분석 부하 제한)
+    std::size_t partialStepChars = 3;
+    // 。！？」 등으로 끝나면 기다리지 않고 바로 확정 (이후 더 늘어나면 같은 문장을 다시 확정)
+    bool finalizeOnTerminalPunctuation = true;
+    // 길이가 같고 몇 글자만 다른 프레임(ー/一 등 OCR 흔들림)은 새 문장이 아닌 같은 문장으로 봄
+    SimilarityOptions similarity;
+};
+
+/**
+ * @brief 발행 이벤트
+ */
+struct TypewriterEvent {
+    enum class Kind {
+        Partial,    // 아직 나타나는 중인 문장 (교체 가능)
+        Final       // 더 늘어나지 않는 문장
+    };
+
+    Kind kind = Kind::Partial;
+    std::uint64_t sentenceId = 0;   // 같은 문장의 부분/확정 이벤트는 같은 ID
+    std::string text;
+    bool revision = false;          // 이미 확정한 문장이 다시 늘어난 뒤의 이벤트
+};
+
+/**
+ * @brief 프레임마다 조립한 텍스트로 타자기 효과를 판별
+ *
+ * 앞부분이 그대로이고 뒤만 늘어나면 같은 문장의 연장으로, 앞부분이 바뀌면 새 문장으로 봅니다.
+ * OCR이 앞부분 글자를 가끔 다르게 읽는 것은 허용합니다 (8글자당 1글자).
+ * 늘어나는 동안 부분 문장을, 멈추면(settleTime) 확정 문장을 내보내므로
+ * 전체 문장이 다 나타난 뒤 안정 프레임을 기다리는 방식보다 훨씬 일찍 분석을 시작할 수 있습니다.
+ *
+ * 스레드 안전하지 않습니다 (한 스레드에서 순서대로 호출).
+ */
+class TypewriterTracker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit TypewriterTracker(TypewriterOptions options = {});
+
+    void SetOptions(const TypewriterOptions& options);
+    const TypewriterOptions& GetOptions() const { return options_; }
+
+    /**
+     * @brief 새 프레임 텍스트 반영
+     *
+     * @param text 조립한 문장 (텍스트 상자가 비었으면 빈 문자열)
+     * @param now 프레임 시각
+     * @return 발생한 이벤트 (새 문장이 이전 미확정 문장을 밀어내면 확정 + 부분 두 개)
+     */
+    std::vector<TypewriterEvent> Update(std::string_view text, Clock::time_point now);
+
+    /**
+     * @brief 미확정 문장을 즉시 확정 (캡처 중지 등)
+     */
+    std::vector<TypewriterEvent> Flush();
+
+    void Reset();
+
+    /**
+     * @brief current가 previous 뒤에 글자가 늘어난 것인지 (앞부분 OCR 오차 허용)
+     */
+    static bool IsExtension(std::string_view previous, std::string_view current);
+
+private:
+    void StartSentence(std::string_view text, Clock::time_point now, std::vector<TypewriterEvent>& events);
+    void AfterGrowth(std::vector<TypewriterEvent>& events);
+    void EmitFinal(std::vector<TypewriterEvent>& events);
+
+    TypewriterOptions options_;
+    std::string current_;
+    std::size_t currentChars_ = 0;
+    std::size_t lastPartialChars_ = 0;
+    std::uint64_t sentenceId_ = 0;
+    Clock::time_point lastChange_{};
+    bool finalized_ = false;
+    bool revision_ = false;
+};
+
+}  // namespace sentence
+}  // namespace toriyomi
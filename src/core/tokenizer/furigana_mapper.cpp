@@ -1,8 +1,7 @@
 // ToriYomi - 후리가나 매퍼 구현
 
 #include "furigana_mapper.h"
-#include <codecvt>
-#include <locale>
+#include "common/text/unicode_utils.h"
 
 namespace toriyomi {
 namespace tokenizer {
@@ -11,8 +10,35 @@ namespace tokenizer {
 class FuriganaMapper::Impl {
 public:
     int rubyOffset = 5;  // 루비 텍스트와 베이스 텍스트 간격 (픽셀)
+    std::shared_ptr<const KanjiReadingTable> kanjiReadings;
 };
 
+namespace {
+
+std::size_t CountCodePoints(const std::string& text) {
+    std::size_t count = 0;
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        text::DecodeUtf8(text, pos);
+        ++count;
+    }
+    return count;
+}
+
+std::string SliceCodePoints(const std::string& text, std::size_t start, std::size_t length) {
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < start && pos < text.size(); ++i) {
+        text::DecodeUtf8(text, pos);
+    }
+    const std::size_t begin = pos;
+    for (std::size_t i = 0; i < length && pos < text.size(); ++i) {
+        text::DecodeUtf8(text, pos);
+    }
+    return text.substr(begin, pos - begin);
+}
+
+}  // namespace
+
 FuriganaMapper::FuriganaMapper()
     : pImpl_(std::make_unique<Impl>()) {
 }
@@ -41,6 +67,26 @@ FuriganaInfo FuriganaMapper::MapTokenToFurigana(const Token& token) {
     
     if (info.needsRuby) {
         info.rubyPosition = CalculateRubyPosition(token.boundingBox, pImpl_->rubyOffset);
+
+        // 읽기를 한자 구간에 배분하고 글자 수 비례로 구간 위치 계산
+        const auto segments = AlignRuby(token.surface, info.reading, pImpl_->kanjiReadings.get());
+        const std::size_t charCount = CountCodePoints(token.surface);
+        const float charWidth = charCount > 0 ? static_cast<float>(token.boundingBox.width) / charCount : 0.0f;
+        info.rubySpans.reserve(segments.size());
+        for (const auto& segment : segments) {
+            RubySpan span;
+            span.baseText = SliceCodePoints(token.surface, segment.charStart, segment.charLength);
+            span.reading = segment.reading;
+            span.position = cv::Rect(token.boundingBox.x + static_cast<int>(charWidth * segment.charStart),
+                                     token.boundingBox.y,
+                                     static_cast<int>(charWidth * segment.charLength),
+                                     token.boundingBox.height);
+            span.rubyPosition = CalculateRubyPosition(span.position, pImpl_->rubyOffset);
+            info.rubySpans.push_back(std::move(span));
+        }
+        if (!info.rubySpans.empty()) {
+            info.rubyPosition = info.rubySpans.front().rubyPosition;
+        }
     } else {
         // 후리가나가 필요 없으면 루비 위치는 사용하지 않음
         info.rubyPosition = cv::Point(0, 0);
@@ -50,57 +96,13 @@ FuriganaInfo FuriganaMapper::MapTokenToFurigana(const Token& token) {
 }
 
 bool FuriganaMapper::ContainsKanji(const std::string& text) {
-    if (text.empty()) {
-        return false;
-    }
-
-    // UTF-8을 UTF-32로 변환하여 유니코드 코드포인트 검사
-    try {
-        std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-        std::u32string u32str = converter.from_bytes(text);
-
-        for (char32_t ch : u32str) {
-            // 한자 유니코드 범위:
-            // CJK Unified Ideographs: U+4E00 ~ U+9FFF
-            // CJK Compatibility Ideographs: U+F900 ~ U+FAFF
-            // CJK Unified Ideographs Extension A: U+3400 ~ U+4DBF
-            if ((ch >= 0x4E00 && ch <= 0x9FFF) ||
-                (ch >= 0x3400 && ch <= 0x4DBF) ||
-                (ch >= 0xF900 && ch <= 0xFAFF)) {
-                return true;
-            }
-        }
-    } catch (...) {
-        // 변환 실패 시 false 반환
-        return false;
-    }
-
-    return false;
+    // 한자: CJK 통합 한자 (확장 A/B~, 호환 한자 포함) 및 々〆〇
+    return text::ContainsKanji(text);
 }
 
 std::string FuriganaMapper::KatakanaToHiragana(const std::string& katakana) {
-    if (katakana.empty()) {
-        return "";
-    }
-
-    try {
-        std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-        std::u32string u32str = converter.from_bytes(katakana);
-        
-        for (char32_t& ch : u32str) {
-            // 가타카나 유니코드 범위: U+30A0 ~ U+30FF
-            // 히라가나 유니코드 범위: U+3040 ~ U+309F
-            // 오프셋: 0x60 (96)
-            if (ch >= 0x30A0 && ch <= 0x30FF) {
-                ch -= 0x60;  // 가타카나를 히라가나로 변환
-            }
-        }
-        
-        return converter.to_bytes(u32str);
-    } catch (...) {
-        // 변환 실패 시 원본 반환
-        return katakana;
-    }
+    // UTF-8 그대로 제자리 변환 (ァ~ヶ → ぁ~ゖ, 장음 부호 ー는 유지)
+    return text::KatakanaToHiragana(katakana);
 }
 
 cv::Point FuriganaMapper::CalculateRubyPosition(const cv::Rect& basePosition, int rubyOffset) {
@@ -118,5 +120,9 @@ int FuriganaMapper::GetRubyOffset() const {
     return pImpl_->rubyOffset;
 }
 
+void FuriganaMapper::SetKanjiReadingTable(std::shared_ptr<const KanjiReadingTable> table) {
+    pImpl_->kanjiReadings = std::move(table);
+}
+
 } // namespace tokenizer
 } // namespace toriyomi
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "japanese_tokenizer.h"
+#include "ruby_aligner.h"
 #include <opencv2/opencv.hpp>
 #include <vector>
 #include <string>
@@ -11,6 +12,16 @@
 namespace toriyomi {
 namespace tokenizer {
 
+/**
+ * @brief 한자 구간 하나의 루비 (오쿠리가나 제외)
+ */
+struct RubySpan {
+    std::string baseText;      // 한자 구간 (예: "食")
+    std::string reading;       // 구간 읽기 (예: "た")
+    cv::Rect position;         // 화면 위치 (한자 구간)
+    cv::Point rubyPosition;    // 루비 텍스트 위치
+};
+
 /**
  * @brief 후리가나 정보
  * 
@@ -22,6 +33,7 @@ struct FuriganaInfo {
     cv::Rect position;         // 화면 위치 (베이스 텍스트)
     cv::Point rubyPosition;    // 루비 텍스트 위치 (읽기 표시 위치)
     bool needsRuby;            // 후리가나 필요 여부 (한자 포함 시 true)
+    std::vector<RubySpan> rubySpans;  // 한자 구간별 루비 (정렬 실패 시 비어 있음)
 };
 
 /**
@@ -89,6 +101,11 @@ public:
      */
     int GetRubyOffset() const;
 
+    /**
+     * @brief 읽기 정렬에 사용할 한자별 읽기 표 설정 (nullptr이면 표 없이 정렬)
+     */
+    void SetKanjiReadingTable(std::shared_ptr<const KanjiReadingTable> table);
+
 private:
     class Impl;
     std::unique_ptr<Impl> pImpl_;
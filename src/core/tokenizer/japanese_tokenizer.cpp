@@ -2,45 +2,144 @@
 // MeCab을 사용한 형태소 분석
 
 #include "japanese_tokenizer.h"
+#include "common/concurrency/thread_pool.h"
+#include "common/text/unicode_utils.h"
 #include <mecab.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <stdexcept>
 #include <cstring>
 #include <cstdlib>
+#include <thread>
 #include <vector>
 
 namespace toriyomi {
 namespace tokenizer {
 
+namespace {
+
+/**
+ * @brief 스레드 하나가 독점해서 쓰는 Tagger + Lattice 묶음
+ *
+ * 사전(MeCab::Model)은 공유하고, Tagger/Lattice는 가벼우므로 스레드마다 따로 씁니다.
+ */
+struct TaggerSlot {
+    std::unique_ptr<MeCab::Tagger> tagger;
+    std::unique_ptr<MeCab::Lattice> lattice;
+    std::uint64_t generation = 0;
+};
+
+}  // namespace
+
 // Pimpl 구현
 class JapaneseTokenizer::Impl {
 public:
-    MeCab::Tagger* tagger = nullptr;
-    bool initialized = false;
+    /**
+     * @brief Tokenize() 한 번 동안 빌려 쓰는 슬롯
+     *
+     * model을 함께 잡고 있어 Shutdown()/재초기화 중에도 사전이 먼저 해제되지 않습니다.
+     * (멤버 선언 역순으로 소멸하므로 slot이 model보다 먼저 해제됨)
+     */
+    struct Lease {
+        std::shared_ptr<MeCab::Model> model;
+        TaggerSlot slot;
+    };
+
+    std::atomic<bool> initialized{false};
+    std::string dictionaryDir;      // Initialize()가 찾은 시스템 사전 경로
+    std::filesystem::path userDictionary;   // SetUserDictionary()로 붙인 사용자 사전 (없으면 빈 경로)
+
+    /**
+     * @brief 유휴 슬롯을 꺼내거나 공유 모델에서 새로 생성
+     */
+    bool Acquire(Lease& lease) {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            if (!model_) {
+                return false;
+            }
+            lease.model = model_;
+            if (!idleSlots_.empty()) {
+                lease.slot = std::move(idleSlots_.back());
+                idleSlots_.pop_back();
+                return true;
+            }
+            lease.slot.generation = generation_;
+        }
+
+        lease.slot.tagger.reset(lease.model->createTagger());
+        lease.slot.lattice.reset(lease.model->createLattice());
+        return lease.slot.tagger && lease.slot.lattice;
+    }
+
+    /**
+     * @brief 슬롯 반납 (모델이 교체된 뒤라면 폐기)
+     */
+    void Release(Lease& lease) {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        if (lease.slot.generation == generation_ && model_ &&
+            lease.slot.tagger && lease.slot.lattice &&
+            idleSlots_.size() < MaxIdleSlots()) {
+            idleSlots_.push_back(std::move(lease.slot));
+        }
+    }
+
+    void SetModel(std::shared_ptr<MeCab::Model> model) {
+        std::vector<TaggerSlot> retired;
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            retired.swap(idleSlots_);
+            model_ = std::move(model);
+            ++generation_;
+        }
+        // 이전 모델의 Tagger는 락 밖에서 해제
+    }
+
+    static std::size_t MaxIdleSlots() {
+        return std::max<std::size_t>(2, std::thread::hardware_concurrency());
+    }
 
     /**
-     * @brief 텍스트 길이 기반으로 boundingBox를 분할
+     * @brief 토큰이 차지하는 글자 범위의 boundingBox 계산
      * 
-     * OCR 결과의 전체 boundingBox를 각 토큰의 문자 수에 비례하여 분할
+     * OCR 엔진이 글자별 영역(charBoxes)을 텍스트 글자 수만큼 제공하면 그 합집합을,
+     * 아니면 전체 boundingBox를 글자(코드포인트) 수에 비례하여 분할
+     * (세로 줄은 위에서 아래로)
      */
-    cv::Rect CalculateTokenBoundingBox(const cv::Rect& totalBox, 
-                                        int textLength,
-                                        int tokenStartPos,
-                                        int tokenLength) {
-        if (textLength == 0 || tokenLength == 0) {
+    cv::Rect CalculateTokenBoundingBox(const ocr::TextSegment& segment,
+                                        std::size_t charCount,
+                                        std::size_t charStart,
+                                        std::size_t tokenChars) {
+        if (charCount == 0 || tokenChars == 0 || charStart + tokenChars > charCount) {
             return cv::Rect(0, 0, 0, 0);
         }
 
-        // 문자당 평균 너비
-        float charWidth = static_cast<float>(totalBox.width) / textLength;
-        
-        // 토큰의 시작 X 좌표
-        int startX = totalBox.x + static_cast<int>(charWidth * tokenStartPos);
-        
-        // 토큰의 너비
-        int width = static_cast<int>(charWidth * tokenLength);
-        
-        return cv::Rect(startX, totalBox.y, width, totalBox.height);
+        if (segment.charBoxes.size() == charCount) {
+            cv::Rect box = segment.charBoxes[charStart];
+            for (std::size_t i = charStart + 1; i < charStart + tokenChars; ++i) {
+                box |= segment.charBoxes[i];
+            }
+            return box;
+        }
+
+        const cv::Rect& totalBox = segment.boundingBox;
+        const bool vertical = ocr::IsVerticalTextBox(totalBox);
+        const int length = vertical ? totalBox.height : totalBox.width;
+        const int begin = static_cast<int>(static_cast<std::int64_t>(length) * charStart / charCount);
+        const int end = static_cast<int>(static_cast<std::int64_t>(length) * (charStart + tokenChars) / charCount);
+        if (vertical) {
+            return cv::Rect(totalBox.x, totalBox.y + begin, totalBox.width, end - begin);
+        }
+        return cv::Rect(totalBox.x + begin, totalBox.y, end - begin, totalBox.height);
     }
+
+private:
+    std::mutex poolMutex_;
+    std::shared_ptr<MeCab::Model> model_;
+    std::vector<TaggerSlot> idleSlots_;
+    std::uint64_t generation_ = 0;
 };
 
 JapaneseTokenizer::JapaneseTokenizer()
@@ -74,16 +173,18 @@ bool JapaneseTokenizer::Initialize(const std::string& dicPath) {
         searchPaths.push_back(mecabrc);
     }
 
-    // MeCab Tagger 생성 시도
+    // MeCab Model 생성 시도 (사전은 한 번만 로드하고 Tagger는 스레드별로 생성)
     // 참고: argc/argv 형식 사용 (공백이 있는 경로 지원)
     for (const auto& path : searchPaths) {
         try {
             // argv 형식으로 인자 전달
             int argc = 3;
             const char* argv[] = {"mecab", "-d", path.c_str()};
-            pImpl_->tagger = MeCab::createTagger(argc, const_cast<char**>(argv));
+            std::shared_ptr<MeCab::Model> model(MeCab::createModel(argc, const_cast<char**>(argv)));
             
-            if (pImpl_->tagger) {
+            if (model) {
+                pImpl_->SetModel(std::move(model));
+                pImpl_->dictionaryDir = path;
                 pImpl_->initialized = true;
                 return true;
             }
@@ -98,124 +199,149 @@ bool JapaneseTokenizer::Initialize(const std::string& dicPath) {
 }
 
 std::vector<Token> JapaneseTokenizer::Tokenize(const std::string& text) {
-    std::vector<Token> tokens;
+    return TokenizeCompact(text).MaterializeAll();
+}
 
+TokenizedSentence JapaneseTokenizer::TokenizeCompact(std::string_view text) {
     if (!pImpl_->initialized || text.empty()) {
-        return tokens;
+        return {};
     }
 
-    // MeCab으로 형태소 분석
-    const MeCab::Node* node = pImpl_->tagger->parseToNode(text.c_str());
+    // 공유 모델에서 이 호출 전용 Tagger/Lattice를 빌려 형태소 분석 (전역 락 없음)
+    Impl::Lease lease;
+    if (!pImpl_->Acquire(lease)) {
+        return {};
+    }
 
-    if (!node) {
-        return tokens;
+    // MeCab은 NUL 종료 문자열을 요구하고 노드 surface가 입력 버퍼를 가리키므로
+    // 아레나와 별도인 입력 사본을 파싱이 끝날 때까지 유지
+    TokenizedSentence sentence(text);
+    const std::string input(text);
+    lease.slot.lattice->set_sentence(input.c_str());
+    if (!lease.slot.tagger->parse(lease.slot.lattice.get())) {
+        pImpl_->Release(lease);
+        return {};
     }
 
-    // 각 형태소를 Token으로 변환
-    for (; node; node = node->next) {
+    const char* sentenceBegin = lease.slot.lattice->sentence();
+    for (const MeCab::Node* node = lease.slot.lattice->bos_node(); node; node = node->next) {
         // BOS(문장 시작), EOS(문장 끝) 노드는 스킵
         if (node->stat == MECAB_BOS_NODE || node->stat == MECAB_EOS_NODE) {
             continue;
         }
 
-        Token token;
-        
-        // 표면형 (실제 나타난 형태)
-        token.surface = std::string(node->surface, node->length);
-
-        // feature 파싱: "품사,품사세분류1,품사세분류2,품사세분류3,활용형,활용형세분류,기본형,읽기,발음"
-        std::string feature = node->feature ? node->feature : "";
-        
-        size_t pos = 0;
-        int fieldIndex = 0;
-        std::string field;
-        
-        while ((pos = feature.find(',')) != std::string::npos) {
-            field = feature.substr(0, pos);
-            
-            switch (fieldIndex) {
-                case 0:  // 품사
-                    token.partOfSpeech = field;
-                    break;
-                case 6:  // 기본형
-                    token.baseForm = field;
-                    break;
-                case 7:  // 읽기
-                    token.reading = field;
-                    break;
-            }
-            
-            feature.erase(0, pos + 1);
-            fieldIndex++;
-        }
-
-        // 마지막 필드 처리 (발음)
-        if (fieldIndex == 7 && !feature.empty()) {
-            token.reading = feature;
-        }
-
-        // 읽기 정보가 없으면 표면형 사용
-        if (token.reading.empty() || token.reading == "*") {
-            token.reading = token.surface;
-        }
-
-        // 기본형이 없으면 표면형 사용
-        if (token.baseForm.empty() || token.baseForm == "*") {
-            token.baseForm = token.surface;
-        }
-
-        tokens.push_back(token);
+        // feature: "품사,품사세분류1,품사세분류2,품사세분류3,활용형,활용형세분류,기본형,읽기,발음"
+        const auto fields = ParseMecabFeature(node->feature ? std::string_view(node->feature) : std::string_view());
+        sentence.AddToken(static_cast<std::size_t>(node->surface - sentenceBegin), node->length, fields);
     }
 
-    return tokens;
+    pImpl_->Release(lease);
+    return sentence;
 }
 
 std::vector<Token> JapaneseTokenizer::TokenizeWithPosition(const ocr::TextSegment& segment) {
-    // 텍스트를 형태소 분석
-    auto tokens = Tokenize(segment.text);
+    // 텍스트를 형태소 분석 (MeCab이 건너뛴 공백도 위치에 반영되도록 원문 오프셋 사용)
+    const TokenizedSentence sentence = TokenizeCompact(segment.text);
+    auto tokens = sentence.MaterializeAll();
+
+    // 바이트 오프셋 → 글자(코드포인트) 위치
+    std::vector<std::uint32_t> charIndexAt(segment.text.size() + 1, 0);
+    std::size_t charCount = 0;
+    for (std::size_t pos = 0; pos < segment.text.size();) {
+        const std::size_t start = pos;
+        text::DecodeUtf8(segment.text, pos);
+        std::fill(charIndexAt.begin() + start, charIndexAt.begin() + pos, static_cast<std::uint32_t>(charCount));
+        ++charCount;
+    }
+    charIndexAt.back() = static_cast<std::uint32_t>(charCount);
 
-    // 각 토큰에 위치 정보 추가
-    int currentPos = 0;
-    int textLength = segment.text.length();
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        auto& token = tokens[i];
+        const std::size_t offset = sentence.SurfaceOffset(i);
+        const std::size_t charStart = charIndexAt[offset];
+        const std::size_t charEnd = charIndexAt[std::min(offset + token.surface.size(), segment.text.size())];
 
-    for (auto& token : tokens) {
         // 토큰의 boundingBox 계산
-        token.boundingBox = pImpl_->CalculateTokenBoundingBox(
-            segment.boundingBox,
-            textLength,
-            currentPos,
-            token.surface.length()
-        );
+        token.boundingBox = pImpl_->CalculateTokenBoundingBox(segment, charCount, charStart, charEnd - charStart);
 
         // OCR 신뢰도 상속
         token.confidence = segment.confidence;
-
-        currentPos += token.surface.length();
     }
 
     return tokens;
 }
 
 std::vector<Token> JapaneseTokenizer::TokenizeBatch(const std::vector<ocr::TextSegment>& segments) {
-    std::vector<Token> allTokens;
+    return TokenizeBatch(segments, concurrency::SharedThreadPool());
+}
 
-    for (const auto& segment : segments) {
-        auto tokens = TokenizeWithPosition(segment);
-        allTokens.insert(allTokens.end(), tokens.begin(), tokens.end());
+std::vector<Token> JapaneseTokenizer::TokenizeBatch(const std::vector<ocr::TextSegment>& segments,
+                                                    concurrency::ThreadPool& pool) {
+    // 세그먼트마다 독립적으로 분석 (Tagger/Lattice는 호출마다 풀에서 빌리므로 스레드별로 따로 쓰임)
+    std::vector<std::vector<Token>> perSegment(segments.size());
+    pool.ParallelFor(segments.size(), [&](std::size_t i) {
+        perSegment[i] = TokenizeWithPosition(segments[i]);
+    });
+
+    // 전체 크기를 먼저 정한 뒤 세그먼트 순서대로 이동
+    std::size_t total = 0;
+    for (const auto& tokens : perSegment) {
+        total += tokens.size();
+    }
+    std::vector<Token> allTokens;
+    allTokens.reserve(total);
+    for (std::size_t i = 0; i < perSegment.size(); ++i) {
+        for (auto& token : perSegment[i]) {
+            token.segmentIndex = i;
+            allTokens.push_back(std::move(token));
+        }
     }
 
     return allTokens;
 }
 
+bool JapaneseTokenizer::SetUserDictionary(const std::filesystem::path& userDicPath) {
+    if (!pImpl_->initialized) {
+        return false;
+    }
+
+    // 사용자 사전을 붙인 새 Model을 만든 뒤 교체 (진행 중인 분석은 이전 Model로 끝까지 수행)
+    const std::string userDic = userDicPath.string();
+    std::vector<const char*> argv = {"mecab", "-d", pImpl_->dictionaryDir.c_str()};
+    if (!userDic.empty()) {
+        argv.push_back("-u");
+        argv.push_back(userDic.c_str());
+    }
+    try {
+        std::shared_ptr<MeCab::Model> model(
+            MeCab::createModel(static_cast<int>(argv.size()), const_cast<char**>(argv.data())));
+        if (!model) {
+            return false;
+        }
+        pImpl_->SetModel(std::move(model));
+    } catch (...) {
+        return false;
+    }
+    pImpl_->userDictionary = userDicPath;
+    return true;
+}
+
+std::filesystem::path JapaneseTokenizer::GetUserDictionary() const {
+    return pImpl_->userDictionary;
+}
+
+std::filesystem::path JapaneseTokenizer::GetDictionaryDir() const {
+    return pImpl_->initialized ? std::filesystem::path(pImpl_->dictionaryDir) : std::filesystem::path();
+}
+
 bool JapaneseTokenizer::IsInitialized() const {
     return pImpl_->initialized;
 }
 
 void JapaneseTokenizer::Shutdown() {
-    if (pImpl_->initialized && pImpl_->tagger) {
-        delete pImpl_->tagger;
-        pImpl_->tagger = nullptr;
+    if (pImpl_->initialized) {
         pImpl_->initialized = false;
+        pImpl_->SetModel(nullptr);
     }
 }
 
@@ -1,12 +1,20 @@
 #pragma once
 
 #include "core/ocr/ocr_engine.h"
+#include "core/tokenizer/mecab_feature_parser.h"
+#include "core/tokenizer/tokenized_sentence.h"
 #include <opencv2/core.hpp>
+#include <filesystem>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 
 namespace toriyomi {
+namespace concurrency {
+class ThreadPool;
+}
+
 namespace tokenizer {
 
 /**
@@ -17,8 +25,10 @@ struct Token {
     std::string reading;        // 읽기 (キョウ 또는 きょう)
     std::string baseForm;       // 기본형
     std::string partOfSpeech;   // 품사 (名詞, 動詞 등)
+    PartOfSpeech posTag = PartOfSpeech::Unknown;  // 품사 열거값 (문자열 비교 대신 사용)
     cv::Rect boundingBox;       // 화면 상의 위치 (OCR 결과에서 계산)
     float confidence;           // 신뢰도 (OCR 결과 기반)
+    std::size_t segmentIndex = 0;   // TokenizeBatch 입력에서의 세그먼트 번호
 };
 
 /**
@@ -26,6 +36,11 @@ struct Token {
  * 
  * MeCab을 사용하여 일본어 텍스트를 형태소 단위로 분석.
  * OCR 결과와 결합하여 각 단어의 위치와 읽기 정보를 제공.
+ *
+ * 사전(MeCab::Model)은 한 번만 로드하고 호출마다 Tagger/Lattice를 풀에서 빌려 쓰므로
+ * Tokenize() 계열은 여러 스레드에서 별도 락 없이 동시에 호출할 수 있습니다.
+ * 호출 중 사전을 다시 로드해도 빌린 쪽이 이전 Model을 쥐고 있지만, JapaneseTokenizer 객체 자체는
+ * 호출하는 쪽이 진행 중인 모든 호출이 끝날 때까지 살려 두어야 합니다 (예: shared_ptr 복사본을 쥐고 호출).
  */
 class JapaneseTokenizer {
 public:
@@ -59,11 +74,22 @@ public:
      */
     std::vector<Token> Tokenize(const std::string& text);
 
+    /**
+     * @brief 토큰별 문자열 할당 없이 형태소 분석
+     *
+     * 표면형/읽기/기본형을 문장 단위 아레나의 오프셋으로 보관합니다.
+     * 문자열이 필요할 때만 TokenizedSentence::Materialize()로 변환하세요.
+     *
+     * @param text 입력 텍스트 (UTF-8)
+     * @return 아레나 기반 분석 결과 (미초기화/실패 시 빈 결과)
+     */
+    TokenizedSentence TokenizeCompact(std::string_view text);
+
     /**
      * @brief OCR 결과를 토큰으로 분리 (위치 정보 포함)
      * 
-     * TextSegment의 텍스트를 형태소 분석하고,
-     * boundingBox를 기준으로 각 토큰의 대략적인 위치를 계산.
+     * TextSegment의 텍스트를 형태소 분석하고, 글자별 영역(charBoxes)이 있으면
+     * 그것으로 정확한 위치를, 없으면 boundingBox를 글자 수 비례로 나눈 대략적인 위치를 계산.
      * 
      * @param segment OCR 인식 결과
      * @return 위치 정보가 포함된 토큰 목록
@@ -71,13 +97,42 @@ public:
     std::vector<Token> TokenizeWithPosition(const ocr::TextSegment& segment);
 
     /**
-     * @brief 여러 OCR 결과를 일괄 처리
+     * @brief 여러 OCR 결과를 일괄 처리 (공유 스레드 풀에서 세그먼트별 병렬 분석)
      * 
+     * 세그먼트 순서대로 이어 붙이며, 각 토큰의 segmentIndex로 경계를 알 수 있습니다.
+     *
      * @param segments OCR 인식 결과 목록
      * @return 모든 토큰의 결합된 목록
      */
     std::vector<Token> TokenizeBatch(const std::vector<ocr::TextSegment>& segments);
 
+    /**
+     * @brief 지정한 스레드 풀로 일괄 처리
+     */
+    std::vector<Token> TokenizeBatch(const std::vector<ocr::TextSegment>& segments,
+                                     concurrency::ThreadPool& pool);
+
+    /**
+     * @brief 사용자 사전 교체 (재시작 없이 적용)
+     *
+     * 새 MeCab Model을 만든 뒤 바꿔 끼우므로 이미 진행 중인 분석은 이전 사전으로 끝나고,
+     * 이후 호출부터 새 사전을 씁니다. 실패하면 기존 사전을 그대로 유지합니다.
+     *
+     * @param userDicPath mecab-dict-index로 만든 .dic 경로 (비어 있으면 사용자 사전 제거)
+     * @return 성공 여부
+     */
+    bool SetUserDictionary(const std::filesystem::path& userDicPath);
+
+    /**
+     * @brief 현재 붙어 있는 사용자 사전 경로 (없으면 빈 경로)
+     */
+    std::filesystem::path GetUserDictionary() const;
+
+    /**
+     * @brief Initialize()에서 사용한 시스템 사전 경로 (미초기화 시 빈 경로)
+     */
+    std::filesystem::path GetDictionaryDir() const;
+
     /**
      * @brief 초기화 상태 확인
      * 
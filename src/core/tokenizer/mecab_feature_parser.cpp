@@ -0,0 +1,122 @@
+// ToriYomi - MeCab feature 파서
+// string_view로 CSV를 한 번만 훑어 필요한 필드만 꺼냄
+
+#include "mecab_feature_parser.h"
+#include <array>
+#include <utility>
+
+namespace toriyomi {
+namespace tokenizer {
+
+namespace {
+
+constexpr std::size_t kPartOfSpeechField = 0;
+constexpr std::size_t kBaseFormField = 6;
+constexpr std::size_t kReadingField = 7;
+
+constexpr std::array<std::pair<std::string_view, PartOfSpeech>, 19> kPartOfSpeechTable = {{
+    {"名詞", PartOfSpeech::Noun},
+    {"代名詞", PartOfSpeech::Pronoun},
+    {"動詞", PartOfSpeech::Verb},
+    {"形容詞", PartOfSpeech::Adjective},
+    {"形状詞", PartOfSpeech::AdjectivalNoun},
+    {"副詞", PartOfSpeech::Adverb},
+    {"連体詞", PartOfSpeech::Adnominal},
+    {"接続詞", PartOfSpeech::Conjunction},
+    {"感動詞", PartOfSpeech::Interjection},
+    {"助詞", PartOfSpeech::Particle},
+    {"助動詞", PartOfSpeech::AuxiliaryVerb},
+    {"接頭詞", PartOfSpeech::Prefix},
+    {"接頭辞", PartOfSpeech::Prefix},
+    {"接尾辞", PartOfSpeech::Suffix},
+    {"記号", PartOfSpeech::Symbol},
+    {"補助記号", PartOfSpeech::Symbol},
+    {"フィラー", PartOfSpeech::Filler},
+    {"空白", PartOfSpeech::Whitespace},
+    {"その他", PartOfSpeech::Other},
+}};
+
+std::string_view NormalizeField(std::string_view field) {
+    return field == "*" ? std::string_view() : field;
+}
+
+}  // namespace
+
+PartOfSpeech ParsePartOfSpeech(std::string_view name) {
+    if (name.empty() || name == "*") {
+        return PartOfSpeech::Unknown;
+    }
+    for (const auto& [text, pos] : kPartOfSpeechTable) {
+        if (text == name) {
+            return pos;
+        }
+    }
+    return PartOfSpeech::Other;
+}
+
+std::string_view PartOfSpeechName(PartOfSpeech pos) {
+    if (pos == PartOfSpeech::Unknown || pos == PartOfSpeech::Other) {
+        return {};
+    }
+    // 표에서 처음 나오는 표기가 대표 표기 (接頭詞, 記号)
+    for (const auto& [text, value] : kPartOfSpeechTable) {
+        if (value == pos) {
+            return text;
+        }
+    }
+    return {};
+}
+
+MecabFeatureFields ParseMecabFeature(std::string_view feature) {
+    MecabFeatureFields fields;
+    std::size_t index = 0;
+    std::size_t pos = 0;
+
+    while (pos <= feature.size() && index <= kReadingField) {
+        std::string_view field;
+        if (pos < feature.size() && feature[pos] == '"') {
+            // 따옴표 필드: 닫는 따옴표까지 ("" 는 이스케이프)
+            std::size_t end = pos + 1;
+            while (end < feature.size()) {
+                if (feature[end] == '"') {
+                    if (end + 1 < feature.size() && feature[end + 1] == '"') {
+                        end += 2;
+                        continue;
+                    }
+                    break;
+                }
+                ++end;
+            }
+            field = feature.substr(pos + 1, end - pos - 1);
+            pos = feature.find(',', end);
+        } else {
+            const std::size_t comma = feature.find(',', pos);
+            field = feature.substr(pos, comma == std::string_view::npos ? std::string_view::npos : comma - pos);
+            pos = comma;
+        }
+
+        switch (index) {
+            case kPartOfSpeechField:
+                fields.partOfSpeech = NormalizeField(field);
+                break;
+            case kBaseFormField:
+                fields.baseForm = NormalizeField(field);
+                break;
+            case kReadingField:
+                fields.reading = NormalizeField(field);
+                break;
+            default:
+                break;
+        }
+
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        ++pos;
+        ++index;
+    }
+    return fields;
+}
+
+}  // namespace tokenizer
+}  // namespace toriyomi
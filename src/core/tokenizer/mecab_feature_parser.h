@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace toriyomi {
+namespace tokenizer {
+
+/**
+ * @brief 품사 대분류 (IPADIC/UniDic 첫 번째 feature 필드)
+ */
+enum class PartOfSpeech : std::uint8_t {
+    Unknown,        // 빈 값 또는 "*"
+    Noun,           // 名詞
+    Pronoun,        // 代名詞 (UniDic)
+    Verb,           // 動詞
+    Adjective,      // 形容詞
+    AdjectivalNoun, // 形状詞 (UniDic)
+    Adverb,         // 副詞
+    Adnominal,      // 連体詞
+    Conjunction,    // 接続詞
+    Interjection,   // 感動詞
+    Particle,       // 助詞
+    AuxiliaryVerb,  // 助動詞
+    Prefix,         // 接頭詞 / 接頭辞
+    Suffix,         // 接尾辞 (UniDic)
+    Symbol,         // 記号 / 補助記号
+    Filler,         // フィラー
+    Whitespace,     // 空白 (UniDic)
+    Other           // 표에 없는 값 (원문은 별도로 보관)
+};
+
+/**
+ * @brief 품사 문자열을 열거값으로 변환 (할당 없음)
+ */
+PartOfSpeech ParsePartOfSpeech(std::string_view name);
+
+/**
+ * @brief 열거값의 대표 표기 (Unknown/Other는 빈 문자열)
+ */
+std::string_view PartOfSpeechName(PartOfSpeech pos);
+
+/**
+ * @brief MeCab feature CSV에서 필요한 필드만 가리키는 뷰
+ *
+ * "*"는 빈 뷰로 정규화됩니다. 뷰는 입력 feature 문자열을 가리킵니다.
+ */
+struct MecabFeatureFields {
+    std::string_view partOfSpeech;   // 0번 필드
+    std::string_view baseForm;       // 6번 필드
+    std::string_view reading;        // 7번 필드
+};
+
+/**
+ * @brief feature CSV를 한 번만 훑어 필드 추출
+ *
+ * 따옴표로 감싼 필드("a,b")도 처리하며, 메모리를 할당하지 않습니다.
+ */
+MecabFeatureFields ParseMecabFeature(std::string_view feature);
+
+}  // namespace tokenizer
+}  // namespace toriyomi
@@ -0,0 +1,332 @@
+// ToriYomi - 읽기/표면형 정렬 구현
+
+#include "ruby_aligner.h"
+#include "common/text/unicode_utils.h"
+#include <algorithm>
+#include <fstream>
+#include <optional>
+
+namespace toriyomi {
+namespace tokenizer {
+
+namespace {
+
+// 배분 후보를 끝까지 세지 않도록 상한 (토큰은 짧으므로 거의 닿지 않음)
+constexpr std::size_t kMaxAlignments = 32;
+
+using CodePoints = std::u32string;
+
+char32_t ToHiragana(char32_t cp) {
+    if ((cp >= 0x30A1 && cp <= 0x30F6) || cp == 0x30FD || cp == 0x30FE) {
+        return cp - 0x60;
+    }
+    return cp;
+}
+
+CodePoints DecodeHiragana(std::string_view text) {
+    CodePoints result;
+    result.reserve(text.size() / 3 + 1);
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        result.push_back(ToHiragana(text::DecodeUtf8(text, pos)));
+    }
+    return result;
+}
+
+std::string EncodeUtf8(const CodePoints& codePoints, std::size_t start, std::size_t length) {
+    std::string result;
+    result.reserve(length * 3);
+    for (std::size_t i = start; i < start + length; ++i) {
+        text::AppendUtf8(result, codePoints[i]);
+    }
+    return result;
+}
+
+// 연탁: か→が, は→ば/ぱ 등
+void AppendVoicedVariants(char32_t cp, std::vector<char32_t>& out) {
+    if ((cp >= 0x304B && cp <= 0x3062 && (cp - 0x304B) % 2 == 0) ||
+        cp == 0x3064 || cp == 0x3066 || cp == 0x3068) {
+        out.push_back(cp + 1);
+    } else if (cp >= 0x306F && cp <= 0x307B && (cp - 0x306F) % 3 == 0) {
+        out.push_back(cp + 1);
+        out.push_back(cp + 2);
+    }
+}
+
+bool IsGeminationSource(char32_t cp) {
+    return cp == U'つ' || cp == U'く' || cp == U'ち' || cp == U'き';
+}
+
+/**
+ * @brief 읽기 표의 한 읽기가 reading[pos..]에 맞으면 소비한 길이 반환
+ *
+ * 첫 글자 연탁, 마지막 글자 촉음화(っ)를 허용합니다.
+ */
+std::optional<std::size_t> MatchTableReading(const CodePoints& entry,
+                                             const CodePoints& reading,
+                                             std::size_t pos,
+                                             std::size_t end) {
+    if (entry.empty() || pos + entry.size() > end) {
+        return std::nullopt;
+    }
+    for (std::size_t i = 0; i < entry.size(); ++i) {
+        const char32_t expected = entry[i];
+        const char32_t actual = reading[pos + i];
+        if (expected == actual) {
+            continue;
+        }
+        if (i == 0) {
+            std::vector<char32_t> variants;
+            AppendVoicedVariants(expected, variants);
+            if (std::find(variants.begin(), variants.end(), actual) != variants.end()) {
+                continue;
+            }
+        }
+        if (i + 1 == entry.size() && entry.size() > 1 && actual == U'っ' && IsGeminationSource(expected)) {
+            continue;
+        }
+        return std::nullopt;
+    }
+    return entry.size();
+}
+
+/**
+ * @brief 한자 구간을 읽기 표로 글자 단위 분해 (성공하면 글자별 읽기 길이)
+ */
+bool DecomposeKanjiRun(const CodePoints& surface,
+                       std::size_t charStart,
+                       std::size_t charEnd,
+                       const CodePoints& reading,
+                       std::size_t readStart,
+                       std::size_t readEnd,
+                       const KanjiReadingTable& table,
+                       std::vector<std::size_t>& lengths) {
+    if (charStart == charEnd) {
+        return readStart == readEnd;
+    }
+    const auto* entries = table.Find(surface[charStart]);
+    if (!entries) {
+        return false;
+    }
+    for (const auto& entry : *entries) {
+        const CodePoints decoded = DecodeHiragana(entry);
+        const auto matched = MatchTableReading(decoded, reading, readStart, readEnd);
+        if (!matched) {
+            continue;
+        }
+        lengths.push_back(*matched);
+        if (DecomposeKanjiRun(surface, charStart + 1, charEnd, reading, readStart + *matched,
+                              readEnd, table, lengths)) {
+            return true;
+        }
+        lengths.pop_back();
+    }
+    return false;
+}
+
+struct Run {
+    std::size_t charStart = 0;
+    std::size_t charLength = 0;
+    bool kanji = false;
+};
+
+struct Assignment {
+    std::size_t readStart = 0;
+    std::size_t readLength = 0;
+};
+
+class Aligner {
+public:
+    Aligner(const CodePoints& surface, const CodePoints& reading, std::vector<Run> runs)
+        : surface_(surface), reading_(reading), runs_(std::move(runs)), current_(runs_.size()) {}
+
+    std::vector<std::vector<Assignment>> Solve() {
+        Search(0, 0);
+        return std::move(solutions_);
+    }
+
+private:
+    void Search(std::size_t runIndex, std::size_t readPos) {
+        if (solutions_.size() >= kMaxAlignments) {
+            return;
+        }
+        if (runIndex == runs_.size()) {
+            if (readPos == reading_.size()) {
+                solutions_.push_back(current_);
+            }
+            return;
+        }
+
+        const Run& run = runs_[runIndex];
+        if (!run.kanji) {
+            // 가나 구간은 읽기와 글자 그대로 일치해야 함
+            if (readPos + run.charLength > reading_.size()) {
+                return;
+            }
+            for (std::size_t i = 0; i < run.charLength; ++i) {
+                if (surface_[run.charStart + i] != reading_[readPos + i]) {
+                    return;
+                }
+            }
+            current_[runIndex] = {readPos, run.charLength};
+            Search(runIndex + 1, readPos + run.charLength);
+            return;
+        }
+
+        // 한자 구간: 뒤에 남은 가나 구간 길이만큼은 남겨 두고 짧은 읽기부터 시도
+        std::size_t reserved = 0;
+        for (std::size_t i = runIndex + 1; i < runs_.size(); ++i) {
+            reserved += runs_[i].kanji ? 1 : runs_[i].charLength;
+        }
+        for (std::size_t length = 1; readPos + length + reserved <= reading_.size(); ++length) {
+            current_[runIndex] = {readPos, length};
+            Search(runIndex + 1, readPos + length);
+        }
+    }
+
+    const CodePoints& surface_;
+    const CodePoints& reading_;
+    std::vector<Run> runs_;
+    std::vector<Assignment> current_;
+    std::vector<std::vector<Assignment>> solutions_;
+};
+
+}  // namespace
+
+bool KanjiReadingTable::LoadFromFile(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+        const std::size_t tab = line.find('\t');
+        if (tab == std::string::npos || tab == 0) {
+            continue;
+        }
+        std::size_t pos = 0;
+        const char32_t kanji = text::DecodeUtf8(line, pos);
+        if (pos != tab || !text::IsKanji(kanji)) {
+            continue;
+        }
+
+        std::string_view readings = std::string_view(line).substr(tab + 1);
+        while (!readings.empty()) {
+            const std::size_t comma = readings.find(',');
+            Add(kanji, readings.substr(0, comma));
+            if (comma == std::string_view::npos) {
+                break;
+            }
+            readings.remove_prefix(comma + 1);
+        }
+    }
+    return true;
+}
+
+void KanjiReadingTable::Add(char32_t kanji, std::string_view reading) {
+    if (reading.empty()) {
+        return;
+    }
+    std::string hiragana = text::KatakanaToHiragana(reading);
+    auto& entries = readings_[kanji];
+    if (std::find(entries.begin(), entries.end(), hiragana) == entries.end()) {
+        entries.push_back(std::move(hiragana));
+    }
+}
+
+const std::vector<std::string>* KanjiReadingTable::Find(char32_t kanji) const {
+    const auto it = readings_.find(kanji);
+    return it == readings_.end() ? nullptr : &it->second;
+}
+
+std::vector<RubySegment> AlignRuby(std::string_view surface,
+                                   std::string_view reading,
+                                   const KanjiReadingTable* table) {
+    const CodePoints surfaceChars = DecodeHiragana(surface);
+    const CodePoints readingChars = DecodeHiragana(reading);
+    if (surfaceChars.empty() || readingChars.empty()) {
+        return {};
+    }
+
+    std::vector<Run> runs;
+    bool hasKanji = false;
+    for (std::size_t i = 0; i < surfaceChars.size(); ++i) {
+        const bool kanji = text::IsKanji(surfaceChars[i]);
+        hasKanji = hasKanji || kanji;
+        if (!runs.empty() && runs.back().kanji == kanji) {
+            ++runs.back().charLength;
+        } else {
+            runs.push_back({i, 1, kanji});
+        }
+    }
+    // 읽기에 한자가 남아 있으면 실제 읽기가 아님 (미지어)
+    if (!hasKanji || text::ContainsKanji(reading)) {
+        return {};
+    }
+
+    Aligner aligner(surfaceChars, readingChars, runs);
+    const auto solutions = aligner.Solve();
+    if (solutions.empty()) {
+        return {};
+    }
+
+    // 읽기 표로 분해되는 한자 구간이 가장 많은 배분 선택 (동점이면 먼저 찾은 것)
+    std::size_t bestIndex = 0;
+    int bestScore = -1;
+    for (std::size_t s = 0; s < solutions.size() && table; ++s) {
+        int score = 0;
+        for (std::size_t r = 0; r < runs.size(); ++r) {
+            if (!runs[r].kanji) {
+                continue;
+            }
+            std::vector<std::size_t> lengths;
+            const auto& assigned = solutions[s][r];
+            if (DecomposeKanjiRun(surfaceChars, runs[r].charStart, runs[r].charStart + runs[r].charLength,
+                                  readingChars, assigned.readStart, assigned.readStart + assigned.readLength,
+                                  *table, lengths)) {
+                ++score;
+            }
+        }
+        if (score > bestScore) {
+            bestScore = score;
+            bestIndex = s;
+        }
+    }
+
+    std::vector<RubySegment> segments;
+    const auto& best = solutions[bestIndex];
+    for (std::size_t r = 0; r < runs.size(); ++r) {
+        if (!runs[r].kanji) {
+            continue;
+        }
+        const Run& run = runs[r];
+        const Assignment& assigned = best[r];
+
+        // 글자 단위로 나눌 수 있으면 모노 루비, 아니면 구간 전체에 그룹 루비 (숙자훈 등)
+        std::vector<std::size_t> lengths;
+        if (table && run.charLength > 1 &&
+            DecomposeKanjiRun(surfaceChars, run.charStart, run.charStart + run.charLength,
+                              readingChars, assigned.readStart, assigned.readStart + assigned.readLength,
+                              *table, lengths)) {
+            std::size_t readPos = assigned.readStart;
+            for (std::size_t i = 0; i < run.charLength; ++i) {
+                segments.push_back({run.charStart + i, 1, EncodeUtf8(readingChars, readPos, lengths[i])});
+                readPos += lengths[i];
+            }
+            continue;
+        }
+        segments.push_back({run.charStart, run.charLength,
+                            EncodeUtf8(readingChars, assigned.readStart, assigned.readLength)});
+    }
+    return segments;
+}
+
+}  // namespace tokenizer
+}  // namespace toriyomi
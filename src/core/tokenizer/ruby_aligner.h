@@ -0,0 +1,77 @@
+// ToriYomi - 읽기/표면형 정렬
+// 토큰 읽기를 한자 구간별로 나눠 오쿠리가나를 제외한 루비를 만듦
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace toriyomi {
+namespace tokenizer {
+
+/**
+ * @brief 한자별 읽기 표 (히라가나, 음독/훈독 구분 없음)
+ *
+ * 정렬 후보가 여러 개일 때 고르는 기준과,
+ * 한자 여러 개짜리 구간을 글자 단위로 나누는 데 사용합니다.
+ */
+class KanjiReadingTable {
+public:
+    /**
+     * @brief TSV 파일 로드 ("漢\tかん,おとこ" 형식, #으로 시작하는 줄은 주석)
+     *
+     * @return 파일을 읽었으면 true
+     */
+    bool LoadFromFile(const std::filesystem::path& path);
+
+    /**
+     * @brief 읽기 추가 (가타카나는 히라가나로 변환해서 저장)
+     */
+    void Add(char32_t kanji, std::string_view reading);
+
+    /**
+     * @brief 한자의 읽기 목록 (없으면 nullptr)
+     */
+    const std::vector<std::string>* Find(char32_t kanji) const;
+
+    std::size_t Size() const { return readings_.size(); }
+
+private:
+    std::unordered_map<char32_t, std::vector<std::string>> readings_;
+};
+
+/**
+ * @brief 한자 구간 하나에 붙는 루비
+ */
+struct RubySegment {
+    std::size_t charStart = 0;    // 표면형 기준 글자(코드포인트) 위치
+    std::size_t charLength = 0;
+    std::string reading;          // 히라가나
+};
+
+/**
+ * @brief 표면형을 한자 구간/가나 구간으로 나누고 읽기를 한자 구간에 배분
+ *
+ * 가나 구간(오쿠리가나 등)은 읽기와 글자 그대로 맞춰야 하며,
+ * 한자 구간은 최소 한 글자 이상의 읽기를 가져갑니다.
+ * 가능한 배분이 여러 개면 읽기 표와 더 많이 맞는 쪽을 고르고,
+ * 읽기 표로 나눌 수 있는 한자 구간은 글자 단위 루비로 나눕니다.
+ *
+ * 예) 食べる / たべる → [食: た]
+ *     取り扱い / とりあつかい → [取: と], [扱: あつか]
+ *
+ * @param surface 표면형 (UTF-8)
+ * @param reading 읽기 (UTF-8, 가타카나 가능)
+ * @param table 읽기 표 (nullptr 허용)
+ * @return 한자 구간별 루비 (한자가 없거나 맞출 수 없으면 빈 목록)
+ */
+std::vector<RubySegment> AlignRuby(std::string_view surface,
+                                   std::string_view reading,
+                                   const KanjiReadingTable* table = nullptr);
+
+}  // namespace tokenizer
+}  // namespace toriyomi
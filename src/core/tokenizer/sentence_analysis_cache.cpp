@@ -0,0 +1,368 @@
+// ToriYomi - 문장 분석 결과 캐시 구현
+
+#include "sentence_analysis_cache.h"
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+namespace toriyomi {
+namespace tokenizer {
+
+namespace {
+
+constexpr int kCacheFileVersion = 1;
+constexpr std::size_t kMaxFileNameBytes = 120;
+
+// 항목 하나당 리스트/맵 노드 등 고정 오버헤드 추정치
+constexpr std::size_t kEntryOverheadBytes = 128;
+
+constexpr std::string_view kIdeographicSpace = "\xE3\x80\x80";  // U+3000
+
+bool IsAsciiSpace(char ch) {
+    return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == '\f' || ch == '\v';
+}
+
+std::size_t EstimateBytes(const std::string& key, const SentenceAnalysis& analysis) {
+    std::size_t bytes = kEntryOverheadBytes + key.size();
+    for (const auto& token : analysis.tokens) {
+        bytes += sizeof(Token) + token.surface.size() + token.reading.size() +
+                 token.baseForm.size() + token.partOfSpeech.size();
+    }
+    for (const auto& info : analysis.furigana) {
+        bytes += sizeof(FuriganaInfo) + info.baseText.size() + info.reading.size();
+        for (const auto& span : info.rubySpans) {
+            bytes += sizeof(RubySpan) + span.baseText.size() + span.reading.size();
+        }
+    }
+    return bytes;
+}
+
+nlohmann::json ToJson(const std::string& key, const SentenceAnalysis& analysis) {
+    nlohmann::json tokens = nlohmann::json::array();
+    for (const auto& token : analysis.tokens) {
+        tokens.push_back({
+            {"surface", token.surface},
+            {"reading", token.reading},
+            {"base_form", token.baseForm},
+            {"pos", token.partOfSpeech},
+        });
+    }
+    nlohmann::json furigana = nlohmann::json::array();
+    for (const auto& info : analysis.furigana) {
+        nlohmann::json spans = nlohmann::json::array();
+        for (const auto& span : info.rubySpans) {
+            spans.push_back({{"base", span.baseText}, {"reading", span.reading}});
+        }
+        furigana.push_back({
+            {"base", info.baseText},
+            {"reading", info.reading},
+            {"ruby", info.needsRuby},
+            {"spans", std::move(spans)},
+        });
+    }
+    return {{"text", key}, {"tokens", std::move(tokens)}, {"furigana", std::move(furigana)}};
+}
+
+SentenceAnalysis FromJson(const nlohmann::json& entry) {
+    SentenceAnalysis analysis;
+    for (const auto& item : entry.at("tokens")) {
+        Token token{};
+        token.surface = item.at("surface").get<std::string>();
+        token.reading = item.at("reading").get<std::string>();
+        token.baseForm = item.at("base_form").get<std::string>();
+        token.partOfSpeech = item.at("pos").get<std::string>();
+        token.posTag = ParsePartOfSpeech(token.partOfSpeech);
+        analysis.tokens.push_back(std::move(token));
+    }
+    if (entry.contains("furigana")) {
+        for (const auto& item : entry.at("furigana")) {
+            FuriganaInfo info{};
+            info.baseText = item.at("base").get<std::string>();
+            info.reading = item.at("reading").get<std::string>();
+            info.needsRuby = item.at("ruby").get<bool>();
+            if (item.contains("spans")) {
+                for (const auto& spanItem : item.at("spans")) {
+                    RubySpan span{};
+                    span.baseText = spanItem.at("base").get<std::string>();
+                    span.reading = spanItem.at("reading").get<std::string>();
+                    info.rubySpans.push_back(std::move(span));
+                }
+            }
+            analysis.furigana.push_back(std::move(info));
+        }
+    }
+    return analysis;
+}
+
+}  // namespace
+
+class SentenceAnalysisCache::Impl {
+public:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const SentenceAnalysis> analysis;
+        std::size_t bytes = 0;
+    };
+
+    explicit Impl(std::size_t maxBytes) : maxBytes(maxBytes) {}
+
+    // 앞쪽이 가장 최근에 사용된 항목
+    std::list<Entry> lru;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::size_t bytes = 0;
+    std::size_t maxBytes;
+    SentenceCacheStats stats;
+    std::string signature;      // 항목을 분석할 때 쓴 사전 식별자
+    mutable std::mutex mutex;
+
+    /**
+     * @brief 항목 저장 (mutex를 잡은 상태에서 호출)
+     */
+    void InsertLocked(std::string key, std::shared_ptr<const SentenceAnalysis> analysis) {
+        const std::size_t entryBytes = EstimateBytes(key, *analysis);
+        auto existing = index.find(key);
+        if (existing != index.end()) {
+            bytes -= existing->second->bytes;
+            lru.erase(existing->second);
+            index.erase(existing);
+        }
+        if (entryBytes > maxBytes) {
+            return;
+        }
+
+        lru.push_front(Entry{key, std::move(analysis), entryBytes});
+        index.emplace(std::move(key), lru.begin());
+        bytes += entryBytes;
+        ++stats.insertions;
+        EvictLocked();
+    }
+
+    void EvictLocked() {
+        while (bytes > maxBytes && !lru.empty()) {
+            const Entry& oldest = lru.back();
+            bytes -= oldest.bytes;
+            index.erase(oldest.key);
+            lru.pop_back();
+            ++stats.evictions;
+        }
+    }
+};
+
+SentenceAnalysisCache::SentenceAnalysisCache(std::size_t maxBytes)
+    : pImpl_(std::make_unique<Impl>(maxBytes)) {
+}
+
+SentenceAnalysisCache::~SentenceAnalysisCache() = default;
+
+std::string SentenceAnalysisCache::NormalizeKey(std::string_view text) {
+    // 앞뒤 공백 (ASCII + 전각 공백) 제거
+    while (true) {
+        if (!text.empty() && IsAsciiSpace(text.front())) {
+            text.remove_prefix(1);
+        } else if (text.substr(0, kIdeographicSpace.size()) == kIdeographicSpace) {
+            text.remove_prefix(kIdeographicSpace.size());
+        } else {
+            break;
+        }
+    }
+    while (true) {
+        if (!text.empty() && IsAsciiSpace(text.back())) {
+            text.remove_suffix(1);
+        } else if (text.size() >= kIdeographicSpace.size() &&
+                   text.substr(text.size() - kIdeographicSpace.size()) == kIdeographicSpace) {
+            text.remove_suffix(kIdeographicSpace.size());
+        } else {
+            break;
+        }
+    }
+
+    // OCR 줄 단위 결합에서 생긴 줄바꿈은 문장 내용과 무관
+    std::string key;
+    key.reserve(text.size());
+    for (const char ch : text) {
+        if (ch != '\r' && ch != '\n') {
+            key.push_back(ch);
+        }
+    }
+    return key;
+}
+
+std::shared_ptr<const SentenceAnalysis> SentenceAnalysisCache::Find(std::string_view text) {
+    const std::string key = NormalizeKey(text);
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    auto it = pImpl_->index.find(key);
+    if (it == pImpl_->index.end()) {
+        ++pImpl_->stats.misses;
+        return nullptr;
+    }
+    ++pImpl_->stats.hits;
+    pImpl_->lru.splice(pImpl_->lru.begin(), pImpl_->lru, it->second);
+    return it->second->analysis;
+}
+
+std::shared_ptr<const SentenceAnalysis> SentenceAnalysisCache::Insert(std::string_view text,
+                                                                      SentenceAnalysis analysis) {
+    auto shared = std::make_shared<const SentenceAnalysis>(std::move(analysis));
+    std::string key = NormalizeKey(text);
+    if (key.empty()) {
+        return shared;
+    }
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    pImpl_->InsertLocked(std::move(key), shared);
+    return shared;
+}
+
+void SentenceAnalysisCache::SetMaxBytes(std::size_t maxBytes) {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    pImpl_->maxBytes = maxBytes;
+    pImpl_->EvictLocked();
+}
+
+void SentenceAnalysisCache::Clear() {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    pImpl_->lru.clear();
+    pImpl_->index.clear();
+    pImpl_->bytes = 0;
+}
+
+void SentenceAnalysisCache::SetSignature(std::string_view signature) {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    if (pImpl_->signature == signature) {
+        return;
+    }
+    pImpl_->signature = std::string(signature);
+    pImpl_->lru.clear();
+    pImpl_->index.clear();
+    pImpl_->bytes = 0;
+}
+
+std::string SentenceAnalysisCache::GetSignature() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    return pImpl_->signature;
+}
+
+SentenceCacheStats SentenceAnalysisCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    SentenceCacheStats stats = pImpl_->stats;
+    stats.entries = pImpl_->lru.size();
+    stats.bytes = pImpl_->bytes;
+    stats.maxBytes = pImpl_->maxBytes;
+    return stats;
+}
+
+bool SentenceAnalysisCache::SaveToFile(const std::filesystem::path& path) const {
+    nlohmann::json entries = nlohmann::json::array();
+    std::string signature;
+    {
+        std::lock_guard<std::mutex> lock(pImpl_->mutex);
+        for (const auto& entry : pImpl_->lru) {
+            entries.push_back(ToJson(entry.key, *entry.analysis));
+        }
+        signature = pImpl_->signature;
+    }
+    const nlohmann::json doc = {{"version", kCacheFileVersion},
+                                {"signature", std::move(signature)},
+                                {"entries", std::move(entries)}};
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out << doc.dump();
+        if (!out) {
+            return false;
+        }
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+bool SentenceAnalysisCache::LoadFromFile(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    const nlohmann::json doc = nlohmann::json::parse(in, nullptr, false);
+    if (doc.is_discarded() || !doc.is_object() ||
+        doc.value("version", 0) != kCacheFileVersion || !doc.contains("entries")) {
+        return false;
+    }
+
+    std::vector<std::pair<std::string, SentenceAnalysis>> loaded;
+    try {
+        for (const auto& entry : doc.at("entries")) {
+            loaded.emplace_back(NormalizeKey(entry.at("text").get<std::string>()), FromJson(entry));
+        }
+    } catch (const nlohmann::json::exception&) {
+        return false;
+    }
+
+    // 파일은 최근 사용 순서로 저장되어 있으므로 오래된 것부터 넣어 순서를 복원
+    std::lock_guard<std::mutex> lock(pImpl_->mutex);
+    if (doc.value("signature", std::string()) != pImpl_->signature) {
+        // 다른 사용자 사전으로 분석한 결과
+        return false;
+    }
+    for (auto it = loaded.rbegin(); it != loaded.rend(); ++it) {
+        if (it->first.empty()) {
+            continue;
+        }
+        pImpl_->InsertLocked(std::move(it->first),
+                             std::make_shared<const SentenceAnalysis>(std::move(it->second)));
+    }
+    return true;
+}
+
+std::string SentenceAnalysisCache::MakeCacheFileName(std::string_view title) {
+    std::string name;
+    name.reserve(title.size());
+    for (const char ch : title) {
+        const unsigned char byte = static_cast<unsigned char>(ch);
+        const bool reserved = byte < 0x20 || ch == '<' || ch == '>' || ch == ':' || ch == '"' ||
+                              ch == '/' || ch == '\\' || ch == '|' || ch == '?' || ch == '*';
+        name.push_back(reserved ? '_' : ch);
+    }
+
+    // 앞뒤 공백/점은 Windows 파일 이름에서 문제가 됨
+    while (!name.empty() && (name.back() == ' ' || name.back() == '.')) {
+        name.pop_back();
+    }
+    while (!name.empty() && (name.front() == ' ' || name.front() == '.')) {
+        name.erase(name.begin());
+    }
+
+    if (name.size() > kMaxFileNameBytes) {
+        // UTF-8 문자 중간에서 자르지 않도록 연속 바이트는 건너뜀
+        std::size_t cut = kMaxFileNameBytes;
+        while (cut > 0 && (static_cast<unsigned char>(name[cut]) & 0xC0) == 0x80) {
+            --cut;
+        }
+        name.resize(cut);
+    }
+    if (name.empty()) {
+        name = "untitled";
+    }
+    return name + ".json";
+}
+
+}  // namespace tokenizer
+}  // namespace toriyomi
@@ -0,0 +1,125 @@
+// ToriYomi - 문장 분석 결과 캐시
+// 같은 문장이 다시 나오면 형태소 분석/후리가나 매핑을 건너뜀
+
+#pragma once
+
+#include "japanese_tokenizer.h"
+#include "furigana_mapper.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace toriyomi {
+namespace tokenizer {
+
+/**
+ * @brief 한 문장의 분석 결과 (토큰 + 후리가나)
+ */
+struct SentenceAnalysis {
+    std::vector<Token> tokens;
+    std::vector<FuriganaInfo> furigana;
+};
+
+/**
+ * @brief 캐시 통계
+ */
+struct SentenceCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t insertions = 0;
+    std::uint64_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t bytes = 0;       // 추정 사용량
+    std::size_t maxBytes = 0;
+};
+
+/**
+ * @brief 정규화된 문장 텍스트를 키로 하는 LRU 캐시 (바이트 상한)
+ *
+ * 백로그, 반복 선택지, 메뉴 뒤 재표시처럼 같은 문장이 자주 다시 나오므로
+ * JapaneseTokenizer::Tokenize / FuriganaMapper::MapTokensToFurigana 앞에 둡니다.
+ * 게임 타이틀별로 파일에 저장해 두면 다음 세션이 채워진 캐시로 시작합니다.
+ *
+ * 모든 메서드는 스레드 안전합니다. 반환된 결과는 불변이며 축출 후에도 유효합니다.
+ */
+class SentenceAnalysisCache {
+public:
+    static constexpr std::size_t kDefaultMaxBytes = 8 * 1024 * 1024;
+
+    explicit SentenceAnalysisCache(std::size_t maxBytes = kDefaultMaxBytes);
+    ~SentenceAnalysisCache();
+
+    SentenceAnalysisCache(const SentenceAnalysisCache&) = delete;
+    SentenceAnalysisCache& operator=(const SentenceAnalysisCache&) = delete;
+
+    /**
+     * @brief 캐시 키 정규화 (앞뒤 공백/전각 공백 제거, 줄바꿈 제거)
+     */
+    static std::string NormalizeKey(std::string_view text);
+
+    /**
+     * @brief 캐시 조회 (적중 시 최근 사용으로 갱신)
+     *
+     * @return 적중하면 분석 결과, 아니면 nullptr
+     */
+    std::shared_ptr<const SentenceAnalysis> Find(std::string_view text);
+
+    /**
+     * @brief 분석 결과 저장 (상한을 넘으면 오래된 항목부터 축출)
+     *
+     * 상한보다 큰 단일 항목은 저장하지 않고 결과만 돌려줍니다.
+     *
+     * @return 저장된(또는 저장을 시도한) 분석 결과
+     */
+    std::shared_ptr<const SentenceAnalysis> Insert(std::string_view text, SentenceAnalysis analysis);
+
+    /**
+     * @brief 바이트 상한 변경 (줄이면 즉시 축출)
+     */
+    void SetMaxBytes(std::size_t maxBytes);
+
+    void Clear();
+
+    /**
+     * @brief 분석에 쓴 사전 식별자 지정 (사용자 사전 파일 이름 등, 시스템 사전만 쓰면 빈 문자열)
+     *
+     * 사전이 바뀌면 분할 결과가 달라지므로 이전 식별자와 다르면 모든 항목을 버립니다.
+     * 파일로 저장할 때 함께 기록하며, 다른 식별자로 저장된 파일은 읽지 않습니다.
+     */
+    void SetSignature(std::string_view signature);
+    std::string GetSignature() const;
+
+    SentenceCacheStats GetStats() const;
+
+    /**
+     * @brief 캐시 내용을 JSON 파일로 저장 (최근 사용 순서 유지)
+     *
+     * 임시 파일에 쓴 뒤 교체하므로 중간에 실패해도 기존 파일은 보존됩니다.
+     */
+    bool SaveToFile(const std::filesystem::path& path) const;
+
+    /**
+     * @brief JSON 파일에서 캐시 복원 (기존 항목에 추가, 상한 적용)
+     *
+     * @return 파일을 읽었으면 true (파일이 없거나 형식/사전 식별자가 틀리면 false)
+     */
+    bool LoadFromFile(const std::filesystem::path& path);
+
+    /**
+     * @brief 게임 타이틀을 파일 이름으로 쓸 수 있게 변환
+     *
+     * 파일 시스템 예약 문자를 '_'로 바꾸고 너무 길면 자릅니다.
+     */
+    static std::string MakeCacheFileName(std::string_view title);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+}  // namespace tokenizer
+}  // namespace toriyomi
@@ -0,0 +1,100 @@
+// ToriYomi - 문장 단위 토큰 아레나
+
+#include "tokenized_sentence.h"
+#include "japanese_tokenizer.h"
+
+namespace toriyomi {
+namespace tokenizer {
+
+TokenizedSentence::TokenizedSentence(std::string_view text)
+    : textLength_(static_cast<std::uint32_t>(text.size())) {
+    // 읽기(가타카나)가 표면형과 다른 경우가 많으므로 여유 있게 예약
+    arena_.reserve(text.size() * 2);
+    arena_.append(text);
+}
+
+bool TokenizedSentence::AddToken(std::size_t surfaceOffset,
+                                 std::size_t surfaceLength,
+                                 const MecabFeatureFields& fields) {
+    if (surfaceOffset > textLength_ || surfaceLength > textLength_ - surfaceOffset) {
+        return false;
+    }
+
+    Record record;
+    record.surface = {static_cast<std::uint32_t>(surfaceOffset), static_cast<std::uint32_t>(surfaceLength)};
+    record.reading = Intern(fields.reading, record.surface);
+    record.baseForm = Intern(fields.baseForm, record.surface);
+    record.partOfSpeech = ParsePartOfSpeech(fields.partOfSpeech);
+    if (!fields.partOfSpeech.empty() && PartOfSpeechName(record.partOfSpeech) != fields.partOfSpeech) {
+        record.partOfSpeechText = Intern(fields.partOfSpeech, Span{});
+    }
+    records_.push_back(record);
+    return true;
+}
+
+TokenizedSentence::Span TokenizedSentence::Intern(std::string_view value, const Span& surface) {
+    if (value.empty() || value == View(surface)) {
+        return surface;
+    }
+    Span span{static_cast<std::uint32_t>(arena_.size()), static_cast<std::uint32_t>(value.size())};
+    arena_.append(value);
+    return span;
+}
+
+std::string_view TokenizedSentence::View(const Span& span) const {
+    return std::string_view(arena_).substr(span.offset, span.length);
+}
+
+std::string_view TokenizedSentence::Text() const {
+    return std::string_view(arena_).substr(0, textLength_);
+}
+
+std::string_view TokenizedSentence::Surface(std::size_t index) const {
+    return View(records_.at(index).surface);
+}
+
+std::string_view TokenizedSentence::Reading(std::size_t index) const {
+    return View(records_.at(index).reading);
+}
+
+std::string_view TokenizedSentence::BaseForm(std::size_t index) const {
+    return View(records_.at(index).baseForm);
+}
+
+std::string_view TokenizedSentence::PartOfSpeechText(std::size_t index) const {
+    const Record& record = records_.at(index);
+    if (record.partOfSpeechText.length > 0) {
+        return View(record.partOfSpeechText);
+    }
+    return PartOfSpeechName(record.partOfSpeech);
+}
+
+PartOfSpeech TokenizedSentence::PartOfSpeechAt(std::size_t index) const {
+    return records_.at(index).partOfSpeech;
+}
+
+std::size_t TokenizedSentence::SurfaceOffset(std::size_t index) const {
+    return records_.at(index).surface.offset;
+}
+
+Token TokenizedSentence::Materialize(std::size_t index) const {
+    Token token{};
+    token.surface = std::string(Surface(index));
+    token.reading = std::string(Reading(index));
+    token.baseForm = std::string(BaseForm(index));
+    token.partOfSpeech = std::string(PartOfSpeechText(index));
+    token.posTag = PartOfSpeechAt(index);
+    return token;
+}
+
+std::vector<Token> TokenizedSentence::MaterializeAll() const {
+    std::vector<Token> tokens;
+    tokens.reserve(records_.size());
+    for (std::size_t i = 0; i < records_.size(); ++i) {
+        tokens.push_back(Materialize(i));
+    }
+    return tokens;
+}
+
+}  // namespace tokenizer
+}  // namespace toriyomi
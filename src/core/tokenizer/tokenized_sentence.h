@@ -0,0 +1,99 @@
+#pragma once
+
+#include "core/tokenizer/mecab_feature_parser.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace toriyomi {
+namespace tokenizer {
+
+struct Token;
+
+/**
+ * @brief 한 문장의 형태소 분석 결과 (문자열은 문장 단위 아레나에 오프셋으로 보관)
+ *
+ * 아레나는 입력 문장 사본으로 시작하므로 표면형은 추가 복사 없이 원문을 가리킵니다.
+ * 읽기/기본형은 표면형과 같으면 같은 구간을 재사용하고, 다를 때만 아레나 뒤에 덧붙입니다.
+ * 토큰별 std::string은 Materialize()를 호출할 때만 생성됩니다.
+ *
+ * 반환되는 string_view는 다음 AddToken() 호출 전까지만 유효합니다.
+ */
+class TokenizedSentence {
+public:
+    TokenizedSentence() = default;
+
+    /**
+     * @brief 원문으로 아레나 초기화
+     */
+    explicit TokenizedSentence(std::string_view text);
+
+    /**
+     * @brief 토큰 추가
+     *
+     * @param surfaceOffset 원문 기준 표면형 바이트 오프셋
+     * @param surfaceLength 표면형 바이트 길이
+     * @param fields feature 파싱 결과 (빈 읽기/기본형은 표면형으로 대체)
+     * @return 범위를 벗어나면 false
+     */
+    bool AddToken(std::size_t surfaceOffset, std::size_t surfaceLength, const MecabFeatureFields& fields);
+
+    std::size_t Size() const { return records_.size(); }
+    bool Empty() const { return records_.empty(); }
+
+    /**
+     * @brief 원문 텍스트
+     */
+    std::string_view Text() const;
+
+    std::string_view Surface(std::size_t index) const;
+    std::string_view Reading(std::size_t index) const;
+    std::string_view BaseForm(std::size_t index) const;
+
+    /**
+     * @brief 품사 원문 (표에 없는 품사도 그대로 반환)
+     */
+    std::string_view PartOfSpeechText(std::size_t index) const;
+
+    PartOfSpeech PartOfSpeechAt(std::size_t index) const;
+
+    /**
+     * @brief 원문 기준 표면형 바이트 오프셋
+     */
+    std::size_t SurfaceOffset(std::size_t index) const;
+
+    /**
+     * @brief 토큰 하나를 소유 문자열 Token으로 변환
+     */
+    Token Materialize(std::size_t index) const;
+
+    /**
+     * @brief 전체 토큰을 Token 목록으로 변환
+     */
+    std::vector<Token> MaterializeAll() const;
+
+private:
+    struct Span {
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+    };
+
+    struct Record {
+        Span surface;
+        Span reading;
+        Span baseForm;
+        Span partOfSpeechText;  // 대표 표기와 다를 때만 사용 (length 0이면 대표 표기)
+        PartOfSpeech partOfSpeech = PartOfSpeech::Unknown;
+    };
+
+    Span Intern(std::string_view value, const Span& surface);
+    std::string_view View(const Span& span) const;
+
+    std::string arena_;
+    std::uint32_t textLength_ = 0;
+    std::vector<Record> records_;
+};
+
+}  // namespace tokenizer
+}  // namespace toriyomi
@@ -0,0 +1,398 @@
+// ToriYomi - 게임별 사용자 사전 구현
+
+#include "user_dictionary.h"
+#include "common/text/unicode_utils.h"
+#include <mecab.h>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <system_error>
+#include <unordered_set>
+
+namespace toriyomi {
+namespace tokenizer {
+
+namespace {
+
+// 후보로 셀 최대 길이 (이보다 길면 문장 조각일 가능성이 큼)
+constexpr std::size_t kMaxCandidateChars = 16;
+
+// 사전 비용은 16비트(short)로 저장되므로 하한을 그 안으로 제한
+constexpr int kMinWordCost = -32767;
+
+void SetError(std::string* errorMessage, std::string message) {
+    if (errorMessage) {
+        *errorMessage = std::move(message);
+    }
+}
+
+std::size_t CountChars(std::string_view text) {
+    std::size_t count = 0;
+    for (std::size_t pos = 0; pos < text.size(); ++count) {
+        text::DecodeUtf8(text, pos);
+    }
+    return count;
+}
+
+std::string_view TrimLine(std::string_view line) {
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) {
+        line.remove_suffix(1);
+    }
+    while (!line.empty() && line.front() == ' ') {
+        line.remove_prefix(1);
+    }
+    return line;
+}
+
+/**
+ * @brief CSV 필드로 넣을 수 없는 문자 (mecab-dict-index는 형식 오류에서 프로세스를 종료함)
+ */
+bool IsSafeField(std::string_view field) {
+    const bool hasSeparator = std::any_of(field.begin(), field.end(), [](char ch) {
+        return ch == ',' || ch == '"' || static_cast<unsigned char>(ch) < 0x20;
+    });
+    if (hasSeparator) {
+        return false;
+    }
+    for (std::size_t pos = 0; pos < field.size();) {
+        if (text::DecodeUtf8(field, pos) == text::kReplacementCharacter) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ParseCost(std::string_view field, int& cost) {
+    const auto [end, ec] = std::from_chars(field.data(), field.data() + field.size(), cost);
+    return ec == std::errc() && end == field.data() + field.size();
+}
+
+std::string_view CategoryFields(std::string_view category) {
+    if (category == "人名") {
+        return "人名,一般";
+    }
+    if (category == "地域") {
+        return "地域,一般";
+    }
+    if (category == "組織") {
+        return "組織,*";
+    }
+    return "一般,*";
+}
+
+std::uint64_t Fnv1a(std::string_view data, std::uint64_t hash = 14695981039346656037ull) {
+    for (const char ch : data) {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool IsPieceCandidate(const Token& token) {
+    if (token.posTag != PartOfSpeech::Noun) {
+        return false;
+    }
+    if (token.reading.empty()) {
+        return true;
+    }
+    return CountChars(token.surface) == 1 &&
+           (text::ContainsKanji(token.surface) || text::ContainsScript(token.surface, text::Script::Katakana));
+}
+
+}  // namespace
+
+std::optional<std::vector<UserWord>> LoadUserWordList(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+
+    std::vector<UserWord> words;
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string_view view = TrimLine(line);
+        if (view.empty() || view.front() == '#') {
+            continue;
+        }
+        UserWord word;
+        std::string* fields[] = {&word.surface, &word.reading, &word.category};
+        for (std::string* field : fields) {
+            const std::size_t tab = view.find('\t');
+            *field = std::string(TrimLine(view.substr(0, tab)));
+            if (tab == std::string_view::npos) {
+                view = {};
+                break;
+            }
+            view.remove_prefix(tab + 1);
+        }
+        if (!word.surface.empty()) {
+            words.push_back(std::move(word));
+        }
+    }
+    return words;
+}
+
+bool SaveUserWordList(const std::filesystem::path& path, const std::vector<UserWord>& words) {
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out << "# 표기\t읽기\t분류(人名/地域/組織/一般)\n";
+        for (const auto& word : words) {
+            out << word.surface << '\t' << word.reading;
+            if (!word.category.empty()) {
+                out << '\t' << word.category;
+            }
+            out << '\n';
+        }
+        if (!out) {
+            return false;
+        }
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+std::string FormatUserDictionaryCsv(const std::vector<UserWord>& words) {
+    std::string csv;
+    std::unordered_set<std::string> seen;
+    for (const auto& word : words) {
+        if (word.surface.empty() || !IsSafeField(word.surface) || !IsSafeField(word.reading) ||
+            !seen.insert(word.surface).second) {
+            continue;
+        }
+        const std::size_t length = CountChars(word.surface);
+        // 긴 이름일수록 한 단어로 묶이도록 비용을 낮춤 (한 글자 명사 연쇄보다 항상 유리하게)
+        const int cost = std::max(kMinWordCost, static_cast<int>(-400.0 * std::pow(static_cast<double>(length), 1.5)));
+        const std::string reading = text::HiraganaToKatakana(word.reading.empty() ? word.surface : word.reading);
+
+        // 표층형,좌문맥ID,우문맥ID,비용,품사,세분류1,세분류2,세분류3,활용형,활용형,원형,읽기,발음
+        csv += word.surface;
+        csv += ",,,";
+        csv += std::to_string(cost);
+        csv += ",名詞,固有名詞,";
+        csv += CategoryFields(word.category);
+        csv += ",*,*,";
+        csv += word.surface;
+        csv += ',';
+        csv += reading;
+        csv += ',';
+        csv += reading;
+        csv += '\n';
+    }
+    return csv;
+}
+
+bool ValidateUserDictionaryCsv(std::string_view csv, std::string* errorMessage) {
+    constexpr std::size_t kFieldCount = 13;
+    std::size_t lineNumber = 0;
+    while (!csv.empty()) {
+        ++lineNumber;
+        const std::size_t newline = csv.find('\n');
+        std::string_view line = csv.substr(0, newline);
+        csv.remove_prefix(newline == std::string_view::npos ? csv.size() : newline + 1);
+
+        std::string_view fields[kFieldCount];
+        std::size_t count = 0;
+        for (;;) {
+            const std::size_t comma = line.find(',');
+            if (count < kFieldCount) {
+                fields[count] = line.substr(0, comma);
+            }
+            ++count;
+            if (comma == std::string_view::npos) {
+                break;
+            }
+            line.remove_prefix(comma + 1);
+        }
+
+        int cost = 0;
+        const bool valid = count == kFieldCount && !fields[0].empty() &&
+            fields[1].empty() && fields[2].empty() &&
+            ParseCost(fields[3], cost) && cost >= kMinWordCost && cost <= 32767 &&
+            std::all_of(std::begin(fields), std::end(fields), IsSafeField) &&
+            std::none_of(std::begin(fields) + 4, std::end(fields),
+                         [](std::string_view field) { return field.empty(); });
+        if (!valid) {
+            SetError(errorMessage, "사용자 사전 CSV " + std::to_string(lineNumber) + "번째 줄 형식 오류");
+            return false;
+        }
+    }
+    if (lineNumber == 0) {
+        SetError(errorMessage, "등록할 단어가 없습니다");
+        return false;
+    }
+    return true;
+}
+
+std::optional<std::filesystem::path> BuildUserDictionary(const std::vector<UserWord>& words,
+                                                         const std::filesystem::path& systemDicDir,
+                                                         const std::filesystem::path& outputDir,
+                                                         std::string_view baseName,
+                                                         std::string* errorMessage) {
+    // mecab-dict-index는 형식 오류를 만나면 프로세스를 종료하므로 넘기기 전에 직접 검사
+    const std::string csv = FormatUserDictionaryCsv(words);
+    if (!ValidateUserDictionaryCsv(csv, errorMessage)) {
+        return std::nullopt;
+    }
+
+    // 문맥 ID 자동 지정에 필요한 정의 파일 (없으면 mecab-dict-index가 프로세스를 종료함)
+    std::error_code ec;
+    for (const char* required : {"dicrc", "left-id.def", "right-id.def", "rewrite.def"}) {
+        if (!std::filesystem::exists(systemDicDir / required, ec)) {
+            SetError(errorMessage, std::string("시스템 사전에 ") + required + " 파일이 없습니다");
+            return std::nullopt;
+        }
+    }
+
+    char hashText[17];
+    std::snprintf(hashText, sizeof(hashText), "%016llx",
+                  static_cast<unsigned long long>(Fnv1a(csv, Fnv1a(systemDicDir.generic_string()))));
+    const std::string prefix = std::string(baseName) + "_";
+    const std::filesystem::path output = outputDir / (prefix + hashText + ".dic");
+    if (std::filesystem::exists(output, ec)) {
+        return output;
+    }
+
+    std::filesystem::create_directories(outputDir, ec);
+    std::filesystem::path csvPath = output;
+    csvPath.replace_extension(".csv");
+    std::filesystem::path temp = output;
+    temp += ".tmp";
+    {
+        std::ofstream out(csvPath, std::ios::binary | std::ios::trunc);
+        out << csv;
+        if (!out) {
+            SetError(errorMessage, "CSV 파일을 쓸 수 없습니다");
+            return std::nullopt;
+        }
+    }
+
+    const std::string dicArg = systemDicDir.string();
+    const std::string tempArg = temp.string();
+    const std::string csvArg = csvPath.string();
+    const char* argv[] = {"mecab-dict-index", "-d", dicArg.c_str(), "-u", tempArg.c_str(),
+                          "-f", "utf-8", "-t", "utf-8", csvArg.c_str()};
+    int result = 0;
+    {
+        // mecab-dict-index는 재진입을 보장하지 않으므로 여러 프로필을 동시에 컴파일하지 않음
+        static std::mutex indexMutex;
+        std::lock_guard<std::mutex> lock(indexMutex);
+        result = mecab_dict_index(static_cast<int>(std::size(argv)), const_cast<char**>(argv));
+    }
+    std::filesystem::remove(csvPath, ec);
+    if (result != 0 || !std::filesystem::exists(temp, ec)) {
+        std::filesystem::remove(temp, ec);
+        SetError(errorMessage, "mecab-dict-index 실패 (" + std::to_string(result) + ")");
+        return std::nullopt;
+    }
+    std::filesystem::rename(temp, output, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        SetError(errorMessage, "사용자 사전 파일 교체 실패");
+        return std::nullopt;
+    }
+
+    // 같은 프로필의 이전 버전 정리 (사용 중인 Model이 열고 있으면 지우지 못해도 무방)
+    for (const auto& entry : std::filesystem::directory_iterator(outputDir, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (entry.path() != output && name.size() == prefix.size() + 16 + 4 &&
+            name.compare(0, prefix.size(), prefix) == 0 && entry.path().extension() == ".dic") {
+            std::error_code removeError;
+            std::filesystem::remove(entry.path(), removeError);
+        }
+    }
+    return output;
+}
+
+UnknownWordTracker::UnknownWordTracker(std::size_t maxCandidates)
+    : maxCandidates_(std::max<std::size_t>(1, maxCandidates)) {
+}
+
+void UnknownWordTracker::Observe(const std::vector<Token>& tokens) {
+    std::size_t runBegin = 0;
+    for (std::size_t i = 0; i <= tokens.size(); ++i) {
+        if (i < tokens.size() && IsPieceCandidate(tokens[i])) {
+            continue;
+        }
+        const std::size_t runLength = i - runBegin;
+        // 한 글자 명사 하나는 정상 단어일 가능성이 커서 제외
+        if (runLength >= 2 || (runLength == 1 && tokens[runBegin].reading.empty() &&
+                               CountChars(tokens[runBegin].surface) >= 2)) {
+            std::string surface;
+            std::string reading;
+            bool readingKnown = true;
+            for (std::size_t k = runBegin; k < i; ++k) {
+                surface += tokens[k].surface;
+                reading += tokens[k].reading;
+                readingKnown = readingKnown && !tokens[k].reading.empty();
+            }
+            if (CountChars(surface) <= kMaxCandidateChars) {
+                Count(std::move(surface), readingKnown ? std::move(reading) : std::string());
+            }
+        }
+        runBegin = i + 1;
+    }
+}
+
+void UnknownWordTracker::Count(std::string surface, std::string reading) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = candidates_.find(surface);
+    if (it == candidates_.end()) {
+        if (candidates_.size() >= maxCandidates_) {
+            // 한 번만 나온 후보부터 버림
+            std::erase_if(candidates_, [](const auto& item) { return item.second.occurrences <= 1; });
+            if (candidates_.size() >= maxCandidates_) {
+                return;
+            }
+        }
+        it = candidates_.emplace(std::move(surface), Candidate{std::move(reading), 0}).first;
+    }
+    ++it->second.occurrences;
+}
+
+std::vector<UserWordSuggestion> UnknownWordTracker::Suggestions(std::uint32_t minOccurrences,
+                                                                std::size_t maxCount) const {
+    std::vector<UserWordSuggestion> suggestions;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [surface, candidate] : candidates_) {
+            if (candidate.occurrences >= minOccurrences) {
+                suggestions.push_back({surface, candidate.reading, candidate.occurrences});
+            }
+        }
+    }
+    std::sort(suggestions.begin(), suggestions.end(), [](const auto& a, const auto& b) {
+        return a.occurrences != b.occurrences ? a.occurrences > b.occurrences : a.surface < b.surface;
+    });
+    if (suggestions.size() > maxCount) {
+        suggestions.resize(maxCount);
+    }
+    return suggestions;
+}
+
+void UnknownWordTracker::Forget(std::string_view surface) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    candidates_.erase(std::string(surface));
+}
+
+void UnknownWordTracker::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    candidates_.clear();
+}
+
+}  // namespace tokenizer
+}  // namespace toriyomi
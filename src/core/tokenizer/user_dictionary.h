@@ -0,0 +1,134 @@
+// ToriYomi - 게임별 사용자 사전
+// 등장인물 이름/고유 용어를 MeCab 사용자 사전으로 컴파일하고, 후보 단어를 수집
+
+#pragma once
+
+#include "japanese_tokenizer.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace toriyomi {
+namespace tokenizer {
+
+/**
+ * @brief 사용자 단어 하나
+ */
+struct UserWord {
+    std::string surface;    // 표기 (예: 翠星)
+    std::string reading;    // 읽기 (히라가나/가타카나, 비어 있으면 표기 그대로)
+    std::string category;   // IPADIC 품사 세분류 2 (人名, 地域, 組織, 一般). 비어 있으면 一般
+};
+
+/**
+ * @brief 단어 목록 파일 읽기
+ *
+ * 한 줄에 "표기<TAB>읽기[<TAB>분류]" 형식이며 빈 줄과 #으로 시작하는 줄은 무시합니다.
+ *
+ * @return 단어 목록 (파일을 열 수 없으면 std::nullopt)
+ */
+std::optional<std::vector<UserWord>> LoadUserWordList(const std::filesystem::path& path);
+
+/**
+ * @brief 단어 목록 파일 저장 (임시 파일에 쓴 뒤 교체)
+ */
+bool SaveUserWordList(const std::filesystem::path& path, const std::vector<UserWord>& words);
+
+/**
+ * @brief mecab-dict-index 입력 CSV 생성 (IPADIC 고유명사 형식)
+ *
+ * 문맥 ID는 비워서 사전의 rewrite.def로 자동 지정되게 하고, 비용은 길이가 길수록 낮게 줘서
+ * 기존 단어 조각보다 우선되게 합니다. CSV를 깨뜨리는 문자가 든 단어와 중복 표기는 건너뜁니다.
+ */
+std::string FormatUserDictionaryCsv(const std::vector<UserWord>& words);
+
+/**
+ * @brief mecab-dict-index에 넘길 CSV 검사
+ *
+ * 줄마다 필드 13개, 빈 문맥 ID, 16비트 범위 비용, 올바른 UTF-8인지 확인합니다.
+ * mecab-dict-index는 형식 오류에서 예외 대신 프로세스를 종료하므로 반드시 먼저 검사합니다.
+ *
+ * @param errorMessage 실패 사유 (nullptr 허용)
+ * @return 한 줄 이상이고 모든 줄이 올바르면 true
+ */
+bool ValidateUserDictionaryCsv(std::string_view csv, std::string* errorMessage = nullptr);
+
+/**
+ * @brief 사용자 사전 컴파일 (단어 목록이 같으면 디스크 캐시 재사용)
+ *
+ * 출력 파일 이름에 CSV 해시가 들어가므로 목록이 바뀔 때만 다시 컴파일하며,
+ * 같은 baseName의 이전 사전 파일은 새 파일을 만든 뒤 지웁니다.
+ * 사전 크기에 따라 오래 걸릴 수 있으므로 UI 스레드가 아닌 작업 스레드에서 호출합니다.
+ *
+ * @param words 단어 목록 (비어 있으면 실패)
+ * @param systemDicDir 시스템 사전 디렉터리 (dicrc, *.def가 있는 곳)
+ * @param outputDir 컴파일 결과 디렉터리
+ * @param baseName 파일 이름 접두사 (게임 프로필 이름)
+ * @param errorMessage 실패 사유 (nullptr 허용)
+ * @return 사용자 사전(.dic) 경로
+ */
+std::optional<std::filesystem::path> BuildUserDictionary(const std::vector<UserWord>& words,
+                                                         const std::filesystem::path& systemDicDir,
+                                                         const std::filesystem::path& outputDir,
+                                                         std::string_view baseName,
+                                                         std::string* errorMessage = nullptr);
+
+/**
+ * @brief 사용자 사전 후보 (자주 나오는 미등록어/잘게 쪼개진 명사열)
+ */
+struct UserWordSuggestion {
+    std::string surface;
+    std::string reading;    // 알 수 없으면 빈 문자열
+    std::uint32_t occurrences = 0;
+};
+
+/**
+ * @brief 분석 결과에서 사용자 사전 후보를 모음
+ *
+ * 읽기가 없는 명사(MeCab 미등록어)와, 한 글자 명사가 두 개 이상 이어진 구간
+ * (예: 翠|星)을 하나의 후보로 셉니다. 스레드 안전합니다.
+ */
+class UnknownWordTracker {
+public:
+    static constexpr std::size_t kDefaultMaxCandidates = 4096;
+
+    explicit UnknownWordTracker(std::size_t maxCandidates = kDefaultMaxCandidates);
+
+    /**
+     * @brief 한 문장의 토큰 반영
+     */
+    void Observe(const std::vector<Token>& tokens);
+
+    /**
+     * @brief minOccurrences번 이상 나온 후보 (많이 나온 순, 최대 maxCount개)
+     */
+    std::vector<UserWordSuggestion> Suggestions(std::uint32_t minOccurrences, std::size_t maxCount) const;
+
+    /**
+     * @brief 후보 제거 (사전에 등록했거나 거절한 단어)
+     */
+    void Forget(std::string_view surface);
+
+    void Clear();
+
+private:
+    void Count(std::string surface, std::string reading);
+
+    struct Candidate {
+        std::string reading;
+        std::uint32_t occurrences = 0;
+    };
+
+    std::size_t maxCandidates_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Candidate> candidates_;
+};
+
+}  // namespace tokenizer
+}  // namespace toriyomi
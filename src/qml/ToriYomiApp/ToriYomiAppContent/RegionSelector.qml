@@ -59,7 +59,7 @@ Window {
             selectedRegion = Qt.rect(0, 0, 0, 0)
             dragStart = Qt.point(0, 0)
             console.log("RegionSelector: Reset state")
-            if (!appBackend.previewImageData || appBackend.previewImageData.length === 0) {
+            if (!appBackend.previewImageSource || appBackend.previewImageSource.length === 0) {
                 appBackend.refreshPreviewImage()
             }
             previewRetryTimer.running = true
@@ -229,14 +229,14 @@ Window {
                 verticalAlignment: Image.AlignVCenter
                 asynchronous: true
                 cache: false
-                source: appBackend.previewImageData
+                source: appBackend.previewImageSource
                 opacity: 1.0
             }
 
             Rectangle {
                 anchors.fill: parent
                 color: Qt.rgba(0.05, 0.05, 0.07, 0.95)
-                visible: !appBackend.previewImageData || appBackend.previewImageData.length === 0
+                visible: !appBackend.previewImageSource || appBackend.previewImageSource.length === 0
                 z: 2
 
                 Column {
@@ -373,7 +373,8 @@ Window {
                 previewRetryTimer.running = false
                 return
             }
-            if (appBackend.previewImageData && appBackend.previewImageData.length > 0) {
+            // 캡처 중에는 파이프라인 프레임이 바뀔 때만 새 미리보기가 올라오므로 계속 갱신
+            if (!appBackend.isCapturing && appBackend.previewImageSource && appBackend.previewImageSource.length > 0) {
                 previewRetryTimer.running = false
                 return
             }
@@ -7,10 +7,13 @@ import ToriYomiApp
 Screen01Form {
     id: root
     property int maxSentenceEntries: 200
+    // 맨 위 항목이 아직 나타나는 중인 부분 문장인지 (다음 부분/확정 문장이 교체)
+    property bool topEntryProvisional: false
     
     Component.onCompleted: {
         appBackend.logMessage.connect(onLogMessage)
         appBackend.sentenceDetected.connect(onSentenceDetected)
+        appBackend.provisionalSentenceDetected.connect(onProvisionalSentenceDetected)
         appBackend.processListChanged.connect(onProcessListChanged)
         appBackend.refreshProcessList()
         sentenceListModel.clear()
@@ -37,20 +40,31 @@ Screen01Form {
         }
     }
     
-    function onSentenceDetected(originalText, tokens) {
-        appendSentence(originalText, tokens)
+    function onSentenceDetected(originalText, tokens, replacesPrevious) {
+        appendSentence(originalText, tokens, replacesPrevious === true, false)
     }
 
-    function appendSentence(originalText, tokens) {
+    function onProvisionalSentenceDetected(originalText, tokens) {
+        appendSentence(originalText, tokens, false, true)
+    }
+
+    function appendSentence(originalText, tokens, replacesPrevious, provisional) {
         if (!sentenceListModel) {
             return
         }
 
-        sentenceListModel.insert(0, {
+        var entry = {
             "text": originalText,
-            "colorCode": "#fa9393",
+            "colorCode": provisional ? "#c8c8c8" : "#fa9393",
             "tokens": tokens
-        })
+        }
+        var replaceTop = sentenceListModel.count > 0 && (topEntryProvisional || replacesPrevious)
+        if (replaceTop) {
+            sentenceListModel.set(0, entry)
+        } else {
+            sentenceListModel.insert(0, entry)
+        }
+        topEntryProvisional = provisional
 
         if (sentenceListModel.count > maxSentenceEntries) {
             sentenceListModel.remove(maxSentenceEntries, sentenceListModel.count - maxSentenceEntries)
@@ -150,4 +164,10 @@ Screen01Form {
             debugLogWindow.visible = true
         }
     }
+
+    onShowUserWordsChanged: {
+        if (showUserWords) {
+            userWordWindow.visible = true
+        }
+    }
 }
@@ -55,9 +55,43 @@ Rectangle {
         }
     }
     
+    // 디버그 버튼 왼쪽 사용자 사전 버튼
+    Button {
+        id: userWordButton
+        anchors.top: parent.top
+        anchors.right: debugButton.left
+        anchors.topMargin: 10
+        anchors.rightMargin: 10
+        width: 50
+        height: 50
+        text: "📖"
+        z: 1000
+
+        onClicked: screen01Form.showUserWords = true
+
+        background: Rectangle {
+            color: userWordButton.pressed ? Qt.rgba(0.25, 0.24, 0.28, 0.9) : (userWordButton.hovered ? Qt.rgba(0.32, 0.31, 0.35, 0.85) : Qt.rgba(0.28, 0.27, 0.31, 0.75))
+            radius: 25
+            border.color: Qt.rgba(1, 1, 1, 0.2)
+            border.width: 1
+
+            Behavior on color {
+                ColorAnimation { duration: 200 }
+            }
+        }
+
+        contentItem: Text {
+            text: userWordButton.text
+            font.pixelSize: 20
+            horizontalAlignment: Text.AlignHCenter
+            verticalAlignment: Text.AlignVCenter
+        }
+    }
+
     // 영역 선택 창 표시 여부
     property bool showRegionSelector: false
     property bool showDebugLog: false
+    property bool showUserWords: false
 
     // 일본어 텍스트 크기 조절
     property real japaneseFontSize: 24
@@ -66,6 +100,7 @@ Rectangle {
     // RegionSelector alias
     property alias regionSelector: regionSelector
     property alias debugLogWindow: debugLogWindow
+    property alias userWordWindow: userWordWindow
 
     // 컨트롤 alias (Screen01.qml에서 접근)
     property alias comboBox: comboBox
@@ -489,6 +524,24 @@ Rectangle {
                                 value: 1.0
                                 stepSize: 0.1
                             }
+
+                            // 화면이 멈춘 뒤 한 번만 OCR (끄면 글자가 나타나는 중에도 부분 문장 표시)
+                            CheckBox {
+                                id: changeDetectionCheckBox
+                                width: parent.width
+                                height: 30
+                                checked: appBackend.changeDetectionEnabled
+                                onToggled: appBackend.setChangeDetectionEnabled(checked)
+
+                                contentItem: Text {
+                                    leftPadding: changeDetectionCheckBox.indicator.width + changeDetectionCheckBox.spacing
+                                    text: qsTr("화면이 멈추면 한 번만 OCR")
+                                    font.pixelSize: 14
+                                    font.family: "Maplestory OTF"
+                                    color: "#ffffff"
+                                    verticalAlignment: Text.AlignVCenter
+                                }
+                            }
                         }
 
                         Column {
@@ -579,6 +632,12 @@ Rectangle {
         parentController: screen01Form
     }
 
+    // 사용자 사전 창
+    UserWordWindow {
+        id: userWordWindow
+        parentController: screen01Form
+    }
+
     ListModel {
         id: sentenceListModel
     }
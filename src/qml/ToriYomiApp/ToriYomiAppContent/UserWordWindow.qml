@@ -0,0 +1,324 @@
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Window
+
+// 사용자 사전 창 (자주 쪼개지는 이름 후보를 현재 게임 사전에 등록)
+Window {
+    id: userWordWindow
+
+    width: 460
+    height: 520
+    title: qsTr("사용자 사전")
+    flags: Qt.Window | Qt.WindowStaysOnTopHint | Qt.FramelessWindowHint
+    color: "transparent"
+
+    // 외부에서 컨트롤할 property
+    property var parentController: null
+
+    // 후보 목록 갱신
+    function refreshSuggestions() {
+        suggestionListModel.clear()
+        var suggestions = appBackend.userWordSuggestions()
+        for (var i = 0; i < suggestions.length; ++i) {
+            suggestionListModel.append(suggestions[i])
+        }
+    }
+
+    function addWord(surface, reading) {
+        if (!appBackend.addUserWord(surface, reading)) {
+            statusText.text = qsTr("등록 실패: 게임을 먼저 선택하세요")
+            return false
+        }
+        statusText.text = qsTr("등록 중: %1").arg(surface)
+        return true
+    }
+
+    onVisibleChanged: {
+        if (visible) {
+            refreshSuggestions()
+        }
+    }
+
+    onClosing: (close) => {
+        visible = false
+    }
+
+    Connections {
+        target: appBackend
+        function onUserDictionaryChanged() {
+            statusText.text = qsTr("사전 적용 완료")
+            if (userWordWindow.visible) {
+                userWordWindow.refreshSuggestions()
+            }
+        }
+    }
+
+    Rectangle {
+        anchors.fill: parent
+        color: "#1e1e1e"
+        radius: 10
+
+        // 커스텀 타이틀바
+        Rectangle {
+            id: titleBar
+            anchors.top: parent.top
+            anchors.left: parent.left
+            anchors.right: parent.right
+            height: 40
+            color: "#181818"
+            radius: 10
+
+            // 하단 모서리만 직각으로
+            Rectangle {
+                anchors.bottom: parent.bottom
+                anchors.left: parent.left
+                anchors.right: parent.right
+                height: 10
+                color: parent.color
+            }
+
+            Text {
+                anchors.left: parent.left
+                anchors.verticalCenter: parent.verticalCenter
+                anchors.leftMargin: 15
+                text: qsTr("📖 사용자 사전")
+                color: "#fa9393"
+                font.pixelSize: 16
+                font.family: "Maplestory OTF"
+                font.bold: true
+            }
+
+            // 닫기 버튼
+            Rectangle {
+                anchors.right: parent.right
+                anchors.verticalCenter: parent.verticalCenter
+                anchors.rightMargin: 5
+                width: 30
+                height: 30
+                color: closeButtonArea.pressed ? "#c0392b" : (closeButtonArea.containsMouse ? "#e74c3c" : "#3d3d3d")
+                radius: 15
+                z: 10
+
+                Text {
+                    anchors.centerIn: parent
+                    text: "×"
+                    color: "#ffffff"
+                    font.pixelSize: 18
+                    font.family: "Maplestory OTF"
+                }
+
+                MouseArea {
+                    id: closeButtonArea
+                    anchors.fill: parent
+                    hoverEnabled: true
+                    onClicked: {
+                        userWordWindow.visible = false
+                        if (userWordWindow.parentController) {
+                            userWordWindow.parentController.showUserWords = false
+                        }
+                    }
+                }
+            }
+
+            // 드래그 영역
+            MouseArea {
+                anchors.fill: parent
+                property point clickPos: Qt.point(0, 0)
+                z: -1
+
+                onPressed: (mouse) => {
+                    clickPos = Qt.point(mouse.x, mouse.y)
+                }
+
+                onPositionChanged: (mouse) => {
+                    if (pressed) {
+                        userWordWindow.x += mouse.x - clickPos.x
+                        userWordWindow.y += mouse.y - clickPos.y
+                    }
+                }
+            }
+        }
+
+        Column {
+            anchors.fill: parent
+            anchors.margins: 10
+            anchors.topMargin: 50
+            spacing: 10
+
+            // 직접 입력
+            Row {
+                width: parent.width
+                spacing: 8
+
+                TextField {
+                    id: surfaceField
+                    width: (parent.width - addButton.width - 16) / 2
+                    placeholderText: qsTr("표기 (例: 翠星)")
+                    font.family: "Maplestory OTF"
+                }
+
+                TextField {
+                    id: readingField
+                    width: surfaceField.width
+                    placeholderText: qsTr("읽기 (例: すいせい)")
+                    font.family: "Maplestory OTF"
+                }
+
+                Button {
+                    id: addButton
+                    text: qsTr("추가")
+                    enabled: surfaceField.text.trim().length > 0
+                    onClicked: {
+                        if (userWordWindow.addWord(surfaceField.text, readingField.text)) {
+                            surfaceField.text = ""
+                            readingField.text = ""
+                        }
+                    }
+
+                    background: Rectangle {
+                        color: parent.pressed ? "#c75a7a" : (parent.hovered ? "#e67799" : "#d66b88")
+                        opacity: parent.enabled ? 1.0 : 0.5
+                        radius: 5
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        color: "#ffffff"
+                        horizontalAlignment: Text.AlignHCenter
+                        verticalAlignment: Text.AlignVCenter
+                        font.family: "Maplestory OTF"
+                    }
+                }
+            }
+
+            Row {
+                width: parent.width
+                spacing: 10
+
+                Text {
+                    text: qsTr("자주 쪼개지는 단어 후보")
+                    color: "#ffffff"
+                    font.family: "Maplestory OTF"
+                    anchors.verticalCenter: parent.verticalCenter
+                }
+
+                Button {
+                    text: qsTr("새로고침")
+                    onClicked: userWordWindow.refreshSuggestions()
+
+                    background: Rectangle {
+                        color: parent.pressed ? "#5c50d6" : (parent.hovered ? "#7b6fff" : "#6a5def")
+                        radius: 5
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        color: "#ffffff"
+                        horizontalAlignment: Text.AlignHCenter
+                        verticalAlignment: Text.AlignVCenter
+                        font.family: "Maplestory OTF"
+                    }
+                }
+            }
+
+            // 후보 목록
+            Rectangle {
+                width: parent.width
+                height: parent.height - 130
+                color: "#2b2b2b"
+                border.color: "#fa9393"
+                border.width: 1
+                radius: 5
+
+                ListView {
+                    id: suggestionListView
+                    anchors.fill: parent
+                    anchors.margins: 5
+                    clip: true
+                    spacing: 2
+
+                    model: ListModel {
+                        id: suggestionListModel
+                    }
+
+                    delegate: Rectangle {
+                        width: suggestionListView.width
+                        height: 40
+                        color: index % 2 === 0 ? "#2b2b2b" : "#333333"
+
+                        Row {
+                            anchors.fill: parent
+                            anchors.leftMargin: 5
+                            anchors.rightMargin: 5
+                            spacing: 8
+
+                            Text {
+                                width: 130
+                                anchors.verticalCenter: parent.verticalCenter
+                                text: model.surface
+                                color: "#ffffff"
+                                font.family: "IPAexGothic"
+                                font.pixelSize: 16
+                                elide: Text.ElideRight
+                            }
+
+                            TextField {
+                                id: suggestionReading
+                                width: 150
+                                anchors.verticalCenter: parent.verticalCenter
+                                text: model.reading
+                                placeholderText: qsTr("읽기")
+                                font.family: "Maplestory OTF"
+                            }
+
+                            Text {
+                                width: 40
+                                anchors.verticalCenter: parent.verticalCenter
+                                text: qsTr("%1회").arg(model.occurrences)
+                                color: "#c8c8c8"
+                                font.family: "Maplestory OTF"
+                                font.pixelSize: 12
+                            }
+
+                            Button {
+                                anchors.verticalCenter: parent.verticalCenter
+                                text: qsTr("등록")
+                                onClicked: {
+                                    if (userWordWindow.addWord(model.surface, suggestionReading.text)) {
+                                        suggestionListModel.remove(index)
+                                    }
+                                }
+
+                                background: Rectangle {
+                                    color: parent.pressed ? "#c75a7a" : (parent.hovered ? "#e67799" : "#d66b88")
+                                    radius: 5
+                                }
+
+                                contentItem: Text {
+                                    text: parent.text
+                                    color: "#ffffff"
+                                    horizontalAlignment: Text.AlignHCenter
+                                    verticalAlignment: Text.AlignVCenter
+                                    font.family: "Maplestory OTF"
+                                }
+                            }
+                        }
+                    }
+
+                    ScrollBar.vertical: ScrollBar {
+                        policy: ScrollBar.AsNeeded
+                    }
+                }
+            }
+
+            Text {
+                id: statusText
+                width: parent.width
+                color: "#00ff00"
+                font.family: "Maplestory OTF"
+                font.pixelSize: 12
+                elide: Text.ElideRight
+            }
+        }
+    }
+}
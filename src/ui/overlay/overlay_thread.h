@@ -17,7 +17,7 @@ namespace ui {
  * @brief 후리가나 데이터를 스레드 안전하게 공유하는 더블 버퍼
  * 
  * Lock-free 읽기를 위해 std::atomic<int>로 버퍼 인덱스를 스왑합니다.
- * Writer(OcrThread)는 백 버퍼에 쓰고, Reader(OverlayThread)는 프론트 버퍼를 읽습니다.
+ * Writer(파이프라인 쪽)는 백 버퍼에 쓰고, Reader(OverlayThread)는 프론트 버퍼를 읽습니다.
  */
 class FuriganaBuffer {
 public:
@@ -51,7 +51,7 @@ private:
 /**
  * @brief 오버레이 윈도우를 60 FPS로 렌더링하는 스레드
  * 
- * OcrThread에서 생성된 후리가나 데이터를 받아서
+ * 파이프라인에서 생성된 후리가나 데이터를 받아서
  * 16ms 주기로 OverlayWindow에 렌더링합니다.
  */
 class OverlayThread {
@@ -84,7 +84,7 @@ public:
     bool IsRunning() const;
 
     /**
-     * @brief 후리가나 데이터 업데이트 (OcrThread에서 호출)
+     * @brief 후리가나 데이터 업데이트 (파이프라인 쪽에서 호출)
      * @param furiganaList 새 후리가나 목록
      */
     void UpdateFurigana(const std::vector<tokenizer::FuriganaInfo>& furiganaList);
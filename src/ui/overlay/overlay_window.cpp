@@ -218,25 +218,20 @@ void OverlayWindow::RenderFurigana(HDC hdc) {
     format.SetAlignment(StringAlignmentCenter);
     format.SetLineAlignment(StringAlignmentCenter);
 
-    // 각 후리가나 렌더링 (한자만)
-    for (const auto& info : furigana_) {
-        if (!info.needsRuby) {
-            continue;  // 한자 없으면 스킵
-        }
-
+    auto drawRuby = [&](const std::string& reading, const cv::Point& rubyPosition, const cv::Rect& base) {
         // UTF-8 → UTF-16 변환
-        int wideLen = MultiByteToWideChar(CP_UTF8, 0, info.reading.c_str(), -1, nullptr, 0);
-        if (wideLen <= 0) continue;
+        int wideLen = MultiByteToWideChar(CP_UTF8, 0, reading.c_str(), -1, nullptr, 0);
+        if (wideLen <= 0) return;
 
         std::wstring wideReading(wideLen, 0);
-        MultiByteToWideChar(CP_UTF8, 0, info.reading.c_str(), -1, &wideReading[0], wideLen);
+        MultiByteToWideChar(CP_UTF8, 0, reading.c_str(), -1, &wideReading[0], wideLen);
 
         // 렌더링 위치 (루비 위치)
         RectF textRect(
-            static_cast<REAL>(info.rubyPosition.x),
-            static_cast<REAL>(info.rubyPosition.y),
-            static_cast<REAL>(info.position.width),
-            static_cast<REAL>(info.position.height)
+            static_cast<REAL>(rubyPosition.x),
+            static_cast<REAL>(rubyPosition.y),
+            static_cast<REAL>(base.width),
+            static_cast<REAL>(base.height)
         );
 
         // 외곽선 렌더링 (Path 사용)
@@ -253,6 +248,22 @@ void OverlayWindow::RenderFurigana(HDC hdc) {
 
         graphics.DrawPath(&outlinePen, &path);   // 흰색 외곽선
         graphics.FillPath(&textBrush, &path);    // 검은색 채우기
+    };
+
+    // 각 후리가나 렌더링 (한자만)
+    for (const auto& info : furigana_) {
+        if (!info.needsRuby) {
+            continue;  // 한자 없으면 스킵
+        }
+
+        // 한자 구간별 루비가 있으면 오쿠리가나를 뺀 구간 위에만 표시
+        if (!info.rubySpans.empty()) {
+            for (const auto& span : info.rubySpans) {
+                drawRuby(span.reading, span.rubyPosition, span.position);
+            }
+            continue;
+        }
+        drawRuby(info.reading, info.rubyPosition, info.position);
     }
 }
 
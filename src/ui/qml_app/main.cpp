@@ -164,6 +164,9 @@ int main(int argc, char *argv[])
 
     // QML에 백엔드 노출
     engine.rootContext()->setContextProperty("appBackend", backend);
+    // ROI 선택 미리보기 (엔진이 제공자를 소유, 이미지는 백엔드와 공유하는 보관소에서 읽음)
+    engine.addImageProvider(QStringLiteral("preview"),
+                            new toriyomi::ui::PreviewImageProvider(backend->GetPreviewImageStore()));
     qDebug() << "QML 컨텍스트 설정 완료";
 
     // QML 로드
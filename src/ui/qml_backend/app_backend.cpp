@@ -1,10 +1,10 @@
 #include "ui/qml_backend/app_backend.h"
+#include "common/text/unicode_utils.h"
 #include <QCoreApplication>
 #include <QDateTime>
 #include <QDebug>
 #include <QGuiApplication>
 #include <QScreen>
-#include <QBuffer>
 #include <QDir>
 #include <QImage>
 #include <QPixmap>
@@ -102,6 +102,11 @@ toriyomi::ocr::OcrBootstrapConfig BuildDefaultOcrConfig() {
     const QString paddleModels = QDir::cleanPath(baseDir.filePath("models/paddleocr"));
     config.paddleModelDirectory = QDir::toNativeSeparators(paddleModels).toStdString();
     config.paddleLanguage = "jpn";
+    // 엔진 선택("engine")과 세부 옵션은 configs/paddle_ocr.json에서 읽음 (없으면 기본값)
+    const QString ocrConfig = QDir::cleanPath(baseDir.filePath("configs/paddle_ocr.json"));
+    if (QFileInfo::exists(ocrConfig)) {
+        config.paddleConfigPath = QDir::toNativeSeparators(ocrConfig).toStdString();
+    }
     return config;
 }
 
@@ -111,6 +116,8 @@ QString OcrEngineNameForDisplay(toriyomi::ocr::OcrEngineType type) {
             return QStringLiteral("PaddleOCR");
         case toriyomi::ocr::OcrEngineType::EasyOCR:
             return QStringLiteral("EasyOCR");
+        case toriyomi::ocr::OcrEngineType::OnnxRuntime:
+            return QStringLiteral("ONNX Runtime");
         default:
             return QStringLiteral("Unknown");
     }
@@ -205,19 +212,14 @@ namespace ui {
 
 AppBackend::AppBackend(QObject* parent)
     : QObject(parent),
-      ocrBootstrapper_(BuildDefaultOcrConfig())
+      ocrBootstrapper_(BuildDefaultOcrConfig()),
+      selectedEngineType_(ocrBootstrapper_.GetPreferredEngine())
 {
     fprintf(stderr, "[AppBackend] 생성자 시작\n");
     
     try {
-        pollTimer_ = new QTimer(this);
-        fprintf(stderr, "[AppBackend] QTimer 생성 완료\n");
-        
-        connect(pollTimer_, &QTimer::timeout, this, &AppBackend::OnPollOcrResults);
-        fprintf(stderr, "[AppBackend] QTimer 연결 완료\n");
-        
         SetStatusMessage("준비됨");
-    sentenceAssembler_.SetCaptureIntervalSeconds(captureIntervalSeconds_);
+        ApplyTypewriterSettleTime();
         fprintf(stderr, "[AppBackend] 상태 메시지 설정 완료\n");
         
         qDebug() << "[AppBackend] 초기화 완료";
@@ -233,26 +235,21 @@ AppBackend::AppBackend(QObject* parent)
 AppBackend::~AppBackend() {
     shutdownRequested_.store(true);
     stopCapture();
+    pipelineStopper_.WaitAll();
 
     {
-        std::lock_guard<std::mutex> lock(cleanupFuturesMutex_);
-        for (auto& futurePtr : cleanupFutures_) {
+        std::lock_guard<std::mutex> lock(userDictionaryBuildsMutex_);
+        for (auto& futurePtr : userDictionaryBuilds_) {
             if (futurePtr && futurePtr->valid()) {
                 futurePtr->wait();
             }
         }
-        cleanupFutures_.clear();
+        userDictionaryBuilds_.clear();
     }
 
-    {
-        std::lock_guard<std::mutex> lock(tokenizationFuturesMutex_);
-        for (auto& futurePtr : tokenizationFutures_) {
-            if (futurePtr && futurePtr->valid()) {
-                futurePtr->wait();
-            }
-        }
-        tokenizationFutures_.clear();
-    }
+    tokenizationPool_->Shutdown();
+
+    SaveSentenceCache();
 
     ocrEngine_.reset();
     tokenizer_.reset();
@@ -306,11 +303,7 @@ void AppBackend::selectProcess(int index) {
     selectedWindow_ = candidate;
     hasRoiSelection_ = false;
 
-    if (!previewImageData_.isEmpty() || previewImageSize_.isValid()) {
-        previewImageData_.clear();
-        previewImageSize_ = QSize();
-        emit previewImageDataChanged();
-    }
+    ClearPreviewImage();
     refreshPreviewImage();
     
     wchar_t title[256] = {0};
@@ -335,6 +328,9 @@ void AppBackend::selectProcess(int index) {
         .arg(hwndHex)
         .arg(windowWidth)
         .arg(windowHeight));
+
+    SwitchSentenceCache(!windowLabel.isEmpty() ? windowLabel : processList_[index]);
+    SwitchUserDictionary(!windowLabel.isEmpty() ? windowLabel : processList_[index]);
 }
 
 HWND AppBackend::ResolvePreferredWindow(HWND candidate) const {
@@ -438,7 +434,7 @@ void AppBackend::selectRoi(int x, int y, int width, int height) {
 
     selectedRoi_ = cv::Rect(clampedX, clampedY, clampedWidth, clampedHeight);
     hasRoiSelection_ = true;
-    ApplyRoiToOcrThread();
+    ApplyRoiToPipeline();
     
     qDebug() << "[AppBackend] ROI 선택:" << clampedX << clampedY << clampedWidth << clampedHeight;
     emit logMessage(QString("[%1] ROI 선택: (%2, %3, %4x%5)")
@@ -481,7 +477,7 @@ void AppBackend::startCapture() {
         }
 
         hasRoiSelection_ = true;
-        ApplyRoiToOcrThread();
+        ApplyRoiToPipeline();
         
         qDebug() << "[AppBackend] ROI 미선택 - 전체 윈도우 캡처:" 
                  << selectedRoi_.width << "x" << selectedRoi_.height;
@@ -496,17 +492,6 @@ void AppBackend::startCapture() {
         .arg(QDateTime::currentDateTime().toString("HH:mm:ss")));
 
     QTimer::singleShot(0, this, [this]() {
-        sentenceAssembler_.Reset();
-
-        auto cleanupNow = [this]() {
-            auto resources = std::make_shared<CleanupResources>();
-            resources->overlay = std::move(overlayThread_);
-            resources->ocr = std::move(ocrThread_);
-            resources->capture = std::move(captureThread_);
-            resources->frameQueue = std::move(frameQueue_);
-            CleanupThreads(resources);
-        };
-
         InitializeEngines();
         
         if (!ocrEngine_ || !tokenizer_) {
@@ -516,32 +501,25 @@ void AppBackend::startCapture() {
             return;
         }
 
-        frameQueue_ = std::make_shared<toriyomi::FrameQueue>(8);
-        captureThread_ = std::make_unique<capture::CaptureThread>(frameQueue_);
-        captureThread_->SetChangeDetection(false);
-    const int captureIntervalMs = std::max(10, static_cast<int>(std::round(captureIntervalSeconds_ * 1000.0)));
-    captureThread_->SetCaptureIntervalMilliseconds(captureIntervalMs);
-        
-        if (!captureThread_->Start(selectedWindow_)) {
-            SetStatusMessage("캡처 스레드 시작 실패");
-            emit logMessage(QString("[%1] 오류: 캡처 스레드 시작 실패")
+        pipeline::PipelineOptions options;
+        options.captureInterval = std::chrono::milliseconds(
+            std::max(10, static_cast<int>(std::round(captureIntervalSeconds_ * 1000.0))));
+        pipeline_ = std::make_unique<pipeline::Pipeline>(
+            std::make_shared<capture::WindowCapture>(selectedWindow_), ocrEngine_, options);
+        pipeline_->SetTypewriterOptions(typewriterOptions_);
+        pipeline_->SetChangeDetection(changeDetectionEnabled_);
+        SubscribeToPipeline();
+
+        // 공급원 준비 → 문장/OCR/캡처 스레드 순으로 시작 (ocrEngine_은 shared_ptr로 생명주기 공유)
+        if (!pipeline_->Start()) {
+            SetStatusMessage("캡처 파이프라인 시작 실패");
+            emit logMessage(QString("[%1] 오류: 캡처 파이프라인 시작 실패")
                 .arg(QDateTime::currentDateTime().toString("HH:mm:ss")));
-            cleanupNow();
+            pipeline::PipelineStopper::StopNow(std::move(pipeline_));
             return;
         }
 
-        // ocrEngine_을 shared_ptr로 OcrThread에 전달 (생명주기 공유)
-        ocrThread_ = std::make_unique<ocr::OcrThread>(frameQueue_, ocrEngine_);
-        
-        if (!ocrThread_->Start()) {
-            SetStatusMessage("OCR 스레드 시작 실패");
-            emit logMessage(QString("[%1] 오류: OCR 스레드 시작 실패")
-                .arg(QDateTime::currentDateTime().toString("HH:mm:ss")));
-            cleanupNow();
-            return;
-        }
-
-        ApplyRoiToOcrThread();
+        ApplyRoiToPipeline();
 
     overlayThread_ = std::make_unique<OverlayThread>();
 
@@ -557,8 +535,6 @@ void AppBackend::startCapture() {
                 .arg(QDateTime::currentDateTime().toString("HH:mm:ss")));
         }
 
-        pollTimer_->start(100);
-
         isCapturing_ = true;
         emit isCapturingChanged();
         SetStatusMessage("캡처 중...");
@@ -579,9 +555,8 @@ void AppBackend::stopCapture() {
         return;
     }
 
-    if (pollTimer_) {
-        pollTimer_->stop();
-    }
+    // 정리 중인 파이프라인이 마지막으로 보내는 알림은 무시
+    ++pipelineGeneration_;
 
     if (isCapturing_) {
         isCapturing_ = false;
@@ -591,27 +566,49 @@ void AppBackend::stopCapture() {
     emit logMessage(QString("[%1] 캡처 중지 중...").arg(CurrentTimestamp()));
     SetStatusMessage("Stopping...");
 
-    sentenceAssembler_.Reset();
-
-    auto resources = std::make_shared<CleanupResources>();
-    resources->overlay = std::move(overlayThread_);
-    resources->ocr = std::move(ocrThread_);
-    resources->capture = std::move(captureThread_);
-    resources->frameQueue = std::move(frameQueue_);
-
-    cleanupTasksInFlight_.fetch_add(1);
-    auto futurePtr = std::make_shared<std::future<void>>();
-    *futurePtr = std::async(std::launch::async, [this, resources, futurePtr]() {
-        const auto summary = CleanupThreads(resources);
-        QMetaObject::invokeMethod(this, [this, summary, futurePtr]() {
-            HandleCleanupFinished(summary, futurePtr);
-        }, Qt::QueuedConnection);
-    });
+    SaveSentenceCache();
 
-    {
-        std::lock_guard<std::mutex> lock(cleanupFuturesMutex_);
-        cleanupFutures_.push_back(futurePtr);
+    const auto tokenizationMetrics = tokenizationPool_->GetMetrics();
+    if (tokenizationMetrics.submitted > 0) {
+        emit logMessage(QString("[%1] 토큰화 작업: 완료 %2 / 취소 %3 (밀림 %4), 최대 대기 %5개, 평균 %6ms, 최대 %7ms")
+            .arg(CurrentTimestamp())
+            .arg(tokenizationMetrics.completed)
+            .arg(tokenizationMetrics.superseded + tokenizationMetrics.dropped)
+            .arg(tokenizationMetrics.superseded)
+            .arg(tokenizationMetrics.peakQueueDepth)
+            .arg(tokenizationMetrics.averageLatencyMs, 0, 'f', 1)
+            .arg(tokenizationMetrics.maxLatencyMs, 0, 'f', 1));
     }
+
+    if (pipeline_) {
+        const auto stats = pipeline_->GetStats();
+        emit logMessage(QString("[%1] 파이프라인: 캡처 %2 / 인식 %3 (평균 %4ms), OCR 대기로 캡처 보류 %5회 (%6ms)")
+            .arg(CurrentTimestamp())
+            .arg(stats.framesCaptured)
+            .arg(stats.framesRecognized)
+            .arg(stats.averageOcrMs, 0, 'f', 1)
+            .arg(stats.backpressureWaits)
+            .arg(stats.backpressureMs, 0, 'f', 0));
+        emit logMessage(QString("[%1] 캡처 간격: 변화 %2회 / 정지 %3회, OCR 속도 제한 %4회, 마지막 간격 %5ms")
+            .arg(CurrentTimestamp())
+            .arg(stats.pacing.activeFrames)
+            .arg(stats.pacing.staticFrames)
+            .arg(stats.pacing.ocrLimited)
+            .arg(stats.pacing.intervalMs, 0, 'f', 0));
+        emit logMessage(QString("[%1] OCR 트리거: 안정 %2회 / 주기 %3회, 건너뛴 프레임 %4개")
+            .arg(CurrentTimestamp())
+            .arg(stats.trigger.settledTriggers)
+            .arg(stats.trigger.fallbackTriggers)
+            .arg(stats.trigger.framesHeld));
+    }
+
+    // 오버레이 → 캡처 → OCR → 문장 순서와 대기는 PipelineStopper/Pipeline::Stop이 처리
+    pipelineStopper_.StopAsync(std::move(pipeline_), TakeOverlayStopSteps(),
+        [this](const pipeline::PipelineStopSummary& summary) {
+            QMetaObject::invokeMethod(this, [this, summary]() {
+                HandleCleanupFinished(summary);
+            }, Qt::QueuedConnection);
+        });
 }
 
 void AppBackend::requestShutdown() {
@@ -635,7 +632,9 @@ void AppBackend::requestShutdown() {
 void AppBackend::clearSentences() {
     std::lock_guard<std::mutex> lock(sentencesMutex_);
     sentences_.clear();
-    sentenceAssembler_.Reset();
+    if (pipeline_) {
+        pipeline_->ResetSentences();
+    }
     
     qDebug() << "[AppBackend] 문장 목록 초기화";
     emit logMessage(QString("[%1] 문장 목록 초기화")
@@ -646,18 +645,34 @@ void AppBackend::setCaptureIntervalSeconds(double seconds) {
     const double clamped = std::clamp(seconds, 0.1, 5.0);
     const bool changed = std::abs(captureIntervalSeconds_ - clamped) > 0.0001;
     captureIntervalSeconds_ = clamped;
-    sentenceAssembler_.SetCaptureIntervalSeconds(captureIntervalSeconds_);
+    ApplyTypewriterSettleTime();
 
     if (changed) {
         emit captureIntervalSecondsChanged();
     }
 
-    if (captureThread_) {
+    if (pipeline_) {
         const int intervalMs = std::max(10, static_cast<int>(std::round(captureIntervalSeconds_ * 1000.0)));
-        captureThread_->SetCaptureIntervalMilliseconds(intervalMs);
+        pipeline_->SetCaptureInterval(std::chrono::milliseconds(intervalMs));
     }
 }
 
+void AppBackend::setChangeDetectionEnabled(bool enabled) {
+    if (changeDetectionEnabled_ == enabled) {
+        return;
+    }
+    changeDetectionEnabled_ = enabled;
+    emit changeDetectionEnabledChanged();
+
+    // 켜면 텍스트 상자가 멈춘 뒤 한 번만 OCR (OCR 횟수는 줄지만 나타나는 중인 부분 문장은 보이지 않음)
+    if (pipeline_) {
+        pipeline_->SetChangeDetection(changeDetectionEnabled_);
+    }
+    emit logMessage(QString("[%1] 화면 안정 시 OCR: %2")
+        .arg(CurrentTimestamp())
+        .arg(changeDetectionEnabled_ ? "켜짐" : "꺼짐"));
+}
+
 void AppBackend::setOcrEngineType(int engineType) {
     ocr::OcrEngineType resolved = selectedEngineType_;
 
@@ -665,6 +680,9 @@ void AppBackend::setOcrEngineType(int engineType) {
         case static_cast<int>(ocr::OcrEngineType::PaddleOCR):
             resolved = ocr::OcrEngineType::PaddleOCR;
             break;
+        case static_cast<int>(ocr::OcrEngineType::OnnxRuntime):
+            resolved = ocr::OcrEngineType::OnnxRuntime;
+            break;
         default:
             emit logMessage(QString("[%1] 지원되지 않는 OCR 타입: %2")
                                 .arg(CurrentTimestamp())
@@ -691,36 +709,50 @@ void AppBackend::setOcrEngineType(int engineType) {
 }
 
 void AppBackend::refreshPreviewImage() {
-    auto pixmap = CaptureWindowPreview();
-
-    if (pixmap.isNull()) {
-        if (!previewImageData_.isEmpty() || previewImageSize_.isValid()) {
-            previewImageData_.clear();
-            previewImageSize_ = QSize();
-            emit previewImageDataChanged();
-        }
-        return;
+    // 캡처 중이면 파이프라인이 이미 가져온 최신 프레임을 재사용 (창을 다시 캡처하지 않음)
+    cv::Mat frame;
+    std::uint64_t sequence = 0;
+    if (pipeline_) {
+        frame = pipeline_->GetLatestFrame(&sequence);
     }
 
-    QImage image = pixmap.toImage();
-    previewImageSize_ = image.size();
-    const QSize maxPreviewSize(960, 540);
-    if (image.width() > maxPreviewSize.width() || image.height() > maxPreviewSize.height()) {
-        image = image.scaled(maxPreviewSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    if (frame.empty()) {
+        if (isCapturing_ && !previewImageSource_.isEmpty()) {
+            return;
+        }
+        auto pixmap = CaptureWindowPreview();
+        if (pixmap.isNull()) {
+            ClearPreviewImage();
+            return;
+        }
+        // QImage 버퍼를 감싼 뒤 복사 (축소가 필요 없으면 미리보기가 이 버퍼를 그대로 씀)
+        QImage image = pixmap.toImage().convertToFormat(QImage::Format_RGB32);
+        frame = cv::Mat(image.height(), image.width(), CV_8UC4,
+                        image.bits(), static_cast<size_t>(image.bytesPerLine())).clone();
+        sequence = 0;
     }
 
-    QBuffer buffer;
-    buffer.open(QIODevice::WriteOnly);
-    if (!image.save(&buffer, "PNG")) {
-        qWarning() << "[AppBackend] 미리보기 이미지 PNG 저장 실패";
+    auto preview = previewDownsampler_.Update(frame, sequence);
+    if (!preview) {
         return;
     }
 
-    const QString encoded = QString::fromLatin1(buffer.data().toBase64());
-    previewImageData_ = QStringLiteral("data:image/png;base64,%1").arg(encoded);
+    previewStore_->Publish(PreviewImageStore::WrapMat(preview->image));
+    previewImageSize_ = QSize(preview->sourceSize.width, preview->sourceSize.height);
+    previewImageSource_ = QStringLiteral("image://preview/%1").arg(preview->version);
     emit previewImageDataChanged();
 }
 
+void AppBackend::ClearPreviewImage() {
+    previewDownsampler_.Reset();
+    previewStore_->Clear();
+    if (!previewImageSource_.isEmpty() || previewImageSize_.isValid()) {
+        previewImageSource_.clear();
+        previewImageSize_ = QSize();
+        emit previewImageDataChanged();
+    }
+}
+
 QString AppBackend::saveCurrentRoiSnapshot() {
     auto pixmap = CaptureWindowPreview();
 
@@ -855,41 +887,70 @@ void AppBackend::runSampleOcr(const QString& imagePath) {
     }
 }
 
-void AppBackend::OnPollOcrResults() {
-    if (!ocrThread_) {
-        sentenceAssembler_.Reset();
-        return;
-    }
+void AppBackend::SubscribeToPipeline() {
+    const std::uint64_t generation = ++pipelineGeneration_;
+    lastCaptureOccluded_ = false;
+    // 새 파이프라인은 문장 ID를 1부터 다시 매기므로 마지막 확정 문장 기준도 새로 시작
+    finalSequencer_.BeginSession();
 
-    if (captureThread_) {
-        const auto stats = captureThread_->GetStatistics();
-        if (stats.windowOccluded != lastCaptureOccluded_) {
-            lastCaptureOccluded_ = stats.windowOccluded;
-            if (stats.windowOccluded) {
-                emit logMessage(QString("[%1] 경고: 선택한 창이 다른 창에 가려져 정확한 화면을 캡처할 수 없습니다. 창을 화면 맨 앞으로 이동하거나 오버레이를 최소화해주세요.")
-                                 .arg(CurrentTimestamp()));
-                SetStatusMessage("창이 가려져 있습니다");
-            } else {
-                emit logMessage(QString("[%1] 안내: 선택한 창이 다시 보이는 상태입니다.")
-                                 .arg(CurrentTimestamp()));
-                SetStatusMessage("캡처 중...");
+    // 파이프라인 스레드에서 호출되므로 UI 스레드로 넘겨 처리
+    QPointer<AppBackend> self(this);
+    pipeline_->SubscribeSentences([self, generation](const sentence::TypewriterEvent& event) {
+        QMetaObject::invokeMethod(self, [self, generation, event]() {
+            if (self && self->pipelineGeneration_ == generation) {
+                self->OnSentenceEvent(event);
             }
-        }
+        }, Qt::QueuedConnection);
+    });
+    pipeline_->SubscribeStats([self, generation](const pipeline::PipelineStats& stats) {
+        QMetaObject::invokeMethod(self, [self, generation, stats]() {
+            if (self && self->pipelineGeneration_ == generation) {
+                self->OnPipelineStats(stats);
+            }
+        }, Qt::QueuedConnection);
+    });
+    pipeline_->SetLogCallback([self](const std::string& message) {
+        const QString text = QString::fromStdString(message);
+        QMetaObject::invokeMethod(self, [self, text]() {
+            if (self) {
+                emit self->logMessage(QString("[%1] %2").arg(CurrentTimestamp(), text));
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+void AppBackend::OnPipelineStats(const pipeline::PipelineStats& stats) {
+    if (stats.sourceOccluded == lastCaptureOccluded_) {
+        return;
+    }
+    lastCaptureOccluded_ = stats.sourceOccluded;
+    if (stats.sourceOccluded) {
+        emit logMessage(QString("[%1] 경고: 선택한 창이 다른 창에 가려져 정확한 화면을 캡처할 수 없습니다. 창을 화면 맨 앞으로 이동하거나 오버레이를 최소화해주세요.")
+                         .arg(CurrentTimestamp()));
+        SetStatusMessage("창이 가려져 있습니다");
     } else {
-        lastCaptureOccluded_ = false;
+        emit logMessage(QString("[%1] 안내: 선택한 창이 다시 보이는 상태입니다.")
+                         .arg(CurrentTimestamp()));
+        SetStatusMessage("캡처 중...");
     }
+}
 
-    const auto results = ocrThread_->GetLatestResults();
-    auto logHook = [this](const QString& message) {
-        emit logMessage(message);
-    };
+void AppBackend::OnSentenceEvent(const sentence::TypewriterEvent& event) {
+    // 조립/타자기 추적/중복 억제는 파이프라인 문장 단계에서 끝났으므로 분석만 맡김
+    SentenceUpdate update;
+    update.sentenceId = event.sentenceId;
+    update.provisional = event.kind == sentence::TypewriterEvent::Kind::Partial;
+    update.revision = event.revision;
+    update.session = finalSequencer_.GetSession();
+    DispatchSentenceForTokenization(QString::fromStdString(event.text), update);
+}
 
-    auto assembled = sentenceAssembler_.TryAssemble(results, logHook);
-    if (!assembled.has_value()) {
-        return;
+void AppBackend::ApplyTypewriterSettleTime() {
+    // 글자가 멈춘 뒤 OCR 프레임을 한 번 더 봐야 확정하도록 캡처 간격보다 조금 길게
+    typewriterOptions_.settleTime = std::chrono::milliseconds(static_cast<int>(captureIntervalSeconds_ * 1000.0) + 150);
+    if (pipeline_) {
+        pipeline_->SetTypewriterOptions(typewriterOptions_);
     }
-
-    DispatchSentenceForTokenization(*assembled);
 }
 
 void AppBackend::InitializeEngines() {
@@ -911,7 +972,41 @@ void AppBackend::InitializeEngines() {
         .arg(QDateTime::currentDateTime().toString("HH:mm:ss"))
         .arg(QString::fromStdString(ocrEngine_->GetEngineName())));
 
-    tokenizer_ = std::make_unique<tokenizer::JapaneseTokenizer>();
+    if (!kanjiReadings_) {
+        const QDir baseDir(QCoreApplication::applicationDirPath());
+        const QString readingsPath = QDir::cleanPath(baseDir.filePath("configs/kanji_readings.tsv"));
+        auto table = std::make_shared<tokenizer::KanjiReadingTable>();
+        if (!QFileInfo::exists(readingsPath)) {
+            qWarning() << "[AppBackend] 한자 읽기 표 없음:" << readingsPath;
+            emit logMessage(QString("[%1] 경고: 한자 읽기 표 없음 (%2) - MeCab 읽기만 사용")
+                .arg(CurrentTimestamp())
+                .arg(readingsPath));
+        } else if (table->LoadFromFile(std::filesystem::path(readingsPath.toStdWString()))) {
+            emit logMessage(QString("[%1] 한자 읽기 표 로드: %2자")
+                .arg(CurrentTimestamp())
+                .arg(table->Size()));
+            kanjiReadings_ = std::move(table);
+        } else {
+            qWarning() << "[AppBackend] 한자 읽기 표 로드 실패:" << readingsPath;
+            emit logMessage(QString("[%1] 경고: 한자 읽기 표 로드 실패 (%2)")
+                .arg(CurrentTimestamp())
+                .arg(readingsPath));
+        }
+    }
+
+    if (!dictionary_.IsOpen()) {
+        const QDir baseDir(QCoreApplication::applicationDirPath());
+        const QString dictionaryPath = QDir::cleanPath(baseDir.filePath("dictionary/jmdict.tydict"));
+        if (QFileInfo::exists(dictionaryPath) &&
+            dictionary_.Open(std::filesystem::path(dictionaryPath.toStdWString()))) {
+            emit logMessage(QString("[%1] 사전 로드: %2 엔트리")
+                .arg(CurrentTimestamp())
+                .arg(dictionary_.EntryCount()));
+        }
+    }
+
+    // 이전 세션의 분석 작업은 자기 복사본을 쥐고 있으므로 여기서 바꿔도 실행 중인 호출은 안전
+    tokenizer_ = std::make_shared<tokenizer::JapaneseTokenizer>();
     
     if (!tokenizer_->Initialize()) {
         qCritical() << "[AppBackend] MeCab 초기화 실패!";
@@ -921,70 +1016,44 @@ void AppBackend::InitializeEngines() {
         return;
     }
 
+    if (!userDictionaryProfile_.isEmpty()) {
+        ApplyUserDictionary();
+    }
+    SyncSentenceCache();
+
     qDebug() << "[AppBackend] 엔진 초기화 완료";
     emit logMessage(QString("[%1] 엔진 초기화 완료")
         .arg(QDateTime::currentDateTime().toString("HH:mm:ss")));
 }
 
-AppBackend::CleanupSummary AppBackend::CleanupThreads(const std::shared_ptr<CleanupResources>& resources) {
-    CleanupSummary summary;
-
-    if (resources && resources->overlay) {
-        resources->overlay->Stop();
-        summary.overlayStopped = true;
-    }
-
-    if (resources && resources->ocr) {
-        resources->ocr->Stop();
-        summary.ocrStopped = true;
+std::vector<pipeline::PipelineStopper::StopStep> AppBackend::TakeOverlayStopSteps() {
+    std::vector<pipeline::PipelineStopper::StopStep> steps;
+    if (overlayThread_) {
+        // 정지 단계가 오버레이를 소유하므로 정리 스레드에서 멈추고 해제됨
+        steps.emplace_back([overlay = std::shared_ptr<OverlayThread>(std::move(overlayThread_))]() {
+            overlay->Stop();
+        });
     }
-
-    if (resources && resources->capture) {
-        resources->capture->Stop();
-        summary.captureStopped = true;
-    }
-
-    if (resources && resources->frameQueue) {
-        resources->frameQueue->Clear();
-    }
-
-    return summary;
+    return steps;
 }
 
 bool AppBackend::HasActiveWorkers() const {
-    return overlayThread_ || ocrThread_ || captureThread_;
+    return overlayThread_ || pipeline_;
 }
 
 bool AppBackend::HasCleanupInFlight() const {
-    return cleanupTasksInFlight_.load() > 0;
+    return pipelineStopper_.InFlight() > 0;
 }
 
-void AppBackend::HandleCleanupFinished(const CleanupSummary& summary,
-                                       const std::shared_ptr<std::future<void>>& futureRef) {
-    if (futureRef && futureRef->valid()) {
-        futureRef->wait();
-    }
+void AppBackend::HandleCleanupFinished(const pipeline::PipelineStopSummary& summary) {
+    const std::size_t remaining = summary.remaining;
 
-    {
-        std::lock_guard<std::mutex> lock(cleanupFuturesMutex_);
-        auto it = std::find(cleanupFutures_.begin(), cleanupFutures_.end(), futureRef);
-        if (it != cleanupFutures_.end()) {
-            cleanupFutures_.erase(it);
-        }
-    }
-
-    const int remaining = cleanupTasksInFlight_.fetch_sub(1) - 1;
-
-    if (summary.overlayStopped) {
+    if (summary.attachmentsStopped) {
         emit logMessage(QString("[%1] 오버레이 스레드 정리 완료").arg(CurrentTimestamp()));
     }
 
-    if (summary.ocrStopped) {
-        emit logMessage(QString("[%1] OCR 스레드 정리 완료").arg(CurrentTimestamp()));
-    }
-
-    if (summary.captureStopped) {
-        emit logMessage(QString("[%1] 캡처 스레드 정리 완료").arg(CurrentTimestamp()));
+    if (summary.pipelineStopped) {
+        emit logMessage(QString("[%1] 캡처/OCR 파이프라인 정리 완료").arg(CurrentTimestamp()));
     }
 
     if (!isCapturing_ && remaining == 0) {
@@ -1006,20 +1075,20 @@ void AppBackend::SetStatusMessage(const QString& message) {
     }
 }
 
-void AppBackend::ApplyRoiToOcrThread() {
-    if (!ocrThread_) {
+void AppBackend::ApplyRoiToPipeline() {
+    if (!pipeline_) {
         return;
     }
 
     if (selectedRoi_.width <= 0 || selectedRoi_.height <= 0) {
-        ocrThread_->ClearCropRegion();
+        pipeline_->ClearCropRegion();
         return;
     }
 
-    ocrThread_->SetCropRegion(selectedRoi_);
+    pipeline_->SetCropRegion(selectedRoi_);
 }
 
-void AppBackend::DispatchSentenceForTokenization(const QString& text) {
+void AppBackend::DispatchSentenceForTokenization(const QString& text, const SentenceUpdate& update) {
     if (!tokenizer_) {
         emit logMessage(QString("[%1] 토크나이저가 초기화되지 않았습니다")
             .arg(QDateTime::currentDateTime().toString("HH:mm:ss")));
@@ -1027,16 +1096,43 @@ void AppBackend::DispatchSentenceForTokenization(const QString& text) {
     }
 
     QPointer<AppBackend> self(this);
-    auto futurePtr = std::make_shared<std::future<void>>();
-
-    sentenceAssembler_.MarkSentenceInFlight(text);
 
-    auto task = [this, self, text, futurePtr]() mutable {
-        std::vector<tokenizer::Token> tokens;
-        {
-            std::lock_guard<std::mutex> lock(tokenizerMutex_);
-            if (tokenizer_) {
-                tokens = tokenizer_->Tokenize(text.toStdString());
+    SentenceUpdate tagged = update;
+    if (!update.provisional) {
+        if (pipeline_) {
+            pipeline_->MarkSentenceInFlight(text.toStdString());
+        }
+        tagged.finalTicket = finalSequencer_.Reserve(update.sentenceId);
+    }
+
+    auto tokenizer = tokenizer_;
+    auto cache = sentenceCache_;
+    auto kanjiReadings = kanjiReadings_;
+    auto unknownWords = unknownWords_;
+
+    pipeline::TokenizationJob job;
+    job.key = update.sentenceId;
+    job.supersedable = update.provisional;
+    job.run = [self, text, update = tagged, tokenizer, cache, kanjiReadings, unknownWords]() {
+        const std::string sentence = text.toStdString();
+
+        // 반복되는 문장은 캐시에서 바로 꺼내고, 처음 보는 문장만 분석
+        std::shared_ptr<const tokenizer::SentenceAnalysis> analysis = cache->Find(sentence);
+        if (!analysis) {
+            // JapaneseTokenizer는 호출마다 Tagger를 풀에서 빌리므로 별도 락 없이 동시 호출 가능
+            tokenizer::SentenceAnalysis fresh;
+            fresh.tokens = tokenizer->Tokenize(sentence);
+            tokenizer::FuriganaMapper mapper;
+            mapper.SetKanjiReadingTable(kanjiReadings);
+            fresh.furigana = mapper.MapTokensToFurigana(fresh.tokens);
+            // 부분 문장은 곧 더 긴 문장으로 바뀌므로 캐시/미등록어 통계에 넣지 않음
+            if (!update.provisional) {
+                unknownWords->Observe(fresh.tokens);
+            }
+            if (fresh.tokens.empty() || update.provisional) {
+                analysis = std::make_shared<const tokenizer::SentenceAnalysis>(std::move(fresh));
+            } else {
+                analysis = cache->Insert(sentence, std::move(fresh));
             }
         }
 
@@ -1044,85 +1140,347 @@ void AppBackend::DispatchSentenceForTokenization(const QString& text) {
             return;
         }
 
-        QMetaObject::invokeMethod(self, [self, text, tokens = std::move(tokens), futurePtr]() mutable {
-            if (!self) {
-                return;
-            }
-            self->HandleTokensReady(text, std::move(tokens));
-
-            std::lock_guard<std::mutex> guard(self->tokenizationFuturesMutex_);
-            auto it = std::find(self->tokenizationFutures_.begin(), self->tokenizationFutures_.end(), futurePtr);
-            if (it != self->tokenizationFutures_.end()) {
-                self->tokenizationFutures_.erase(it);
+        QMetaObject::invokeMethod(self, [self, text, update, analysis = std::move(analysis)]() mutable {
+            if (self) {
+                self->HandleTokensReady(text, std::move(analysis), update);
             }
         }, Qt::QueuedConnection);
     };
+    // 분석하지 않는 확정 문장(종료 시)은 다시 감지될 수 있도록 분석 중 표시를 풀고 발행 순번을 비움 (UI 스레드에서 호출됨)
+    job.cancel = [this, text, update = tagged]() {
+        if (update.provisional) {
+            return;
+        }
+        if (pipeline_) {
+            pipeline_->ClearSentenceInFlight(text.toStdString());
+        }
+        if (!shutdownRequested_.load()) {
+            CompleteFinalSentence(update.finalTicket, true);
+        }
+    };
 
-    try {
-        *futurePtr = std::async(std::launch::async, std::move(task));
-    } catch (const std::exception& ex) {
-        sentenceAssembler_.ClearSentenceInFlight(text);
-        emit logMessage(QString("[%1] 토큰화 작업 시작 실패: %2")
-            .arg(CurrentTimestamp())
-            .arg(QString::fromLocal8Bit(ex.what())));
-        return;
-    } catch (...) {
-        sentenceAssembler_.ClearSentenceInFlight(text);
-        emit logMessage(QString("[%1] 토큰화 작업 시작 실패: 알 수 없는 오류")
+    if (!tokenizationPool_->Submit(std::move(job))) {
+        emit logMessage(QString("[%1] 토큰화 작업 시작 실패: 작업 풀이 종료됨")
             .arg(CurrentTimestamp()));
+    }
+}
+
+void AppBackend::HandleTokensReady(const QString& text,
+                                   std::shared_ptr<const tokenizer::SentenceAnalysis> analysis,
+                                   const SentenceUpdate& update) {
+    if (update.provisional) {
+        // 재시작 전 세션이거나, 같은 문장이 이미 확정됐거나 다음 문장이 확정됐으면 늦게 끝난 부분 분석은 버림
+        const bool stale = finalSequencer_.IsPartialStale(update.session, update.sentenceId, update.revision);
+        if (stale || !analysis || analysis->tokens.empty()) {
+            return;
+        }
+        emit provisionalSentenceDetected(text, ConvertTokensToVariant(*analysis));
         return;
     }
 
-    {
-        std::lock_guard<std::mutex> guard(tokenizationFuturesMutex_);
-        tokenizationFutures_.push_back(futurePtr);
+    pendingFinals_[update.finalTicket] = PendingFinalSentence{text, std::move(analysis), update};
+    CompleteFinalSentence(update.finalTicket, false);
+}
+
+void AppBackend::CompleteFinalSentence(std::uint64_t ticket, bool cancelled) {
+    // 앞 문장의 분석이 끝날 때까지 뒤 문장은 기다렸다가 요청 순서대로 발행
+    for (const std::uint64_t released : finalSequencer_.Complete(ticket, cancelled)) {
+        auto it = pendingFinals_.find(released);
+        if (it == pendingFinals_.end()) {
+            continue;
+        }
+        const PendingFinalSentence pending = std::move(it->second);
+        pendingFinals_.erase(it);
+        PublishFinalSentence(pending.text, pending.analysis, pending.update);
     }
 }
 
-void AppBackend::HandleTokensReady(const QString& text, std::vector<tokenizer::Token>&& tokens) {
-    sentenceAssembler_.ClearSentenceInFlight(text);
+void AppBackend::PublishFinalSentence(const QString& text,
+                                      const std::shared_ptr<const tokenizer::SentenceAnalysis>& analysis,
+                                      const SentenceUpdate& update) {
+    if (pipeline_) {
+        pipeline_->ClearSentenceInFlight(text.toStdString());
+    }
 
     if (text.isEmpty()) {
         return;
     }
 
-    if (tokens.empty()) {
+    if (!analysis || analysis->tokens.empty()) {
         emit logMessage(QString("[%1] 토큰화 결과가 비어 있습니다")
             .arg(QDateTime::currentDateTime().toString("HH:mm:ss")));
         return;
     }
 
-    auto qmlTokens = ConvertTokensToVariant(tokens);
+    auto qmlTokens = ConvertTokensToVariant(*analysis);
 
-    sentenceAssembler_.MarkSentencePublished(text);
+    if (pipeline_) {
+        pipeline_->MarkSentencePublished(text.toStdString());
+    }
 
     {
         std::lock_guard<std::mutex> lock(sentencesMutex_);
-        sentences_.push_back(text.toStdString());
+        if (update.revision && !sentences_.empty()) {
+            sentences_.back() = text.toStdString();
+        } else {
+            sentences_.push_back(text.toStdString());
+        }
     }
 
-    emit sentenceDetected(text, qmlTokens);
+    emit sentenceDetected(text, qmlTokens, update.revision);
     emit logMessage(QString("[%1] 문장 감지: %2")
         .arg(QDateTime::currentDateTime().toString("HH:mm:ss"))
         .arg(text));
 }
 
-QVariantList AppBackend::ConvertTokensToVariant(const std::vector<tokenizer::Token>& tokens) const {
+QVariantList AppBackend::ConvertTokensToVariant(const tokenizer::SentenceAnalysis& analysis) const {
+    const auto& tokens = analysis.tokens;
+    const bool hasFurigana = analysis.furigana.size() == tokens.size();
+
     QVariantList qmlTokens;
-    qmlTokens.reserve(tokens.size());
+    qmlTokens.reserve(static_cast<int>(tokens.size()));
 
-    for (const auto& token : tokens) {
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        const auto& token = tokens[i];
         QVariantMap tokenMap;
         tokenMap["surface"] = QString::fromStdString(token.surface);
         tokenMap["reading"] = QString::fromStdString(token.reading);
         tokenMap["baseForm"] = QString::fromStdString(token.baseForm);
         tokenMap["partOfSpeech"] = QString::fromStdString(token.partOfSpeech);
+
+        // 기본형으로 사전 조회 (기본형이 없으면 표면형), 첫 엔트리의 첫 뜻만 전달
+        const std::string& lookupKey = token.baseForm.empty() ? token.surface : token.baseForm;
+        std::optional<std::uint32_t> entryId;
+        if (const auto entryIds = dictionary_.Lookup(lookupKey); !entryIds.empty()) {
+            entryId = entryIds.front();
+        } else if (dictionary_.IsOpen()) {
+            // 형태소 분석기가 기본형을 못 준 활용형은 역변환으로 조회 (표면형 전체가 일치할 때만)
+            const auto match = deinflector_.FindLongestMatch(dictionary_, token.surface);
+            if (match && match->length == token.surface.size()) {
+                entryId = match->entryId;
+            }
+        }
+        if (entryId) {
+            const auto entry = dictionary_.Entry(*entryId);
+            const auto sense = dictionary_.Sense(entry.id, 0);
+            tokenMap["dictionaryForm"] = QString::fromUtf8(entry.headword.data(), static_cast<int>(entry.headword.size()));
+            tokenMap["gloss"] = QString::fromUtf8(sense.glosses.data(), static_cast<int>(sense.glosses.size()));
+        }
+        if (hasFurigana) {
+            const auto& furigana = analysis.furigana[i];
+            tokenMap["furigana"] = QString::fromStdString(furigana.reading);
+            tokenMap["needsRuby"] = furigana.needsRuby;
+
+            QVariantList rubySpans;
+            for (const auto& span : furigana.rubySpans) {
+                QVariantMap spanMap;
+                spanMap["base"] = QString::fromStdString(span.baseText);
+                spanMap["reading"] = QString::fromStdString(span.reading);
+                rubySpans.append(spanMap);
+            }
+            tokenMap["rubySpans"] = rubySpans;
+        }
         qmlTokens.append(tokenMap);
     }
 
     return qmlTokens;
 }
 
+void AppBackend::SwitchSentenceCache(const QString& gameTitle) {
+    const QString cacheDir = QDir(QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation))
+        .filePath("sentence_cache");
+    const QString fileName = QString::fromStdString(
+        tokenizer::SentenceAnalysisCache::MakeCacheFileName(gameTitle.toStdString()));
+    const QString path = QDir(cacheDir).filePath(fileName);
+    if (path == sentenceCachePath_) {
+        return;
+    }
+
+    // 이전 타이틀 캐시를 저장한 뒤 새 타이틀 캐시로 교체
+    // (파일은 새 타이틀의 사용자 사전이 정해진 뒤 SyncSentenceCache에서 읽음)
+    SaveSentenceCache();
+    sentenceCache_->Clear();
+    sentenceCachePath_ = path;
+    sentenceCacheLoadPending_ = true;
+}
+
+void AppBackend::SyncSentenceCache() {
+    // 사용자 사전 컴파일이 끝나야 캐시 파일에 기록된 사전과 비교할 수 있음
+    if (!tokenizer_ || userDictionaryBuildPending_) {
+        return;
+    }
+
+    // 사전이 바뀌었으면 이전 사전으로 분석한 항목은 여기서 버려짐
+    sentenceCache_->SetSignature(
+        QString::fromStdWString(tokenizer_->GetUserDictionary().filename().wstring()).toStdString());
+    if (!sentenceCacheLoadPending_ || sentenceCachePath_.isEmpty()) {
+        return;
+    }
+
+    sentenceCacheLoadPending_ = false;
+    if (sentenceCache_->LoadFromFile(std::filesystem::path(sentenceCachePath_.toStdWString()))) {
+        emit logMessage(QString("[%1] 문장 캐시 로드: %2개 (%3)")
+            .arg(CurrentTimestamp())
+            .arg(sentenceCache_->GetStats().entries)
+            .arg(QFileInfo(sentenceCachePath_).fileName()));
+    }
+}
+
+void AppBackend::SwitchUserDictionary(const QString& gameTitle) {
+    std::string profile = tokenizer::SentenceAnalysisCache::MakeCacheFileName(gameTitle.toStdString());
+    profile.erase(profile.size() - std::string_view(".json").size());
+    const QString profileName = QString::fromStdString(profile);
+    if (profileName == userDictionaryProfile_) {
+        return;
+    }
+
+    userDictionaryProfile_ = profileName;
+    unknownWords_->Clear();
+    if (tokenizer_) {
+        ApplyUserDictionary();
+    }
+}
+
+void AppBackend::ApplyUserDictionary() {
+    if (!tokenizer_ || userDictionaryProfile_.isEmpty()) {
+        return;
+    }
+
+    // 진행 중인 이전 컴파일 결과는 버림 (다른 게임으로 바꿨거나 단어를 더 추가한 경우)
+    const std::uint64_t generation = ++userDictionaryGeneration_;
+    const QDir dataDir(QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation));
+    const auto listPath = std::filesystem::path(
+        dataDir.filePath("user_words/" + userDictionaryProfile_ + ".tsv").toStdWString());
+    auto words = tokenizer::LoadUserWordList(listPath);
+    if (!words || words->empty()) {
+        // 단어 목록이 없는 게임은 시스템 사전만 사용 (이미 시스템 사전뿐이면 Model을 다시 만들지 않음)
+        if (!tokenizer_->GetUserDictionary().empty()) {
+            tokenizer_->SetUserDictionary({});
+        }
+        userDictionaryBuildPending_ = false;
+        SyncSentenceCache();
+        return;
+    }
+
+    // 목록이 바뀌지 않았으면 캐시된 .dic을 그대로 쓰므로 보통은 파일 확인만 하지만,
+    // 컴파일은 사전 크기만큼 걸리므로 작업 스레드에서 하고 Model 교체만 UI 스레드에서 함
+    const std::size_t wordCount = words->size();
+    auto futurePtr = std::make_shared<std::future<void>>();
+    *futurePtr = std::async(std::launch::async,
+        [this, futurePtr, generation, wordCount,
+         words = std::move(*words),
+         systemDicDir = tokenizer_->GetDictionaryDir(),
+         outputDir = std::filesystem::path(dataDir.filePath("user_dic").toStdWString()),
+         profile = userDictionaryProfile_.toStdString()]() {
+            std::string error;
+            auto dicPath = tokenizer::BuildUserDictionary(words, systemDicDir, outputDir, profile, &error);
+            QMetaObject::invokeMethod(this, [this, futurePtr, generation, wordCount,
+                                             dicPath = std::move(dicPath), error = std::move(error)]() {
+                {
+                    std::lock_guard<std::mutex> lock(userDictionaryBuildsMutex_);
+                    auto it = std::find(userDictionaryBuilds_.begin(), userDictionaryBuilds_.end(), futurePtr);
+                    if (it != userDictionaryBuilds_.end()) {
+                        userDictionaryBuilds_.erase(it);
+                    }
+                }
+                HandleUserDictionaryBuilt(generation, dicPath, error, wordCount);
+            }, Qt::QueuedConnection);
+        });
+
+    {
+        std::lock_guard<std::mutex> lock(userDictionaryBuildsMutex_);
+        userDictionaryBuilds_.push_back(futurePtr);
+    }
+    userDictionaryBuildPending_ = true;
+}
+
+void AppBackend::HandleUserDictionaryBuilt(std::uint64_t generation,
+                                           const std::optional<std::filesystem::path>& dicPath,
+                                           const std::string& error,
+                                           std::size_t wordCount) {
+    if (generation != userDictionaryGeneration_ || !tokenizer_) {
+        return;
+    }
+    userDictionaryBuildPending_ = false;
+
+    // 이미 같은 사전이 붙어 있으면 Model을 다시 만들지 않음
+    const bool alreadyLoaded = dicPath && *dicPath == tokenizer_->GetUserDictionary();
+    if (!dicPath || (!alreadyLoaded && !tokenizer_->SetUserDictionary(*dicPath))) {
+        emit logMessage(QString("[%1] 사용자 사전 적용 실패: %2")
+            .arg(CurrentTimestamp())
+            .arg(QString::fromStdString(error)));
+        SyncSentenceCache();
+        return;
+    }
+
+    SyncSentenceCache();
+    emit logMessage(QString("[%1] 사용자 사전 적용: %2 단어 (%3)")
+        .arg(CurrentTimestamp())
+        .arg(wordCount)
+        .arg(userDictionaryProfile_));
+    emit userDictionaryChanged();
+}
+
+QVariantList AppBackend::userWordSuggestions() const {
+    QVariantList suggestions;
+    for (const auto& suggestion : unknownWords_->Suggestions(3, 20)) {
+        QVariantMap item;
+        item["surface"] = QString::fromStdString(suggestion.surface);
+        item["reading"] = QString::fromStdString(text::KatakanaToHiragana(suggestion.reading));
+        item["occurrences"] = static_cast<int>(suggestion.occurrences);
+        suggestions.append(item);
+    }
+    return suggestions;
+}
+
+bool AppBackend::addUserWord(const QString& surface, const QString& reading) {
+    if (userDictionaryProfile_.isEmpty() || surface.trimmed().isEmpty()) {
+        return false;
+    }
+
+    const QDir dataDir(QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation));
+    const auto listPath = std::filesystem::path(
+        dataDir.filePath("user_words/" + userDictionaryProfile_ + ".tsv").toStdWString());
+    auto words = tokenizer::LoadUserWordList(listPath).value_or(std::vector<tokenizer::UserWord>{});
+    const std::string newSurface = surface.trimmed().toStdString();
+    const auto existing = std::find_if(words.begin(), words.end(), [&](const tokenizer::UserWord& word) {
+        return word.surface == newSurface;
+    });
+    if (existing != words.end()) {
+        existing->reading = reading.trimmed().toStdString();
+    } else {
+        words.push_back({newSurface, reading.trimmed().toStdString(), {}});
+    }
+    if (!tokenizer::SaveUserWordList(listPath, words)) {
+        return false;
+    }
+
+    // 사전 컴파일/교체는 비동기로 끝나며 완료되면 userDictionaryChanged를 보냄
+    unknownWords_->Forget(newSurface);
+    ApplyUserDictionary();
+    return true;
+}
+
+void AppBackend::SaveSentenceCache() {
+    // 아직 읽지 않은 파일을 이번 세션 항목만으로 덮어쓰지 않음
+    if (sentenceCachePath_.isEmpty() || sentenceCacheLoadPending_) {
+        return;
+    }
+
+    const auto stats = sentenceCache_->GetStats();
+    if (stats.entries == 0) {
+        return;
+    }
+
+    if (!sentenceCache_->SaveToFile(std::filesystem::path(sentenceCachePath_.toStdWString()))) {
+        qWarning() << "[AppBackend] 문장 캐시 저장 실패:" << sentenceCachePath_;
+        return;
+    }
+
+    qDebug() << "[AppBackend] 문장 캐시 저장:" << stats.entries << "개,"
+             << "적중" << stats.hits << "/ 미적중" << stats.misses;
+}
+
 QPixmap AppBackend::CaptureWindowPreview() const {
     auto convertToPixmap = [](const cv::Mat& frame) -> QPixmap {
         if (frame.empty()) {
@@ -11,16 +11,25 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <opencv2/core.hpp>
 
-#include "core/capture/frame_queue.h"
-#include "core/capture/capture_thread.h"
+#include "core/capture/preview_downsampler.h"
+#include "core/capture/window_capture.h"
+#include "core/dictionary/compiled_dictionary.h"
+#include "core/dictionary/deinflector.h"
 #include "core/ocr/ocr_engine_bootstrapper.h"
-#include "core/ocr/ocr_thread.h"
+#include "core/pipeline/final_sentence_sequencer.h"
+#include "core/pipeline/pipeline.h"
+#include "core/pipeline/pipeline_stopper.h"
+#include "core/pipeline/tokenization_worker_pool.h"
+#include "core/sentence/typewriter_tracker.h"
 #include "core/tokenizer/japanese_tokenizer.h"
+#include "core/tokenizer/sentence_analysis_cache.h"
+#include "core/tokenizer/user_dictionary.h"
+#include "ui/qml_backend/preview_image_provider.h"
 #include "ui/qml_backend/process_enumerator.h"
-#include "ui/qml_backend/sentence_assembler.h"
 #include "ui/overlay/overlay_window.h"
 #include "ui/overlay/overlay_thread.h"
 
@@ -38,10 +47,11 @@ class AppBackend : public QObject {
     Q_PROPERTY(QStringList processList READ GetProcessList NOTIFY processListChanged)
     Q_PROPERTY(bool isCapturing READ GetIsCapturing NOTIFY isCapturingChanged)
     Q_PROPERTY(QString statusMessage READ GetStatusMessage NOTIFY statusMessageChanged)
-    Q_PROPERTY(QString previewImageData READ GetPreviewImageData NOTIFY previewImageDataChanged)
+    Q_PROPERTY(QString previewImageSource READ GetPreviewImageSource NOTIFY previewImageDataChanged)
     Q_PROPERTY(QSize previewImageSize READ GetPreviewImageSize NOTIFY previewImageDataChanged)
     Q_PROPERTY(double captureIntervalSeconds READ GetCaptureIntervalSeconds WRITE setCaptureIntervalSeconds NOTIFY captureIntervalSecondsChanged)
     Q_PROPERTY(int ocrEngineType READ GetOcrEngineType WRITE setOcrEngineType NOTIFY ocrEngineTypeChanged)
+    Q_PROPERTY(bool changeDetectionEnabled READ GetChangeDetectionEnabled WRITE setChangeDetectionEnabled NOTIFY changeDetectionEnabledChanged)
 
 public:
     explicit AppBackend(QObject* parent = nullptr);
@@ -51,11 +61,17 @@ public:
     QStringList GetProcessList() const { return processList_; }
     bool GetIsCapturing() const { return isCapturing_; }
     QString GetStatusMessage() const { return statusMessage_; }
-    QString GetPreviewImageData() const { return previewImageData_; }
+    QString GetPreviewImageSource() const { return previewImageSource_; }
     QSize GetPreviewImageSize() const { return previewImageSize_; }
     double GetCaptureIntervalSeconds() const { return captureIntervalSeconds_; }
+    bool GetChangeDetectionEnabled() const { return changeDetectionEnabled_; }
     int GetOcrEngineType() const { return static_cast<int>(selectedEngineType_); }
 
+    /**
+     * @brief "preview" 이미지 제공자와 공유할 미리보기 보관소 (main에서 엔진에 등록)
+     */
+    std::shared_ptr<PreviewImageStore> GetPreviewImageStore() const { return previewStore_; }
+
 public slots:
     // UI에서 호출하는 메서드들 (Qt slots는 camelCase 관례 따름)
     void refreshProcessList();
@@ -67,9 +83,12 @@ public slots:
     void clearSentences();
     Q_INVOKABLE void refreshPreviewImage();
     Q_INVOKABLE void setCaptureIntervalSeconds(double seconds);
+    Q_INVOKABLE void setChangeDetectionEnabled(bool enabled);
     Q_INVOKABLE QString saveCurrentRoiSnapshot();
     Q_INVOKABLE void runSampleOcr(const QString& imagePath);
     Q_INVOKABLE void setOcrEngineType(int engineType);
+    Q_INVOKABLE QVariantList userWordSuggestions() const;
+    Q_INVOKABLE bool addUserWord(const QString& surface, const QString& reading);
 
 signals:
     // QML로 보내는 시그널들
@@ -77,50 +96,95 @@ signals:
     void isCapturingChanged();
     void statusMessageChanged();
     void logMessage(const QString& message);
-    void sentenceDetected(const QString& originalText, const QVariantList& tokens);
+    // replacesPrevious: 이미 보낸 마지막 문장이 더 늘어나 다시 확정된 경우 (목록의 맨 위 항목 교체)
+    void sentenceDetected(const QString& originalText, const QVariantList& tokens, bool replacesPrevious);
+    // 아직 나타나는 중인 문장 (다음 부분/확정 문장으로 교체됨)
+    void provisionalSentenceDetected(const QString& originalText, const QVariantList& tokens);
     void previewImageDataChanged();
     void captureIntervalSecondsChanged();
+    void changeDetectionEnabledChanged();
     void ocrEngineTypeChanged();
-
-private slots:
-    void OnPollOcrResults();
+    // 사용자 사전이 새로 적용됨 (후보 목록 갱신용)
+    void userDictionaryChanged();
 
 private:
-    void InitializeEngines();
-    struct CleanupSummary {
-        bool overlayStopped = false;
-        bool ocrStopped = false;
-        bool captureStopped = false;
-    };
+    /**
+     * @brief 파이프라인의 문장/통계/로그 알림을 UI 스레드로 넘김 (이전 캡처 세션의 알림은 무시)
+     */
+    void SubscribeToPipeline();
+    void OnSentenceEvent(const sentence::TypewriterEvent& event);
+    void OnPipelineStats(const pipeline::PipelineStats& stats);
 
-    struct CleanupResources {
-        std::unique_ptr<OverlayThread> overlay;
-        std::unique_ptr<ocr::OcrThread> ocr;
-        std::unique_ptr<capture::CaptureThread> capture;
-        std::shared_ptr<toriyomi::FrameQueue> frameQueue;
-    };
-
-    CleanupSummary CleanupThreads(const std::shared_ptr<CleanupResources>& resources);
+    void InitializeEngines();
+    /**
+     * @brief 오버레이 스레드를 넘겨받아 파이프라인보다 먼저 실행할 정지 단계로 만듦 (overlayThread_는 비워짐)
+     */
+    std::vector<pipeline::PipelineStopper::StopStep> TakeOverlayStopSteps();
     bool HasActiveWorkers() const;
     bool HasCleanupInFlight() const;
-    void HandleCleanupFinished(const CleanupSummary& summary,
-                               const std::shared_ptr<std::future<void>>& futureRef);
+    void HandleCleanupFinished(const pipeline::PipelineStopSummary& summary);
     void SetStatusMessage(const QString& message);
     QPixmap CaptureWindowPreview() const;
+    void ClearPreviewImage();
     HWND ResolvePreferredWindow(HWND candidate) const;
-    void ApplyRoiToOcrThread();
-    void DispatchSentenceForTokenization(const QString& text);
-    void HandleTokensReady(const QString& text, std::vector<tokenizer::Token>&& tokens);
-    QVariantList ConvertTokensToVariant(const std::vector<tokenizer::Token>& tokens) const;
+    void ApplyRoiToPipeline();
+    /**
+     * @brief 타자기 추적 이벤트 정보 (확정 문장만 캐시/목록에 반영)
+     */
+    struct SentenceUpdate {
+        std::uint64_t sentenceId = 0;
+        bool provisional = false;
+        bool revision = false;
+        std::uint64_t session = 0;          // 이벤트를 낸 파이프라인 세션
+        std::uint64_t finalTicket = 0;      // 확정 문장 발행 순번 (분석 요청 순서)
+    };
+
+    /**
+     * @brief 분석이 끝나 발행 차례를 기다리는 확정 문장
+     */
+    struct PendingFinalSentence {
+        QString text;
+        std::shared_ptr<const tokenizer::SentenceAnalysis> analysis;
+        SentenceUpdate update;
+    };
+
+    void DispatchSentenceForTokenization(const QString& text, const SentenceUpdate& update = {});
+    void HandleTokensReady(const QString& text,
+                           std::shared_ptr<const tokenizer::SentenceAnalysis> analysis,
+                           const SentenceUpdate& update);
+    void CompleteFinalSentence(std::uint64_t ticket, bool cancelled);
+    void PublishFinalSentence(const QString& text,
+                              const std::shared_ptr<const tokenizer::SentenceAnalysis>& analysis,
+                              const SentenceUpdate& update);
+    void ApplyTypewriterSettleTime();
+    QVariantList ConvertTokensToVariant(const tokenizer::SentenceAnalysis& analysis) const;
+    void SwitchSentenceCache(const QString& gameTitle);
+    void SaveSentenceCache();
+    /**
+     * @brief 문장 캐시를 현재 사용자 사전에 맞춤 (사전이 바뀌면 비우고, 대기 중인 캐시 파일을 읽음)
+     */
+    void SyncSentenceCache();
+    void SwitchUserDictionary(const QString& gameTitle);
+    /**
+     * @brief 현재 프로필의 단어 목록으로 사용자 사전 적용 (컴파일은 작업 스레드에서)
+     */
+    void ApplyUserDictionary();
+    void HandleUserDictionaryBuilt(std::uint64_t generation,
+                                   const std::optional<std::filesystem::path>& dicPath,
+                                   const std::string& error,
+                                   std::size_t wordCount);
 
     // UI 상태
     QStringList processList_;
     std::vector<HWND> processWindows_;
     bool isCapturing_ = false;
     QString statusMessage_;
-    QString previewImageData_;
-    QSize previewImageSize_;
+    QString previewImageSource_;            // image://preview/<버전>
+    QSize previewImageSize_;                // 축소 전 프레임 크기
+    std::shared_ptr<PreviewImageStore> previewStore_ = std::make_shared<PreviewImageStore>();
+    capture::PreviewDownsampler previewDownsampler_;
     double captureIntervalSeconds_ = 1.0;
+    bool changeDetectionEnabled_ = false;   // 화면이 멈춘 뒤 한 번만 OCR (끄면 타자기 추적으로 부분 문장 표시)
     
     // 선택된 윈도우 및 ROI
     HWND selectedWindow_ = nullptr;
@@ -128,32 +192,56 @@ private:
     bool hasRoiSelection_ = false;
     bool lastCaptureOccluded_ = false;
 
-    // 파이프라인 컴포넌트
-    std::shared_ptr<toriyomi::FrameQueue> frameQueue_;
-    std::unique_ptr<capture::CaptureThread> captureThread_;
-    std::unique_ptr<ocr::OcrThread> ocrThread_;
-    std::shared_ptr<ocr::IOcrEngine> ocrEngine_;  // shared: OcrThread와 생명주기 공유
-    std::unique_ptr<tokenizer::JapaneseTokenizer> tokenizer_;
+    // 파이프라인 컴포넌트 (캡처 → OCR → 문장 단계는 pipeline_이 소유)
+    std::unique_ptr<pipeline::Pipeline> pipeline_;
+    std::shared_ptr<ocr::IOcrEngine> ocrEngine_;  // shared: Pipeline과 생명주기 공유
+    std::shared_ptr<tokenizer::JapaneseTokenizer> tokenizer_;   // shared: 분석 작업이 끝날 때까지 이전 토크나이저 유지
     std::unique_ptr<OverlayThread> overlayThread_;
 
     ocr::OcrEngineBootstrapper ocrBootstrapper_;
     ocr::OcrEngineType selectedEngineType_ = ocr::OcrEngineType::PaddleOCR;
 
-    // OCR 결과 폴링 타이머
-    QTimer* pollTimer_ = nullptr;
+    // 캡처를 시작/중지할 때마다 증가 (정리 중인 이전 파이프라인의 알림 무시)
+    std::uint64_t pipelineGeneration_ = 0;
 
     // 문장 리스트
     std::vector<std::string> sentences_;
     std::mutex sentencesMutex_;
-    SentenceAssembler sentenceAssembler_;
-
-    std::mutex tokenizerMutex_;
-    std::vector<std::shared_ptr<std::future<void>>> tokenizationFutures_;
-    std::mutex tokenizationFuturesMutex_;
-
-    std::vector<std::shared_ptr<std::future<void>>> cleanupFutures_;
-    std::mutex cleanupFuturesMutex_;
-    std::atomic_int cleanupTasksInFlight_{0};
+    sentence::TypewriterOptions typewriterOptions_;   // 캡처 시작 시 파이프라인에 적용
+    // 확정 문장은 분석이 끝나는 순서와 관계없이 감지 순서대로 발행 (세션은 캡처 시작마다 새로)
+    pipeline::FinalSentenceSequencer finalSequencer_;
+    std::unordered_map<std::uint64_t, PendingFinalSentence> pendingFinals_;   // 순번 → 분석 결과
+
+    // 문장 분석 캐시 (게임 타이틀별 파일로 영속화)
+    std::shared_ptr<tokenizer::SentenceAnalysisCache> sentenceCache_ =
+        std::make_shared<tokenizer::SentenceAnalysisCache>();
+    QString sentenceCachePath_;
+    bool sentenceCacheLoadPending_ = false;     // 사용자 사전이 정해지면 읽을 캐시 파일이 있음
+
+    // 게임별 사용자 사전 (user_words/<타이틀>.tsv → user_dic/<타이틀>_<해시>.dic)
+    QString userDictionaryProfile_;
+    std::uint64_t userDictionaryGeneration_ = 0;   // 적용 요청마다 증가 (늦게 끝난 이전 컴파일 무시)
+    bool userDictionaryBuildPending_ = false;
+    std::shared_ptr<tokenizer::UnknownWordTracker> unknownWords_ =
+        std::make_shared<tokenizer::UnknownWordTracker>();
+
+    // 후리가나 정렬용 한자 읽기 표 (configs/kanji_readings.tsv, 없으면 표 없이 정렬)
+    std::shared_ptr<const tokenizer::KanjiReadingTable> kanjiReadings_;
+
+    // 토큰 뜻풀이용 컴파일 사전 (dictionary/jmdict.tydict, 없으면 뜻풀이 없음)
+    dictionary::CompiledDictionary dictionary_;
+    dictionary::Deinflector deinflector_;
+
+    // 형태소 분석 작업 (확정 문장은 순서대로, 부분 문장은 최신 우선이고 밀려나면 취소)
+    std::unique_ptr<pipeline::TokenizationWorkerPool> tokenizationPool_ =
+        std::make_unique<pipeline::TokenizationWorkerPool>();
+
+    // 사용자 사전 컴파일 작업 (종료 시 대기)
+    std::vector<std::shared_ptr<std::future<void>>> userDictionaryBuilds_;
+    std::mutex userDictionaryBuildsMutex_;
+
+    // 캡처 중지 시 오버레이 → 파이프라인 정리 (작업 스레드에서, 종료 시 대기)
+    pipeline::PipelineStopper pipelineStopper_;
     std::atomic_bool shutdownRequested_{false};
 };
 
@@ -0,0 +1,68 @@
+#include "ui/qml_backend/preview_image_provider.h"
+
+#include <utility>
+
+namespace toriyomi {
+namespace ui {
+
+void PreviewImageStore::Publish(QImage image) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    image_ = std::move(image);
+}
+
+void PreviewImageStore::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    image_ = QImage();
+}
+
+QImage PreviewImageStore::Latest() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return image_;
+}
+
+QImage PreviewImageStore::WrapMat(const cv::Mat& image) {
+    if (image.empty() || image.depth() != CV_8U) {
+        return QImage();
+    }
+
+    QImage::Format format = QImage::Format_Invalid;
+    switch (image.channels()) {
+    case 1:
+        format = QImage::Format_Grayscale8;
+        break;
+    case 3:
+        format = QImage::Format_BGR888;
+        break;
+    case 4:
+        // BGRA 메모리 배치 = 리틀 엔디언 0xAARRGGBB (알파는 무시)
+        format = QImage::Format_RGB32;
+        break;
+    default:
+        return QImage();
+    }
+
+    auto* owner = new cv::Mat(image);
+    return QImage(owner->data, owner->cols, owner->rows, static_cast<qsizetype>(owner->step), format,
+                  [](void* info) { delete static_cast<cv::Mat*>(info); }, owner);
+}
+
+PreviewImageProvider::PreviewImageProvider(std::shared_ptr<PreviewImageStore> store)
+    : QQuickImageProvider(QQuickImageProvider::Image)
+    , store_(std::move(store)) {
+}
+
+QImage PreviewImageProvider::requestImage(const QString& /*id*/, QSize* size, const QSize& requestedSize) {
+    QImage image = store_ ? store_->Latest() : QImage();
+    if (size) {
+        *size = image.size();
+    }
+    // 보관된 이미지는 이미 미리보기 크기이므로 더 작게 요청한 경우에만 줄임
+    if (!image.isNull() && requestedSize.isValid() &&
+        (requestedSize.width() < image.width() || requestedSize.height() < image.height())) {
+        return image.scaled(requestedSize, Qt::KeepAspectRatio, Qt::FastTransformation);
+    }
+    return image;
+}
+
+}  // namespace ui
+}  // namespace toriyomi
@@ -0,0 +1,52 @@
+// ToriYomi - ROI 선택 미리보기 이미지 제공자
+// "image://preview/<버전>"으로 최신 미리보기를 QML Image에 넘김 (PNG/base64 인코딩 없음)
+
+#pragma once
+
+#include <QImage>
+#include <QQuickImageProvider>
+#include <memory>
+#include <mutex>
+#include <opencv2/core.hpp>
+
+namespace toriyomi {
+namespace ui {
+
+/**
+ * @brief 백엔드가 올리고 이미지 제공자가 읽는 최신 미리보기 보관소
+ *
+ * QQmlEngine이 이미지 제공자를 소유/삭제하므로 백엔드와는 이 보관소를 공유합니다.
+ */
+class PreviewImageStore {
+public:
+    void Publish(QImage image);
+    void Clear();
+    QImage Latest() const;
+
+    /**
+     * @brief cv::Mat 버퍼를 복사하지 않고 감싼 QImage (QImage가 살아 있는 동안 Mat 참조 유지)
+     *
+     * 채널 수에 맞춰 BGR888/RGB32/Grayscale8 형식을 골라 색 변환도 하지 않습니다.
+     */
+    static QImage WrapMat(const cv::Mat& image);
+
+private:
+    mutable std::mutex mutex_;
+    QImage image_;
+};
+
+/**
+ * @brief QML Image용 미리보기 제공자 (요청 ID의 버전은 캐시 무효화용으로만 사용)
+ */
+class PreviewImageProvider : public QQuickImageProvider {
+public:
+    explicit PreviewImageProvider(std::shared_ptr<PreviewImageStore> store);
+
+    QImage requestImage(const QString& id, QSize* size, const QSize& requestedSize) override;
+
+private:
+    std::shared_ptr<PreviewImageStore> store_;
+};
+
+}  // namespace ui
+}  // namespace toriyomi
@@ -0,0 +1,119 @@
+// ToriYomi - 적응형 캡처 간격 조절 단위 테스트
+
+#include "core/capture/capture_pacer.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::capture;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Clock = CapturePacer::Clock;
+
+CapturePacerOptions TestOptions() {
+    CapturePacerOptions options;
+    options.baseInterval = 1000ms;
+    options.activeInterval = 200ms;
+    options.maxInterval = 3000ms;
+    options.backoffFactor = 2.0;
+    options.retryDelay = 10ms;
+    return options;
+}
+
+}  // namespace
+
+TEST(CapturePacerTest, ActiveChangesShortenAndStaticFramesBackOff) {
+    CapturePacer pacer(TestOptions());
+    const Clock::time_point start{};
+    pacer.Reset(start);
+    EXPECT_EQ(pacer.NextDeadline(), start);
+
+    pacer.OnFrame(true, start);
+    EXPECT_EQ(pacer.NextDeadline(), start + 200ms);
+    EXPECT_EQ(pacer.GetStats().lastDecision, PacingDecision::Active);
+
+    // 200 → 400 → 800 → 1600 → 3000(상한)
+    Clock::time_point now = pacer.NextDeadline();
+    const std::chrono::milliseconds expected[] = {400ms, 800ms, 1600ms, 3000ms, 3000ms};
+    for (const auto interval : expected) {
+        const Clock::time_point deadline = pacer.NextDeadline();
+        pacer.OnFrame(false, now);
+        EXPECT_EQ(pacer.NextDeadline(), deadline + interval);
+        now = pacer.NextDeadline();
+    }
+    EXPECT_EQ(pacer.GetStats().lastDecision, PacingDecision::Idle);
+    EXPECT_EQ(pacer.GetStats().staticFrames, 5u);
+
+    // 다시 바뀌면 바로 짧은 간격
+    pacer.OnFrame(true, now);
+    EXPECT_EQ(pacer.NextDeadline(), now + 200ms);
+    EXPECT_DOUBLE_EQ(pacer.GetStats().intervalMs, 200.0);
+}
+
+TEST(CapturePacerTest, DeadlinesDoNotDriftOrBurst) {
+    CapturePacer pacer(TestOptions());
+    const Clock::time_point start{};
+    pacer.Reset(start);
+
+    // 캡처에 30ms 걸려도 다음 마감은 직전 마감 + 간격
+    pacer.OnFrame(true, start + 30ms);
+    EXPECT_EQ(pacer.NextDeadline(), start + 200ms);
+    pacer.OnFrame(true, start + 230ms);
+    EXPECT_EQ(pacer.NextDeadline(), start + 400ms);
+
+    // 한참 밀렸으면 지난 마감을 몰아서 찍지 않고 지금 한 번만
+    const Clock::time_point late = start + 2000ms;
+    pacer.OnFrame(true, late);
+    EXPECT_EQ(pacer.NextDeadline(), late);
+    EXPECT_EQ(pacer.GetStats().lateDeadlines, 1u);
+}
+
+TEST(CapturePacerTest, NeverFasterThanOcr) {
+    CapturePacer pacer(TestOptions());
+    const Clock::time_point start{};
+    pacer.Reset(start);
+
+    pacer.OnOcrCompleted(500ms);
+    pacer.OnFrame(true, start);
+    EXPECT_EQ(pacer.NextDeadline(), start + 500ms);
+    EXPECT_EQ(pacer.GetStats().lastDecision, PacingDecision::OcrLimited);
+    EXPECT_EQ(pacer.GetStats().ocrLimited, 1u);
+
+    // 지수 이동 평균: 500 + 0.3 * (1500 - 500) = 800
+    pacer.OnOcrCompleted(1500ms);
+    EXPECT_DOUBLE_EQ(pacer.GetStats().ocrEstimateMs, 800.0);
+    pacer.OnFrame(true, start + 500ms);
+    EXPECT_EQ(pacer.NextDeadline(), start + 1300ms);
+
+    // 백오프 간격이 OCR보다 길면 제한 없음
+    pacer.OnFrame(false, start + 1300ms);
+    EXPECT_EQ(pacer.NextDeadline(), start + 2900ms);
+    EXPECT_EQ(pacer.GetStats().lastDecision, PacingDecision::Backoff);
+}
+
+TEST(CapturePacerTest, FailuresAndBusyConsumerDelayWithoutChangingPace) {
+    CapturePacer pacer(TestOptions());
+    const Clock::time_point start{};
+    pacer.Reset(start);
+    pacer.OnFrame(true, start);
+
+    const Clock::time_point now = start + 200ms;
+    pacer.OnCaptureFailed(false, now);
+    EXPECT_EQ(pacer.NextDeadline(), now + 10ms);
+    EXPECT_EQ(pacer.GetStats().lastDecision, PacingDecision::Retry);
+    EXPECT_DOUBLE_EQ(pacer.GetStats().intervalMs, 200.0);
+
+    pacer.OnConsumerBusy(now + 10ms);
+    EXPECT_EQ(pacer.NextDeadline(), now + 210ms);
+    EXPECT_EQ(pacer.GetStats().consumerBusy, 1u);
+
+    // DXGI 시간 초과(화면 변화 없음)는 정지 프레임처럼 백오프
+    pacer.OnCaptureFailed(true, now + 210ms);
+    EXPECT_EQ(pacer.NextDeadline(), now + 610ms);
+    EXPECT_EQ(pacer.GetStats().staticFrames, 1u);
+
+    // 기준 간격을 줄이면 활성 간격도 기준 안으로
+    pacer.SetBaseInterval(100ms);
+    pacer.OnFrame(true, now + 610ms);
+    EXPECT_EQ(pacer.NextDeadline(), now + 710ms);
+}
@@ -0,0 +1,50 @@
+#include "core/ocr/char_boxes.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::ocr;
+
+TEST(CharBoxesTest, SplitsHorizontalLineAtMidpointsBetweenCharacters) {
+    // CTC 구간은 글자 중심 근처의 좁은 폭만 덮음
+    const std::vector<std::pair<float, float>> ranges = {
+        {0.10f, 0.15f}, {0.35f, 0.40f}, {0.60f, 0.65f}, {0.85f, 0.90f},
+    };
+    const auto boxes = CharBoxesFromRanges(cv::Rect(100, 50, 400, 40), ranges);
+    ASSERT_EQ(boxes.size(), 4u);
+    EXPECT_EQ(boxes[0], cv::Rect(100, 50, 100, 40));
+    EXPECT_EQ(boxes[1], cv::Rect(200, 50, 100, 40));
+    EXPECT_EQ(boxes[3], cv::Rect(400, 50, 100, 40));
+}
+
+TEST(CharBoxesTest, KeepsTrailingPaddingOutsideCharacters) {
+    // 검출 박스 오른쪽이 비어 있으면 마지막 글자도 평균 간격 절반까지만
+    const std::vector<std::pair<float, float>> ranges = {
+        {0.10f, 0.10f}, {0.20f, 0.20f}, {0.30f, 0.30f},
+    };
+    const auto boxes = CharBoxesFromRanges(cv::Rect(0, 0, 1000, 40), ranges);
+    ASSERT_EQ(boxes.size(), 3u);
+    EXPECT_EQ(boxes.front().x, 50);
+    EXPECT_EQ(boxes.back().x + boxes.back().width, 350);
+}
+
+TEST(CharBoxesTest, SplitsVerticalLineTopToBottom) {
+    const std::vector<std::pair<float, float>> ranges = {
+        {0.15f, 0.18f}, {0.48f, 0.52f}, {0.80f, 0.86f},
+    };
+    const auto boxes = CharBoxesFromRanges(cv::Rect(10, 0, 40, 300), ranges);
+    ASSERT_EQ(boxes.size(), 3u);
+    EXPECT_EQ(boxes[0].x, 10);
+    EXPECT_EQ(boxes[0].width, 40);
+    EXPECT_EQ(boxes[0].y, 0);
+    EXPECT_EQ(boxes[1].y, 100);
+    EXPECT_NEAR(boxes[2].y + boxes[2].height, 300, 2);
+}
+
+TEST(CharBoxesTest, HandlesDegenerateInput) {
+    EXPECT_TRUE(CharBoxesFromRanges(cv::Rect(0, 0, 100, 20), {}).empty());
+    EXPECT_TRUE(CharBoxesFromRanges(cv::Rect(), {{0.2f, 0.3f}}).empty());
+
+    // 글자 하나면 줄 전체
+    const auto single = CharBoxesFromRanges(cv::Rect(5, 5, 30, 20), {{0.4f, 0.5f}});
+    ASSERT_EQ(single.size(), 1u);
+    EXPECT_EQ(single[0], cv::Rect(5, 5, 30, 20));
+}
@@ -0,0 +1,171 @@
+// ToriYomi - 컴파일된 사전 (더블 어레이 트라이 + JMdict 파서) 단위 테스트
+
+#include "core/dictionary/compiled_dictionary.h"
+#include "core/dictionary/dictionary_builder.h"
+#include "core/dictionary/double_array_trie.h"
+#include "core/dictionary/jmdict_parser.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+
+using namespace toriyomi::dictionary;
+
+namespace {
+
+const char* kSampleJmdict = R"XML(<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE JMdict [
+<!ENTITY v1 "Ichidan verb">
+<!ENTITY vt "transitive verb">
+<!ENTITY n "noun (common) (futsuumeishi)">
+]>
+<JMdict>
+<!-- 주석 -->
+<entry>
+<ent_seq>1358280</ent_seq>
+<k_ele><keb>食べる</keb><ke_pri>ichi1</ke_pri></k_ele>
+<k_ele><keb>喰べる</keb></k_ele>
+<r_ele><reb>たべる</reb></r_ele>
+<sense><pos>&v1;</pos><pos>&vt;</pos><gloss>to eat</gloss><gloss xml:lang="ger">essen</gloss></sense>
+<sense><gloss>to live on (e.g. a salary)</gloss></sense>
+</entry>
+<entry>
+<ent_seq>1358300</ent_seq>
+<k_ele><keb>食</keb></k_ele>
+<r_ele><reb>しょく</reb></r_ele>
+<sense><pos>&n;</pos><gloss>food &amp; drink</gloss></sense>
+</entry>
+<entry>
+<ent_seq>1000000</ent_seq>
+<r_ele><reb>たべ</reb></r_ele>
+<sense><gloss xml:lang="ger">nur Deutsch</gloss></sense>
+</entry>
+</JMdict>
+)XML";
+
+std::filesystem::path TempPath(const char* name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+
+}  // namespace
+
+TEST(CompiledDictionaryTest, TrieMatchesStdMap) {
+    std::mt19937 rng(7);
+    std::map<std::string, std::uint32_t> expected;
+    const std::string alphabet[] = {"あ", "い", "食", "べ", "a", "b", "\xFF"};
+    while (expected.size() < 2000) {
+        std::string key;
+        const int length = 1 + static_cast<int>(rng() % 6);
+        for (int i = 0; i < length; ++i) {
+            key += alphabet[rng() % std::size(alphabet)];
+        }
+        expected.emplace(key, static_cast<std::uint32_t>(expected.size()));
+    }
+
+    DoubleArrayTrieBuilder builder;
+    ASSERT_TRUE(builder.Build({expected.begin(), expected.end()}));
+    const DoubleArrayTrieView trie(builder.Units().data(), builder.Units().size());
+
+    for (const auto& [key, value] : expected) {
+        std::uint32_t found = 0;
+        ASSERT_TRUE(trie.ExactMatch(key, found)) << key;
+        EXPECT_EQ(found, value);
+
+        TriePrefixMatch matches[8];
+        const std::size_t count = trie.CommonPrefixSearch(key + "zz", matches, 8);
+        ASSERT_GT(count, 0u);
+        EXPECT_EQ(matches[count - 1].length, key.size());
+        EXPECT_EQ(matches[count - 1].value, value);
+        for (std::size_t i = 0; i < count; ++i) {
+            EXPECT_TRUE(expected.count(key.substr(0, matches[i].length)));
+        }
+    }
+    std::uint32_t unused = 0;
+    EXPECT_FALSE(trie.ExactMatch("zz", unused));
+    EXPECT_FALSE(trie.ExactMatch("", unused));
+
+    // 정렬되지 않은 입력은 거부
+    EXPECT_FALSE(builder.Build({{"b", 0}, {"a", 1}}));
+}
+
+TEST(CompiledDictionaryTest, ParsesJmdictEntries) {
+    std::vector<DictionaryEntry> entries;
+    std::string error;
+    ASSERT_TRUE(ParseJmdict(kSampleJmdict, [&](DictionaryEntry&& entry) { entries.push_back(std::move(entry)); },
+                            {}, &error)) << error;
+    ASSERT_EQ(entries.size(), 3u);
+
+    const auto& taberu = entries[0];
+    EXPECT_EQ(taberu.sequence, 1358280u);
+    EXPECT_TRUE(taberu.common);
+    EXPECT_EQ(taberu.kanji, (std::vector<std::string>{"食べる", "喰べる"}));
+    EXPECT_EQ(taberu.readings, (std::vector<std::string>{"たべる"}));
+    ASSERT_EQ(taberu.senses.size(), 2u);
+    EXPECT_EQ(taberu.senses[0].partsOfSpeech, (std::vector<std::string>{"v1", "vt"}));
+    EXPECT_EQ(taberu.senses[0].glosses, (std::vector<std::string>{"to eat"}));
+    // <pos>가 없는 sense는 앞 sense 품사를 이어받음
+    EXPECT_EQ(taberu.senses[1].partsOfSpeech, taberu.senses[0].partsOfSpeech);
+
+    EXPECT_EQ(entries[1].senses[0].glosses.front(), "food & drink");
+    EXPECT_TRUE(entries[2].senses.empty());  // 영어 뜻풀이 없음
+
+    EXPECT_FALSE(ParseJmdict(std::string_view("<JMdict><entry><keb>x</keb>"), [](DictionaryEntry&&) {}));
+}
+
+TEST(CompiledDictionaryTest, CompilesAndMapsDictionary) {
+    DictionaryBuilder builder;
+    ASSERT_TRUE(ParseJmdict(kSampleJmdict, [&](DictionaryEntry&& entry) { builder.AddEntry(std::move(entry)); }));
+    const auto path = TempPath("toriyomi_test_dictionary.tydict");
+    std::string error;
+    ASSERT_TRUE(builder.WriteToFile(path, &error)) << error;
+
+    CompiledDictionary dictionary;
+    ASSERT_TRUE(dictionary.Open(path));
+    EXPECT_EQ(dictionary.EntryCount(), 3u);
+    EXPECT_EQ(dictionary.KeyCount(), 6u);
+
+    // 한자 표기와 읽기 모두로 조회
+    for (const char* key : {"食べる", "喰べる", "たべる"}) {
+        const auto ids = dictionary.Lookup(key);
+        ASSERT_EQ(ids.size(), 1u) << key;
+        const auto entry = dictionary.Entry(ids[0]);
+        EXPECT_EQ(entry.headword, "食べる");
+        EXPECT_EQ(entry.reading, "たべる");
+        EXPECT_TRUE(entry.common);
+        ASSERT_EQ(entry.senseCount, 2u);
+        EXPECT_EQ(dictionary.Sense(entry.id, 0).partOfSpeech, "v1,vt");
+        EXPECT_EQ(dictionary.Sense(entry.id, 1).glosses, "to live on (e.g. a salary)");
+        EXPECT_TRUE(dictionary.Sense(entry.id, 2).glosses.empty());
+    }
+    EXPECT_TRUE(dictionary.Lookup("食べ").empty());
+    EXPECT_TRUE(dictionary.Entry(100).headword.empty());
+
+    // 食べるもの → 食 / 食べる
+    DictionaryPrefixMatch matches[4];
+    const std::size_t count = dictionary.LookupPrefixes("食べるもの", matches, 4);
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(matches[0].length, std::string("食").size());
+    EXPECT_EQ(dictionary.Entry(matches[0].entries[0]).reading, "しょく");
+    EXPECT_EQ(matches[1].length, std::string("食べる").size());
+
+    dictionary.Close();
+    EXPECT_FALSE(dictionary.IsOpen());
+    EXPECT_TRUE(dictionary.Lookup("食べる").empty());
+    std::filesystem::remove(path);
+}
+
+TEST(CompiledDictionaryTest, RejectsInvalidFiles) {
+    CompiledDictionary dictionary;
+    EXPECT_FALSE(dictionary.Open(TempPath("toriyomi_missing_dictionary.tydict")));
+
+    const auto path = TempPath("toriyomi_invalid_dictionary.tydict");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(256, 'x');
+    }
+    EXPECT_FALSE(dictionary.Open(path));
+    EXPECT_FALSE(dictionary.IsOpen());
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,164 @@
+// ToriYomi - 활용형 역변환 단위 테스트
+
+#include "core/dictionary/compiled_dictionary.h"
+#include "core/dictionary/deinflector.h"
+#include "core/dictionary/dictionary_builder.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+using namespace toriyomi::dictionary;
+
+namespace {
+
+bool HasCandidate(const std::vector<Deinflection>& candidates, const std::string& term, std::uint32_t conditions) {
+    return std::any_of(candidates.begin(), candidates.end(), [&](const Deinflection& candidate) {
+        return candidate.term == term && (candidate.conditions & conditions) != 0;
+    });
+}
+
+DictionaryEntry MakeEntry(std::uint32_t sequence, const char* kanji, const char* reading, const char* pos) {
+    DictionaryEntry entry;
+    entry.sequence = sequence;
+    if (*kanji) {
+        entry.kanji.push_back(kanji);
+    }
+    entry.readings.push_back(reading);
+    entry.senses.push_back({{pos}, {"gloss"}});
+    return entry;
+}
+
+class DeinflectorDictionaryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        DictionaryBuilder builder;
+        builder.AddEntry(MakeEntry(1, "食べる", "たべる", "v1"));
+        builder.AddEntry(MakeEntry(2, "書く", "かく", "v5k"));
+        builder.AddEntry(MakeEntry(3, "高い", "たかい", "adj-i"));
+        builder.AddEntry(MakeEntry(4, "勉強", "べんきょう", "n"));
+        builder.AddEntry(MakeEntry(5, "", "する", "vs-i"));
+        builder.AddEntry(MakeEntry(6, "", "た", "aux"));      // 품사가 활용 규칙과 맞지 않는 단어
+        builder.AddEntry(MakeEntry(7, "本", "ほん", "n"));
+        path_ = std::filesystem::temp_directory_path() / "toriyomi_test_deinflector.tydict";
+        std::string error;
+        ASSERT_TRUE(builder.WriteToFile(path_, &error)) << error;
+        ASSERT_TRUE(dictionary_.Open(path_));
+    }
+
+    void TearDown() override {
+        dictionary_.Close();
+        std::filesystem::remove(path_);
+    }
+
+    std::filesystem::path path_;
+    CompiledDictionary dictionary_;
+    Deinflector deinflector_;
+};
+
+}  // namespace
+
+TEST(DeinflectorTest, FollowsRuleChains) {
+    const Deinflector deinflector;
+    const auto candidates = deinflector.Deinflect("食べちゃった");
+    ASSERT_FALSE(candidates.empty());
+    EXPECT_EQ(candidates.front().term, "食べちゃった");
+    EXPECT_EQ(candidates.front().conditions, kConditionNone);
+
+    // 食べちゃった → 食べちゃう → 食べて → 食べる
+    const auto it = std::find_if(candidates.begin(), candidates.end(), [](const Deinflection& candidate) {
+        return candidate.term == "食べる" && (candidate.conditions & kConditionV1);
+    });
+    ASSERT_NE(it, candidates.end());
+    ASSERT_EQ(it->rules.size(), 3u);
+    EXPECT_EQ(deinflector.RuleName(it->rules[0]), "past");
+    EXPECT_EQ(deinflector.RuleName(it->rules[1]), "chau");
+    EXPECT_EQ(deinflector.RuleName(it->rules[2]), "te");
+
+    EXPECT_TRUE(HasCandidate(deinflector.Deinflect("書いてる"), "書く", kConditionV5));
+    EXPECT_TRUE(HasCandidate(deinflector.Deinflect("高かった"), "高い", kConditionAdjI));
+    EXPECT_TRUE(HasCandidate(deinflector.Deinflect("勉強しました"), "勉強する", kConditionVs));
+    EXPECT_TRUE(HasCandidate(deinflector.Deinflect("来なかった"), "来る", kConditionVk));
+    EXPECT_TRUE(HasCandidate(deinflector.Deinflect("行った"), "行く", kConditionV5));
+    EXPECT_TRUE(HasCandidate(deinflector.Deinflect("読まなきゃ"), "読む", kConditionV5));
+}
+
+TEST(DeinflectorTest, RespectsRuleConditions) {
+    const Deinflector deinflector;
+    // conditionsIn이 0인 규칙(～ず)은 원래 입력에만 적용되고 다른 규칙의 결과에는 붙지 않음
+    const Deinflector custom({{"ず", "る", kConditionNone, kConditionV1, "zu"},
+                              {"た", "ず", kConditionTa, kConditionTe, "test"}});
+    EXPECT_FALSE(HasCandidate(custom.Deinflect("食べた"), "食べる", kConditionV1));
+    EXPECT_TRUE(HasCandidate(custom.Deinflect("食べず"), "食べる", kConditionV1));
+
+    EXPECT_TRUE(deinflector.HasRuleSuffix("食べた"));
+    EXPECT_FALSE(deinflector.HasRuleSuffix("本"));
+
+    EXPECT_EQ(Deinflector::ConditionsFromPartOfSpeech("v5k,vt"), kConditionV5);
+    EXPECT_EQ(Deinflector::ConditionsFromPartOfSpeech("v1-s"), kConditionV1);
+    EXPECT_EQ(Deinflector::ConditionsFromPartOfSpeech("adj-i,n"), kConditionAdjI);
+    EXPECT_EQ(Deinflector::ConditionsFromPartOfSpeech("n,vs"), kConditionVs);
+    EXPECT_EQ(Deinflector::ConditionsFromPartOfSpeech("n"), kConditionNone);
+}
+
+TEST(DeinflectorTest, CapsCandidatesEvenWhenOneTermMatchesManyRules) {
+    // 한 입력에 맞는 규칙이 상한보다 많아도 후보 수는 상한을 넘지 않음
+    std::vector<DeinflectionRule> rules;
+    for (int i = 0; i < 300; ++i) {
+        rules.push_back({"た", "x" + std::to_string(i), kConditionNone, kConditionV1, "many"});
+    }
+    const Deinflector custom(std::move(rules));
+    const auto candidates = custom.Deinflect("食べた");
+    EXPECT_EQ(candidates.size(), 256u);
+    EXPECT_EQ(candidates.front().term, "食べた");
+}
+
+TEST_F(DeinflectorDictionaryTest, ValidatesAgainstDictionary) {
+    auto match = deinflector_.FindLongestMatch(dictionary_, "食べちゃったよ");
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->length, std::string("食べちゃった").size());
+    EXPECT_EQ(dictionary_.Entry(match->entryId).headword, "食べる");
+    EXPECT_EQ(match->deinflection.rules.size(), 3u);
+
+    // 활용하지 않은 단어는 규칙 없이 일치
+    match = deinflector_.FindLongestMatch(dictionary_, "本を");
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->length, std::string("本").size());
+    EXPECT_TRUE(match->deinflection.rules.empty());
+
+    // 書いた → 書く (v5k)
+    match = deinflector_.FindLongestMatch(dictionary_, "書いた");
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(dictionary_.Entry(match->entryId).headword, "書く");
+
+    // たら → た(た형)는 품사가 맞지 않아 버리고, 활용하지 않은 た만 일치
+    EXPECT_TRUE(HasCandidate(deinflector_.Deinflect("たら"), "た", kConditionTa));
+    match = deinflector_.FindLongestMatch(dictionary_, "たら");
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->length, std::string("た").size());
+    EXPECT_TRUE(match->deinflection.rules.empty());
+
+    EXPECT_FALSE(deinflector_.FindLongestMatch(dictionary_, "らりるれ").has_value());
+}
+
+TEST_F(DeinflectorDictionaryTest, ScansSentenceWithLongestMatch) {
+    const std::string sentence = "本を書いてる。高かったけど食べちゃった";
+    const auto matches = deinflector_.ScanSentence(dictionary_, sentence);
+    std::vector<std::string> headwords;
+    std::vector<std::string> surfaces;
+    for (const auto& match : matches) {
+        headwords.push_back(std::string(dictionary_.Entry(match.entryId).headword));
+        surfaces.push_back(sentence.substr(match.offset, match.length));
+    }
+    EXPECT_EQ(headwords, (std::vector<std::string>{"本", "書く", "高い", "食べる"}));
+    EXPECT_EQ(surfaces, (std::vector<std::string>{"本", "書いてる", "高かった", "食べちゃった"}));
+
+    // 한 문장 스캔은 1ms보다 충분히 빨라야 함
+    const auto start = std::chrono::steady_clock::now();
+    constexpr int kIterations = 100;
+    for (int i = 0; i < kIterations; ++i) {
+        ASSERT_EQ(deinflector_.ScanSentence(dictionary_, sentence).size(), 4u);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / kIterations, 1000);
+}
@@ -0,0 +1,75 @@
+// ToriYomi - 확정 문장 발행 순서 관리 단위 테스트
+
+#include "core/pipeline/final_sentence_sequencer.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::pipeline;
+
+using Tickets = std::vector<std::uint64_t>;
+
+TEST(FinalSentenceSequencerTest, ReleasesFinalsInRequestOrder) {
+    FinalSentenceSequencer sequencer;
+    sequencer.BeginSession();
+    const auto first = sequencer.Reserve(1);
+    const auto second = sequencer.Reserve(2);
+    const auto third = sequencer.Reserve(3);
+
+    // 뒤 문장이 먼저 끝나도 앞 문장을 기다림
+    EXPECT_TRUE(sequencer.Complete(third).empty());
+    EXPECT_TRUE(sequencer.Complete(second).empty());
+    EXPECT_EQ(sequencer.GetLastFinalSentenceId(), 0u);
+
+    EXPECT_EQ(sequencer.Complete(first), (Tickets{first, second, third}));
+    EXPECT_EQ(sequencer.GetLastFinalSentenceId(), 3u);
+    EXPECT_EQ(sequencer.GetPendingCount(), 0u);
+
+    // 모르는 순번은 무시
+    EXPECT_TRUE(sequencer.Complete(first).empty());
+}
+
+TEST(FinalSentenceSequencerTest, CancelledFinalDoesNotBlockLaterOnes) {
+    FinalSentenceSequencer sequencer;
+    sequencer.BeginSession();
+    const auto first = sequencer.Reserve(1);
+    const auto second = sequencer.Reserve(2);
+
+    EXPECT_TRUE(sequencer.Complete(second).empty());
+    EXPECT_EQ(sequencer.Complete(first, true), (Tickets{second}));
+    EXPECT_EQ(sequencer.GetLastFinalSentenceId(), 2u);
+}
+
+TEST(FinalSentenceSequencerTest, PartialStalenessFollowsLastFinal) {
+    FinalSentenceSequencer sequencer;
+    const auto session = sequencer.BeginSession();
+    EXPECT_FALSE(sequencer.IsPartialStale(session, 1, false));
+
+    sequencer.Complete(sequencer.Reserve(2));
+    EXPECT_TRUE(sequencer.IsPartialStale(session, 1, false));
+    EXPECT_TRUE(sequencer.IsPartialStale(session, 2, false));
+    EXPECT_FALSE(sequencer.IsPartialStale(session, 2, true));     // 확정 뒤 고쳐 쓰는 중
+    EXPECT_FALSE(sequencer.IsPartialStale(session, 3, false));
+}
+
+TEST(FinalSentenceSequencerTest, RestartResetsSentenceIds) {
+    FinalSentenceSequencer sequencer;
+    const auto oldSession = sequencer.BeginSession();
+    sequencer.Complete(sequencer.Reserve(57));
+    const auto inFlight = sequencer.Reserve(58);
+
+    // 재시작하면 문장 ID가 1부터 다시 시작하므로 새 세션의 부분 문장을 버리지 않음
+    const auto newSession = sequencer.BeginSession();
+    EXPECT_NE(newSession, oldSession);
+    EXPECT_EQ(sequencer.GetLastFinalSentenceId(), 0u);
+    EXPECT_FALSE(sequencer.IsPartialStale(newSession, 1, false));
+    EXPECT_TRUE(sequencer.IsPartialStale(oldSession, 59, false));
+
+    // 이전 세션의 확정 문장은 발행하되 새 세션의 기준은 그대로
+    const auto restarted = sequencer.Reserve(1);
+    EXPECT_EQ(sequencer.Complete(inFlight), (Tickets{inFlight}));
+    EXPECT_EQ(sequencer.GetLastFinalSentenceId(), 0u);
+    EXPECT_FALSE(sequencer.IsPartialStale(newSession, 1, false));
+
+    EXPECT_EQ(sequencer.Complete(restarted), (Tickets{restarted}));
+    EXPECT_EQ(sequencer.GetLastFinalSentenceId(), 1u);
+    EXPECT_TRUE(sequencer.IsPartialStale(newSession, 1, false));
+}
@@ -0,0 +1,97 @@
+// ToriYomi - 잡음에 둔감한 ROI 변화 감지 단위 테스트
+
+#include "core/capture/frame_change_detector.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::capture;
+
+namespace {
+
+// 회색 바탕 대사창 (BGRA)
+cv::Mat MakeFrame() {
+    return cv::Mat(100, 400, CV_8UC4, cv::Scalar(128, 128, 128, 255));
+}
+
+void FillRect(cv::Mat& image, int left, int top, int width, int height, unsigned char value) {
+    for (int y = top; y < top + height; ++y) {
+        unsigned char* row = image.ptr<unsigned char>(y);
+        for (int x = left; x < left + width; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                row[x * 4 + c] = value;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(FrameChangeDetectorTest, FirstFrameAndResizeCountAsChange) {
+    FrameChangeDetector detector;
+    EXPECT_TRUE(detector.Update(MakeFrame()));
+    EXPECT_FALSE(detector.Update(MakeFrame()));
+    EXPECT_DOUBLE_EQ(detector.GetLastDifference(), 0.0);
+
+    // ROI 크기가 바뀌면 비교하지 않고 바뀐 것으로 봄
+    EXPECT_TRUE(detector.Update(cv::Mat(120, 400, CV_8UC4, cv::Scalar(128, 128, 128, 255))));
+
+    detector.Reset();
+    EXPECT_TRUE(detector.Update(MakeFrame()));
+}
+
+TEST(FrameChangeDetectorTest, IgnoresPixelNoise) {
+    FrameChangeDetector detector;
+    detector.Update(MakeFrame());
+
+    // 압축/디더링처럼 화면 전체에 퍼진 작은 흔들림
+    cv::Mat noisy = MakeFrame();
+    for (int y = 0; y < noisy.rows; ++y) {
+        unsigned char* row = noisy.ptr<unsigned char>(y);
+        for (int x = 0; x < noisy.cols; ++x) {
+            const unsigned char value = ((x + y) % 3 == 0) ? 131 : 126;
+            for (int c = 0; c < 3; ++c) {
+                row[x * 4 + c] = value;
+            }
+        }
+    }
+    EXPECT_FALSE(detector.Update(noisy));
+
+    // 점 하나가 바뀐 정도도 변화로 보지 않음
+    cv::Mat speck = MakeFrame();
+    FillRect(speck, 200, 50, 1, 1, 255);
+    EXPECT_FALSE(detector.Update(speck));
+}
+
+TEST(FrameChangeDetectorTest, DetectsNewGlyphAndSlowFades) {
+    FrameChangeDetector detector;
+    cv::Mat frame = MakeFrame();
+    detector.Update(frame);
+
+    // 새 글자 하나
+    cv::Mat glyph = MakeFrame();
+    FillRect(glyph, 20, 40, 20, 20, 0);
+    EXPECT_TRUE(detector.Update(glyph));
+    EXPECT_GT(detector.GetLastDifference(), detector.GetOptions().threshold);
+    EXPECT_FALSE(detector.Update(glyph.clone()));
+
+    // 한 번에는 잡음 수준이어도 기준 프레임을 유지하므로 누적되면 변화로 잡힘
+    FrameChangeDetector fade;
+    fade.Update(MakeFrame());
+    bool detected = false;
+    for (unsigned char value = 129; value <= 140 && !detected; ++value) {
+        cv::Mat step = MakeFrame();
+        FillRect(step, 0, 0, step.cols, step.rows, value);
+        detected = fade.Update(step);
+    }
+    EXPECT_TRUE(detected);
+}
+
+TEST(FrameChangeDetectorTest, ThresholdIsConfigurable) {
+    FrameChangeOptions options;
+    options.threshold = 50.0;
+    FrameChangeDetector detector(options);
+    detector.Update(MakeFrame());
+
+    cv::Mat glyph = MakeFrame();
+    FillRect(glyph, 20, 40, 20, 20, 0);
+    EXPECT_FALSE(detector.Update(glyph));
+}
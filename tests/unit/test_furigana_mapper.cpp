@@ -181,3 +181,44 @@ TEST_F(FuriganaMapperTest, EdgeCases) {
     EXPECT_EQ(info.reading, "");
     EXPECT_FALSE(info.needsRuby);
 }
+
+// 테스트 12: 오쿠리가나를 제외한 한자 구간 루비
+TEST_F(FuriganaMapperTest, RubySpansExcludeOkurigana) {
+    Token token;
+    token.surface = "取り扱い";
+    token.reading = "トリアツカイ";
+    token.boundingBox = cv::Rect(100, 50, 160, 40);  // 글자당 40px
+
+    auto info = mapper_->MapTokenToFurigana(token);
+
+    EXPECT_EQ(info.reading, "とりあつかい");  // 전체 읽기는 그대로 유지
+    ASSERT_EQ(info.rubySpans.size(), 2);
+    EXPECT_EQ(info.rubySpans[0].baseText, "取");
+    EXPECT_EQ(info.rubySpans[0].reading, "と");
+    EXPECT_EQ(info.rubySpans[0].position, cv::Rect(100, 50, 40, 40));
+    EXPECT_EQ(info.rubySpans[1].baseText, "扱");
+    EXPECT_EQ(info.rubySpans[1].reading, "あつか");
+    EXPECT_EQ(info.rubySpans[1].position, cv::Rect(180, 50, 40, 40));
+    EXPECT_EQ(info.rubySpans[1].rubyPosition.x, 180);
+    EXPECT_EQ(info.rubySpans[1].rubyPosition.y, 45);
+    EXPECT_EQ(info.rubyPosition.x, 100);
+}
+
+// 테스트 13: 읽기 표로 한자 구간을 글자 단위로 분할
+TEST_F(FuriganaMapperTest, KanjiReadingTableSplitsRuns) {
+    auto table = std::make_shared<KanjiReadingTable>();
+    table->Add(U'漢', "かん");
+    table->Add(U'字', "じ");
+    mapper_->SetKanjiReadingTable(table);
+
+    Token token;
+    token.surface = "漢字";
+    token.reading = "カンジ";
+    token.boundingBox = cv::Rect(0, 100, 80, 40);
+
+    auto info = mapper_->MapTokenToFurigana(token);
+    ASSERT_EQ(info.rubySpans.size(), 2);
+    EXPECT_EQ(info.rubySpans[0].reading, "かん");
+    EXPECT_EQ(info.rubySpans[1].reading, "じ");
+    EXPECT_EQ(info.rubySpans[1].position.x, 40);
+}
@@ -0,0 +1,192 @@
+// ToriYomi - 글리프 캐시 OCR 데코레이터 단위 테스트
+
+#include "core/ocr/glyph_cache_ocr_engine.h"
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+#include <memory>
+#include <string>
+
+using namespace toriyomi::ocr;
+
+namespace {
+
+constexpr int kGlyphSize = 28;
+constexpr int kPitch = 40;
+constexpr int kOriginX = 10;
+constexpr int kOriginY = 16;
+
+// 글자 대신 서로 확실히 다른 도형을 그려 고정 폰트를 흉내냄
+// 모든 도형이 'A'의 세로 범위 안에 들어가도록 하여 라인 높이를 일정하게 유지
+void DrawGlyph(cv::Mat& image, char glyph, int x, int y) {
+    const cv::Scalar ink(0, 0, 0);
+    const int last = kGlyphSize - 1;
+    switch (glyph) {
+        case 'A':
+            cv::rectangle(image, cv::Rect(x + 1, y + 1, kGlyphSize - 2, kGlyphSize - 2), ink, 3);
+            break;
+        case 'B':
+            cv::circle(image, cv::Point(x + kGlyphSize / 2, y + kGlyphSize / 2), kGlyphSize / 2 - 2, ink, cv::FILLED);
+            break;
+        case 'C':
+            cv::line(image, cv::Point(x + 2, y + 2), cv::Point(x + last - 2, y + last - 2), ink, 3);
+            cv::line(image, cv::Point(x + last - 2, y + 2), cv::Point(x + 2, y + last - 2), ink, 3);
+            break;
+        default:
+            cv::rectangle(image, cv::Rect(x, y + kGlyphSize / 2 - 3, kGlyphSize, 6), ink, cv::FILLED);
+            break;
+    }
+}
+
+cv::Mat RenderLine(const std::string& glyphs) {
+    cv::Mat image(60, kOriginX * 2 + static_cast<int>(glyphs.size()) * kPitch, CV_8UC3, cv::Scalar(255, 255, 255));
+    for (std::size_t i = 0; i < glyphs.size(); ++i) {
+        DrawGlyph(image, glyphs[i], kOriginX + static_cast<int>(i) * kPitch, kOriginY);
+    }
+    return image;
+}
+
+class ScriptedOcrEngine : public IOcrEngine {
+public:
+    std::string nextText;
+    float nextConfidence = 99.0f;
+    int recognizeCallCount = 0;
+    int regionChangedCount = 0;
+
+    bool Initialize(const std::string&, const std::string&) override { return true; }
+
+    std::vector<TextSegment> RecognizeText(const cv::Mat& image) override {
+        ++recognizeCallCount;
+        TextSegment segment;
+        segment.text = nextText;
+        segment.boundingBox = cv::Rect(4, 8, image.cols - 8, image.rows - 16);
+        segment.confidence = nextConfidence;
+        return {segment};
+    }
+
+    void Shutdown() override {}
+    bool IsInitialized() const override { return true; }
+    std::string GetEngineName() const override { return "Scripted"; }
+    void OnRegionChanged() override { ++regionChangedCount; }
+};
+
+GlyphCacheConfig TestConfig() {
+    GlyphCacheConfig config;
+    config.enabled = true;
+    config.minTemplates = 3;
+    return config;
+}
+
+}  // namespace
+
+class GlyphCacheOcrEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        inner_ = std::make_shared<ScriptedOcrEngine>();
+    }
+
+    std::shared_ptr<ScriptedOcrEngine> inner_;
+};
+
+TEST_F(GlyphCacheOcrEngineTest, LearnsFromConfidentResultsThenSkipsInnerEngine) {
+    GlyphCacheOcrEngine engine(inner_, TestConfig());
+
+    inner_->nextText = "ABC";
+    auto first = engine.RecognizeText(RenderLine("ABC"));
+    ASSERT_EQ(first.size(), 1u);
+    EXPECT_EQ(inner_->recognizeCallCount, 1);
+    EXPECT_EQ(engine.GetStats().templateCount, 3u);
+
+    auto second = engine.RecognizeText(RenderLine("CAB"));
+    EXPECT_EQ(inner_->recognizeCallCount, 1);
+    ASSERT_EQ(second.size(), 1u);
+    EXPECT_EQ(second[0].text, "CAB");
+    EXPECT_GT(second[0].confidence, 90.0f);
+    EXPECT_EQ(engine.GetStats().cacheHits, 1u);
+
+    // 줄 상자는 모든 글자 상자를 감쌈
+    ASSERT_EQ(second[0].charBoxes.size(), 3u);
+    for (const auto& box : second[0].charBoxes) {
+        EXPECT_EQ((second[0].boundingBox & box), box);
+    }
+}
+
+TEST_F(GlyphCacheOcrEngineTest, FallsBackWhenAnyCellIsUnknown) {
+    GlyphCacheOcrEngine engine(inner_, TestConfig());
+    inner_->nextText = "ABC";
+    engine.RecognizeText(RenderLine("ABC"));
+
+    inner_->nextText = "ABD";
+    auto result = engine.RecognizeText(RenderLine("ABD"));
+    EXPECT_EQ(inner_->recognizeCallCount, 2);
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].text, "ABD");
+    EXPECT_EQ(engine.GetStats().templateCount, 4u);
+}
+
+TEST_F(GlyphCacheOcrEngineTest, IgnoresLowConfidenceResults) {
+    GlyphCacheOcrEngine engine(inner_, TestConfig());
+    inner_->nextText = "ABC";
+    inner_->nextConfidence = 50.0f;
+
+    engine.RecognizeText(RenderLine("ABC"));
+    EXPECT_EQ(engine.GetStats().templateCount, 0u);
+}
+
+TEST_F(GlyphCacheOcrEngineTest, SkipsLinesWhoseCellCountDoesNotMatchText) {
+    GlyphCacheOcrEngine engine(inner_, TestConfig());
+    inner_->nextText = "AB";
+
+    engine.RecognizeText(RenderLine("ABC"));
+    const auto stats = engine.GetStats();
+    EXPECT_EQ(stats.templateCount, 0u);
+    EXPECT_EQ(stats.skippedLines, 1u);
+}
+
+TEST_F(GlyphCacheOcrEngineTest, BacksOffAfterRepeatedMisses) {
+    auto config = TestConfig();
+    config.missesBeforeBackoff = 1;
+    config.backoffFrames = 2;
+    GlyphCacheOcrEngine engine(inner_, config);
+
+    inner_->nextText = "ABC";
+    engine.RecognizeText(RenderLine("ABC"));
+
+    inner_->nextConfidence = 10.0f;    // 미지 글리프가 학습되지 않도록
+    engine.RecognizeText(RenderLine("ABD"));
+    EXPECT_EQ(inner_->recognizeCallCount, 2);
+
+    engine.RecognizeText(RenderLine("ABC"));
+    engine.RecognizeText(RenderLine("ABC"));
+    EXPECT_EQ(inner_->recognizeCallCount, 4);
+
+    engine.RecognizeText(RenderLine("ABC"));
+    EXPECT_EQ(inner_->recognizeCallCount, 4);
+}
+
+TEST_F(GlyphCacheOcrEngineTest, ForwardsLifecycleToInnerEngine) {
+    GlyphCacheOcrEngine engine(inner_, TestConfig());
+    EXPECT_TRUE(engine.IsInitialized());
+    EXPECT_EQ(engine.GetEngineName(), "Scripted");
+
+    engine.OnRegionChanged();
+    EXPECT_EQ(inner_->regionChangedCount, 1);
+}
+
+TEST(GlyphTemplateStoreTest, RejectsAmbiguousMatchesThroughRunnerUp) {
+    GlyphBitmap a;
+    a.words[0] = 0xFFFF;
+    a.inkCount = 16;
+    GlyphBitmap b = a;
+    b.words[0] = 0xFFFE;    // a와 1비트 차이
+    b.inkCount = 15;
+
+    GlyphTemplateStore store;
+    EXPECT_TRUE(store.Add(a, "ぱ", 0));
+    EXPECT_TRUE(store.Add(b, "ば", 0));
+    EXPECT_FALSE(store.Add(a, "ぱ", 0));
+
+    const GlyphMatch match = store.Match(a, 8);
+    EXPECT_EQ(match.text, "ぱ");
+    EXPECT_EQ(match.distance, 0);
+    EXPECT_EQ(match.runnerUpDistance, 1);
+}
@@ -2,8 +2,12 @@
 // JapaneseTokenizer 클래스 테스트
 
 #include "core/tokenizer/japanese_tokenizer.h"
+#include "common/concurrency/thread_pool.h"
+#include "common/text/unicode_utils.h"
 #include <gtest/gtest.h>
 #include <opencv2/opencv.hpp>
+#include <atomic>
+#include <thread>
 
 using namespace toriyomi::tokenizer;
 using namespace toriyomi::ocr;
@@ -140,6 +144,70 @@ TEST_F(JapaneseTokenizerTest, TokenizeWithPosition) {
     }
 }
 
+namespace {
+
+size_t CountChars(const std::string& text) {
+    size_t count = 0;
+    for (size_t pos = 0; pos < text.size(); ++count) {
+        toriyomi::text::DecodeUtf8(text, pos);
+    }
+    return count;
+}
+
+}  // namespace
+
+// 테스트 8-1: 글자별 영역이 있으면 토큰 영역은 해당 글자 영역의 합집합
+TEST_F(JapaneseTokenizerTest, TokenizeWithPositionUsesCharBoxes) {
+    ASSERT_TRUE(tokenizer_->Initialize());
+
+    TextSegment segment;
+    segment.text = "今日は晴れ";
+    segment.boundingBox = cv::Rect(100, 50, 260, 30);
+    segment.confidence = 90.0f;
+    // 글자 폭이 일정하지 않은 경우 (비례 분할과 결과가 달라야 함)
+    segment.charBoxes = {
+        cv::Rect(100, 50, 40, 30), cv::Rect(140, 50, 40, 30), cv::Rect(180, 50, 20, 30),
+        cv::Rect(200, 50, 100, 30), cv::Rect(300, 50, 60, 30),
+    };
+
+    const auto tokens = tokenizer_->TokenizeWithPosition(segment);
+    ASSERT_GT(tokens.size(), 0u);
+
+    size_t charPos = 0;
+    for (const auto& token : tokens) {
+        const size_t chars = CountChars(token.surface);
+        ASSERT_LE(charPos + chars, segment.charBoxes.size());
+        cv::Rect expected = segment.charBoxes[charPos];
+        for (size_t i = charPos + 1; i < charPos + chars; ++i) {
+            expected |= segment.charBoxes[i];
+        }
+        EXPECT_EQ(token.boundingBox, expected) << token.surface;
+        charPos += chars;
+    }
+    EXPECT_EQ(charPos, segment.charBoxes.size());
+}
+
+// 테스트 8-2: 글자별 영역이 없으면 바이트가 아닌 글자 수 비례로 분할
+TEST_F(JapaneseTokenizerTest, TokenizeWithPositionSplitsByCharacters) {
+    ASSERT_TRUE(tokenizer_->Initialize());
+
+    TextSegment segment;
+    segment.text = "ABC今日";
+    segment.boundingBox = cv::Rect(100, 50, 500, 30);
+    segment.confidence = 90.0f;
+
+    const auto tokens = tokenizer_->TokenizeWithPosition(segment);
+    ASSERT_GT(tokens.size(), 0u);
+
+    int expectedX = 100;
+    for (const auto& token : tokens) {
+        EXPECT_EQ(token.boundingBox.x, expectedX) << token.surface;
+        EXPECT_EQ(token.boundingBox.width, static_cast<int>(CountChars(token.surface)) * 100) << token.surface;
+        expectedX += token.boundingBox.width;
+    }
+    EXPECT_EQ(expectedX, 600);
+}
+
 // 테스트 9: 여러 OCR 결과 일괄 처리
 TEST_F(JapaneseTokenizerTest, TokenizeBatch) {
     ASSERT_TRUE(tokenizer_->Initialize());
@@ -161,6 +229,18 @@ TEST_F(JapaneseTokenizerTest, TokenizeBatch) {
     auto allTokens = tokenizer_->TokenizeBatch(segments);
     
     EXPECT_GT(allTokens.size(), 0);
+
+    // 세그먼트 순서와 경계 유지
+    std::string joined[2];
+    std::size_t lastIndex = 0;
+    for (const auto& token : allTokens) {
+        ASSERT_LT(token.segmentIndex, 2u);
+        EXPECT_GE(token.segmentIndex, lastIndex);
+        lastIndex = token.segmentIndex;
+        joined[token.segmentIndex] += token.surface;
+    }
+    EXPECT_EQ(joined[0], "今日");
+    EXPECT_EQ(joined[1], "明日");
     
     std::cout << "Batch tokenization: " << allTokens.size() << " tokens" << std::endl;
     for (const auto& token : allTokens) {
@@ -199,3 +279,87 @@ TEST_F(JapaneseTokenizerTest, Reinitialize) {
     auto tokens = tokenizer_->Tokenize("テスト");
     EXPECT_GT(tokens.size(), 0);
 }
+
+// 테스트 12: 여러 스레드에서 동시에 분석 (전역 락 없이 같은 결과)
+TEST_F(JapaneseTokenizerTest, ConcurrentTokenizeMatchesSequential) {
+    ASSERT_TRUE(tokenizer_->Initialize());
+
+    const std::vector<std::string> texts = {
+        "今日は良い天気です",
+        "ラーメンを食べに行きましょう",
+        "彼は東京大学の学生です",
+        "こんにちは",
+    };
+    std::vector<std::vector<std::string>> expected;
+    for (const auto& text : texts) {
+        std::vector<std::string> surfaces;
+        for (const auto& token : tokenizer_->Tokenize(text)) {
+            surfaces.push_back(token.surface);
+        }
+        expected.push_back(std::move(surfaces));
+    }
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&, t]() {
+            for (int i = 0; i < 200; ++i) {
+                const size_t index = static_cast<size_t>(t + i) % texts.size();
+                const auto tokens = tokenizer_->Tokenize(texts[index]);
+                if (tokens.size() != expected[index].size()) {
+                    ++mismatches;
+                    continue;
+                }
+                for (size_t k = 0; k < tokens.size(); ++k) {
+                    if (tokens[k].surface != expected[index][k]) {
+                        ++mismatches;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+// 테스트 13: 병렬 일괄 처리 결과가 세그먼트별 순차 처리와 같음
+TEST_F(JapaneseTokenizerTest, ParallelBatchMatchesSequential) {
+    ASSERT_TRUE(tokenizer_->Initialize());
+
+    const std::vector<std::string> texts = {
+        "今日は良い天気です",
+        "ラーメンを食べに行きましょう",
+        "",
+        "彼は東京大学の学生です",
+        "こんにちは",
+    };
+    std::vector<TextSegment> segments;
+    for (int i = 0; i < 40; ++i) {
+        TextSegment segment;
+        segment.text = texts[static_cast<size_t>(i) % texts.size()];
+        segment.boundingBox = cv::Rect(0, i * 30, 400, 24);
+        segment.confidence = 0.9f;
+        segments.push_back(segment);
+    }
+
+    std::vector<Token> expected;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        for (auto& token : tokenizer_->TokenizeWithPosition(segments[i])) {
+            token.segmentIndex = i;
+            expected.push_back(std::move(token));
+        }
+    }
+
+    toriyomi::concurrency::ThreadPool pool(4);
+    const auto tokens = tokenizer_->TokenizeBatch(segments, pool);
+    ASSERT_EQ(tokens.size(), expected.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        EXPECT_EQ(tokens[i].surface, expected[i].surface);
+        EXPECT_EQ(tokens[i].segmentIndex, expected[i].segmentIndex);
+        EXPECT_EQ(tokens[i].boundingBox, expected[i].boundingBox);
+    }
+}
@@ -0,0 +1,122 @@
+// ToriYomi - 줄 조립 단위 테스트
+
+#include "core/sentence/line_builder.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+using namespace toriyomi::sentence;
+
+namespace {
+
+std::vector<std::string> Texts(const LineLayout& layout) {
+    std::vector<std::string> result;
+    for (const auto& line : layout.lines) {
+        result.push_back(line.text);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(LineBuilderTest, GroupsHorizontalLinesRegardlessOfInputOrder) {
+    std::vector<TextBox> boxes = {
+        {"行こうか", cv::Rect(260, 142, 160, 40)},
+        {"今日は天気がいいから", cv::Rect(40, 80, 400, 40)},
+        {"散歩に", cv::Rect(40, 140, 200, 40)},
+        {"Hello", cv::Rect(40, 200, 120, 40)},
+        {"world", cv::Rect(170, 202, 120, 40)},
+    };
+
+    const std::vector<std::string> expected = {"今日は天気がいいから", "散歩に行こうか", "Hello world"};
+    std::mt19937 rng(7);
+    for (int trial = 0; trial < 5; ++trial) {
+        std::shuffle(boxes.begin(), boxes.end(), rng);
+        const auto layout = LineBuilder().Build(boxes);
+        EXPECT_FALSE(layout.vertical);
+        EXPECT_EQ(Texts(layout), expected);
+    }
+}
+
+TEST(LineBuilderTest, DropsRubyAboveBaseText) {
+    const std::vector<TextBox> boxes = {
+        {"きょう", cv::Rect(40, 60, 60, 14)},
+        {"今日は晴れ", cv::Rect(40, 80, 300, 40)},
+        {"はれ", cv::Rect(190, 62, 40, 14)},
+        {"あ", cv::Rect(600, 300, 14, 14)},    // 아래에 바탕 글자가 없는 작은 가나는 유지
+    };
+
+    const auto layout = LineBuilder().Build(boxes);
+    EXPECT_EQ(layout.rubyCount, 2u);
+    EXPECT_EQ(Texts(layout), (std::vector<std::string>{"今日は晴れ", "あ"}));
+}
+
+TEST(LineBuilderTest, ReadsVerticalColumnsRightToLeft) {
+    // 세로쓰기: 오른쪽 열부터, 열 오른쪽의 루비 제거
+    const std::vector<TextBox> boxes = {
+        {"散歩に行こう", cv::Rect(100, 40, 40, 240)},
+        {"今日は晴れ", cv::Rect(160, 40, 40, 200)},
+        {"きょう", cv::Rect(202, 40, 14, 60)},
+        {"から", cv::Rect(160, 250, 40, 80)},
+    };
+
+    const auto layout = LineBuilder().Build(boxes);
+    EXPECT_TRUE(layout.vertical);
+    EXPECT_EQ(layout.rubyCount, 1u);
+    EXPECT_EQ(Texts(layout), (std::vector<std::string>{"今日は晴れから", "散歩に行こう"}));
+}
+
+TEST(LineBuilderTest, ReadsMultiColumnTextColumnByColumn) {
+    const std::vector<TextBox> boxes = {
+        {"左の一行目", cv::Rect(40, 80, 300, 40)},
+        {"右の一行目", cv::Rect(700, 80, 300, 40)},
+        {"左の二行目", cv::Rect(40, 140, 300, 40)},
+        {"右の二行目", cv::Rect(700, 140, 300, 40)},
+    };
+
+    const auto layout = LineBuilder().Build(boxes);
+    EXPECT_EQ(Texts(layout), (std::vector<std::string>{"左の一行目", "左の二行目", "右の一行目", "右の二行目"}));
+}
+
+TEST(LineBuilderTest, KeepsSingleLineGapInReadingOrder) {
+    // 한 줄에만 있는 큰 간격은 단이 아님 (아래 짧은 줄이 사이에 끼어들면 안 됨)
+    const std::vector<TextBox> boxes = {
+        {"「それは」", cv::Rect(40, 80, 200, 40)},
+        {"どうかな", cv::Rect(600, 80, 160, 40)},
+        {"と彼は言った", cv::Rect(40, 140, 240, 40)},
+    };
+
+    const auto layout = LineBuilder().Build(boxes);
+    EXPECT_EQ(Texts(layout), (std::vector<std::string>{"「それは」どうかな", "と彼は言った"}));
+
+    // 같은 자리의 간격이 여러 줄에 걸쳐 반복되어야 다단
+    LineBuilderOptions strict;
+    strict.minColumnBands = 3;
+    const std::vector<TextBox> twoRows = {
+        {"左の一行目", cv::Rect(40, 80, 300, 40)},
+        {"右の一行目", cv::Rect(700, 80, 300, 40)},
+        {"左の二行目", cv::Rect(40, 140, 300, 40)},
+        {"右の二行目", cv::Rect(700, 140, 300, 40)},
+    };
+    EXPECT_EQ(Texts(LineBuilder(strict).Build(twoRows)),
+              (std::vector<std::string>{"左の一行目右の一行目", "左の二行目右の二行目"}));
+}
+
+TEST(LineBuilderTest, HandlesDenseScreens) {
+    // 메뉴/백로그처럼 상자가 많은 화면: 40줄 x 10칸 + 줄마다 루비
+    std::vector<TextBox> boxes;
+    for (int row = 0; row < 40; ++row) {
+        for (int col = 0; col < 10; ++col) {
+            boxes.push_back({"漢字", cv::Rect(20 + col * 70, 100 + row * 60, 64, 36)});
+        }
+        boxes.push_back({"かんじ", cv::Rect(20, 84 + row * 60, 40, 12)});
+    }
+    std::shuffle(boxes.begin(), boxes.end(), std::mt19937(3));
+
+    const auto layout = LineBuilder().Build(boxes);
+    ASSERT_EQ(layout.lines.size(), 40u);
+    EXPECT_EQ(layout.rubyCount, 40u);
+    for (const auto& line : layout.lines) {
+        EXPECT_EQ(line.segmentCount, 10u);
+    }
+}
@@ -0,0 +1,90 @@
+// ToriYomi - MeCab feature 파서 / 토큰 아레나 단위 테스트
+
+#include "core/tokenizer/mecab_feature_parser.h"
+#include "core/tokenizer/tokenized_sentence.h"
+#include "core/tokenizer/japanese_tokenizer.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::tokenizer;
+
+TEST(MecabFeatureParserTest, ExtractsIpadicFields) {
+    const auto fields = ParseMecabFeature("動詞,自立,*,*,五段・カ行イ音便,連用タ接続,書く,カイ,カイ");
+    EXPECT_EQ(fields.partOfSpeech, "動詞");
+    EXPECT_EQ(fields.baseForm, "書く");
+    EXPECT_EQ(fields.reading, "カイ");
+}
+
+TEST(MecabFeatureParserTest, NormalizesAsteriskAndShortFeatures) {
+    // 미지어는 읽기 필드가 없음
+    const auto unknown = ParseMecabFeature("名詞,固有名詞,一般,*,*,*,*");
+    EXPECT_EQ(unknown.partOfSpeech, "名詞");
+    EXPECT_TRUE(unknown.baseForm.empty());
+    EXPECT_TRUE(unknown.reading.empty());
+
+    // 발음 필드가 없는 8필드 feature
+    const auto eightFields = ParseMecabFeature("助詞,係助詞,*,*,*,*,は,ハ");
+    EXPECT_EQ(eightFields.reading, "ハ");
+
+    const auto empty = ParseMecabFeature("");
+    EXPECT_TRUE(empty.partOfSpeech.empty());
+    EXPECT_TRUE(empty.reading.empty());
+}
+
+TEST(MecabFeatureParserTest, HandlesQuotedFields) {
+    const auto fields = ParseMecabFeature("記号,一般,*,*,*,*,\"a,b\",\"エー,ビー\",エービー");
+    EXPECT_EQ(fields.partOfSpeech, "記号");
+    EXPECT_EQ(fields.baseForm, "a,b");
+    EXPECT_EQ(fields.reading, "エー,ビー");
+}
+
+TEST(MecabFeatureParserTest, InternsPartOfSpeech) {
+    EXPECT_EQ(ParsePartOfSpeech("名詞"), PartOfSpeech::Noun);
+    EXPECT_EQ(ParsePartOfSpeech("助動詞"), PartOfSpeech::AuxiliaryVerb);
+    EXPECT_EQ(ParsePartOfSpeech("接頭辞"), PartOfSpeech::Prefix);
+    EXPECT_EQ(ParsePartOfSpeech("補助記号"), PartOfSpeech::Symbol);
+    EXPECT_EQ(ParsePartOfSpeech("*"), PartOfSpeech::Unknown);
+    EXPECT_EQ(ParsePartOfSpeech("謎品詞"), PartOfSpeech::Other);
+    EXPECT_EQ(PartOfSpeechName(PartOfSpeech::Verb), "動詞");
+    EXPECT_TRUE(PartOfSpeechName(PartOfSpeech::Other).empty());
+}
+
+TEST(MecabFeatureParserTest, SentenceReusesSurfaceSpans) {
+    const std::string text = "今日は";
+    TokenizedSentence sentence(text);
+    ASSERT_TRUE(sentence.AddToken(0, 6, ParseMecabFeature("名詞,副詞可能,*,*,*,*,今日,キョウ,キョー")));
+    ASSERT_TRUE(sentence.AddToken(6, 3, ParseMecabFeature("助詞,係助詞,*,*,*,*,は,ハ,ワ")));
+    EXPECT_FALSE(sentence.AddToken(8, 4, ParseMecabFeature("名詞")));
+
+    ASSERT_EQ(sentence.Size(), 2u);
+    EXPECT_EQ(sentence.Text(), text);
+    EXPECT_EQ(sentence.Surface(0), "今日");
+    EXPECT_EQ(sentence.Reading(0), "キョウ");
+    EXPECT_EQ(sentence.BaseForm(0), "今日");
+    EXPECT_EQ(sentence.PartOfSpeechAt(1), PartOfSpeech::Particle);
+    EXPECT_EQ(sentence.SurfaceOffset(1), 6u);
+
+    // 기본형이 표면형과 같으면 원문 구간을 그대로 가리킴
+    EXPECT_EQ(sentence.BaseForm(0).data(), sentence.Surface(0).data());
+}
+
+TEST(MecabFeatureParserTest, MaterializeKeepsTokenSemantics) {
+    const std::string text = "ABC謎";
+    TokenizedSentence sentence(text);
+    ASSERT_TRUE(sentence.AddToken(0, 3, ParseMecabFeature("名詞,固有名詞,組織,*,*,*,*")));
+    ASSERT_TRUE(sentence.AddToken(3, 3, ParseMecabFeature("謎品詞,*,*,*,*,*,*,ナゾ")));
+
+    const auto tokens = sentence.MaterializeAll();
+    ASSERT_EQ(tokens.size(), 2u);
+
+    // 읽기/기본형이 없으면 표면형으로 대체
+    EXPECT_EQ(tokens[0].surface, "ABC");
+    EXPECT_EQ(tokens[0].reading, "ABC");
+    EXPECT_EQ(tokens[0].baseForm, "ABC");
+    EXPECT_EQ(tokens[0].partOfSpeech, "名詞");
+    EXPECT_EQ(tokens[0].posTag, PartOfSpeech::Noun);
+
+    // 표에 없는 품사는 원문 유지
+    EXPECT_EQ(tokens[1].partOfSpeech, "謎品詞");
+    EXPECT_EQ(tokens[1].posTag, PartOfSpeech::Other);
+    EXPECT_EQ(tokens[1].reading, "ナゾ");
+}
@@ -0,0 +1,137 @@
+#include "core/ocr/ocr_engine.h"
+#include "core/ocr/ocr_engine_bootstrapper.h"
+#include "core/ocr/onnx_ocr_engine.h"
+#include "core/ocr/onnx/onnx_ocr_options.h"
+#include "core/ocr/onnx/onnx_ocr_preprocess.h"
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+using namespace toriyomi::ocr;
+namespace fs = std::filesystem;
+
+namespace {
+
+fs::path WriteTempFile(const std::string& name, const std::string& content) {
+    const fs::path path = fs::temp_directory_path() / name;
+    std::ofstream stream(path, std::ios::binary);
+    stream << content;
+    return path;
+}
+
+}  // namespace
+
+TEST(OnnxOcrEngineTest, FactoryCreatesOnnxEngine) {
+    auto engine = OcrEngineFactory::CreateEngine(OcrEngineType::OnnxRuntime);
+    ASSERT_NE(engine, nullptr);
+    EXPECT_EQ(engine->GetEngineName(), "ONNX Runtime");
+    EXPECT_FALSE(engine->IsInitialized());
+}
+
+TEST(OnnxOcrEngineTest, MissingModelsFailInitialization) {
+    OnnxOcrEngine engine;
+    OnnxOcrOptions options;
+    options.detModelPath = "./not_found/det.onnx";
+    options.recModelPath = "./not_found/rec.onnx";
+    options.recDictPath = "./not_found/dict.txt";
+
+    EXPECT_FALSE(engine.InitializeWithOptions(options));
+    EXPECT_FALSE(engine.IsInitialized());
+    EXPECT_FALSE(engine.GetLastError().empty());
+    EXPECT_TRUE(engine.RecognizeText(cv::Mat(32, 32, CV_8UC3, cv::Scalar(255, 255, 255))).empty());
+}
+
+TEST(OnnxOcrEngineTest, ParsesEngineNames) {
+    EXPECT_EQ(OcrEngineBootstrapper::ParseEngineType("paddle"), OcrEngineType::PaddleOCR);
+    EXPECT_EQ(OcrEngineBootstrapper::ParseEngineType("OnnxRuntime"), OcrEngineType::OnnxRuntime);
+    EXPECT_EQ(OcrEngineBootstrapper::ParseEngineType("ort"), OcrEngineType::OnnxRuntime);
+    EXPECT_FALSE(OcrEngineBootstrapper::ParseEngineType("tesseract").has_value());
+}
+
+TEST(OnnxOcrEngineTest, BootstrapperReadsEngineFromConfig) {
+    const auto configPath = WriteTempFile("toriyomi_engine_select.json",
+                                          R"({"engine": "onnxruntime", "det_model": "det", "rec_model": "rec"})");
+    OcrBootstrapConfig config;
+    config.paddleConfigPath = configPath.string();
+
+    OcrEngineBootstrapper bootstrapper(config);
+    EXPECT_EQ(bootstrapper.GetPreferredEngine(), OcrEngineType::OnnxRuntime);
+    fs::remove(configPath);
+}
+
+TEST(OnnxOcrEngineTest, OptionsFromJsonUseRecModelDictionaryFallback) {
+    const auto configPath = WriteTempFile("toriyomi_onnx_options.json", R"({
+        "onnx_det_model": "./models/onnx/det.onnx",
+        "onnx_rec_model": "./models/onnx/rec.onnx",
+        "rec_model": "./models/paddleocr/rec",
+        "rec_batch_size": 8,
+        "det_limit_side_len": 1280
+    })");
+
+    std::string error;
+    auto options = OnnxOcrOptions::FromJsonFile(configPath, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->recBatchSize, 8);
+    EXPECT_EQ(options->detLimitSideLen, 1280);
+    EXPECT_EQ(options->recDictPath,
+              (configPath.parent_path() / "models/paddleocr/rec").lexically_normal() / "inference.yml");
+    fs::remove(configPath);
+}
+
+TEST(OnnxOcrEngineTest, OptionsFromJsonResolvePathsAgainstConfigDirectory) {
+    const fs::path configDir = fs::temp_directory_path() / "toriyomi_configs";
+    fs::create_directories(configDir);
+    const fs::path absoluteDict = fs::temp_directory_path() / "toriyomi_abs_dict.txt";
+    const auto configPath = configDir / "paddle_ocr.json";
+    {
+        std::ofstream stream(configPath, std::ios::binary);
+        stream << R"({"onnx_det_model": "../models/paddleocr/onnx/det.onnx",)"
+               << R"("onnx_rec_model": "../models/paddleocr/onnx/rec.onnx",)"
+               << R"("onnx_rec_dict": ")" << absoluteDict.generic_string() << R"("})";
+    }
+
+    std::string error;
+    auto options = OnnxOcrOptions::FromJsonFile(configPath, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->detModelPath,
+              (fs::temp_directory_path() / "models/paddleocr/onnx/det.onnx").lexically_normal());
+    EXPECT_EQ(options->recModelPath,
+              (fs::temp_directory_path() / "models/paddleocr/onnx/rec.onnx").lexically_normal());
+    EXPECT_EQ(options->recDictPath, absoluteDict);
+    fs::remove_all(configDir);
+}
+
+TEST(OnnxOcrEngineTest, LoadsTextCharacterDictionary) {
+    const auto dictPath = WriteTempFile("toriyomi_dict.txt", "あ\r\nい\nう\n");
+
+    std::string error;
+    auto characters = LoadCtcCharacterDict(dictPath, error);
+    ASSERT_TRUE(characters.has_value()) << error;
+    ASSERT_EQ(characters->size(), 3u);
+    EXPECT_EQ((*characters)[0], "あ");
+    EXPECT_EQ((*characters)[2], "う");
+    fs::remove(dictPath);
+}
+
+TEST(OnnxOcrEngineTest, DetectionInputSizeIsStrideAligned) {
+    const cv::Size size = ComputeDetectionInputSize(cv::Size(1920, 1080), 960, "max", 4000);
+    EXPECT_EQ(size.width, 960);
+    EXPECT_EQ(size.height % 32, 0);
+    EXPECT_LE(std::abs(size.height - 540), 16);
+
+    const cv::Size small = ComputeDetectionInputSize(cv::Size(100, 20), 960, "max", 4000);
+    EXPECT_EQ(small.width, 96);
+    EXPECT_EQ(small.height, 32);
+}
+
+TEST(OnnxOcrEngineTest, RecognitionBlobIsNormalizedAndPadded) {
+    cv::Mat crop(24, 24, CV_8UC3, cv::Scalar(255, 255, 255));
+    std::vector<float> blob;
+    AppendRecognitionBlob(crop, 48, 100, blob);
+
+    ASSERT_EQ(blob.size(), 3u * 48 * 100);
+    EXPECT_FLOAT_EQ(blob[0], 1.0f);        // 흰색 -> 1.0
+    EXPECT_FLOAT_EQ(blob[99], 0.0f);       // 패딩 영역
+    EXPECT_EQ(ComputeRecognitionWidth(crop.size(), 48, 100), 48);
+}
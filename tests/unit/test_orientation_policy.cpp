@@ -0,0 +1,98 @@
+#include "core/ocr/orientation_policy.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::ocr;
+
+namespace {
+
+OrientationPolicyConfig MakeConfig(int warmup, int interval, float confidence) {
+    OrientationPolicyConfig config;
+    config.warmupFrames = warmup;
+    config.recheckIntervalFrames = interval;
+    config.recheckConfidence = confidence;
+    return config;
+}
+
+}  // namespace
+
+TEST(StickyOrientationPolicyTest, RunsClassifierUntilWarmupCompletes) {
+    StickyOrientationPolicy policy(MakeConfig(3, 0, 0.0f));
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_FALSE(policy.AngleForFrame().has_value());
+        policy.RecordObservation(0);
+    }
+
+    EXPECT_TRUE(policy.IsLocked());
+    EXPECT_EQ(policy.GetClassifierRuns(), 3u);
+}
+
+TEST(StickyOrientationPolicyTest, LocksMajorityAngle) {
+    StickyOrientationPolicy policy(MakeConfig(3, 0, 0.0f));
+
+    policy.RecordObservation(180);
+    policy.RecordObservation(0);
+    policy.RecordObservation(180);
+
+    auto angle = policy.AngleForFrame();
+    ASSERT_TRUE(angle.has_value());
+    EXPECT_EQ(*angle, 180);
+    EXPECT_EQ(policy.GetSkippedRuns(), 1u);
+}
+
+TEST(StickyOrientationPolicyTest, TieFallsBackToSmallestAngle) {
+    StickyOrientationPolicy policy(MakeConfig(2, 0, 0.0f));
+
+    policy.RecordObservation(1);
+    policy.RecordObservation(0);
+
+    ASSERT_TRUE(policy.GetLockedAngle().has_value());
+    EXPECT_EQ(*policy.GetLockedAngle(), 0);
+}
+
+TEST(StickyOrientationPolicyTest, RechecksAfterInterval) {
+    StickyOrientationPolicy policy(MakeConfig(1, 2, 0.0f));
+    policy.RecordObservation(0);
+
+    EXPECT_TRUE(policy.AngleForFrame().has_value());
+    EXPECT_TRUE(policy.AngleForFrame().has_value());
+    EXPECT_FALSE(policy.AngleForFrame().has_value());
+    EXPECT_FALSE(policy.IsLocked());
+
+    policy.RecordObservation(90);
+    auto angle = policy.AngleForFrame();
+    ASSERT_TRUE(angle.has_value());
+    EXPECT_EQ(*angle, 90);
+}
+
+TEST(StickyOrientationPolicyTest, LowConfidenceTriggersRecheck) {
+    StickyOrientationPolicy policy(MakeConfig(1, 0, 60.0f));
+    policy.RecordObservation(0);
+
+    policy.ReportConfidence(95.0f);
+    EXPECT_TRUE(policy.AngleForFrame().has_value());
+
+    policy.ReportConfidence(30.0f);
+    EXPECT_FALSE(policy.AngleForFrame().has_value());
+}
+
+TEST(StickyOrientationPolicyTest, ResetForgetsLockedAngle) {
+    StickyOrientationPolicy policy(MakeConfig(1, 0, 0.0f));
+    policy.RecordObservation(0);
+    ASSERT_TRUE(policy.IsLocked());
+
+    policy.Reset();
+
+    EXPECT_FALSE(policy.IsLocked());
+    EXPECT_FALSE(policy.AngleForFrame().has_value());
+}
+
+TEST(StickyOrientationPolicyTest, IgnoresObservationsWhileLocked) {
+    StickyOrientationPolicy policy(MakeConfig(1, 0, 0.0f));
+    policy.RecordObservation(0);
+    policy.RecordObservation(180);
+
+    ASSERT_TRUE(policy.GetLockedAngle().has_value());
+    EXPECT_EQ(*policy.GetLockedAngle(), 0);
+    EXPECT_EQ(policy.GetClassifierRuns(), 1u);
+}
@@ -0,0 +1,442 @@
+// ToriYomi - 캡처 → OCR → 문장 파이프라인 단위 테스트
+
+#include "core/pipeline/pipeline.h"
+#include "core/pipeline/pipeline_stopper.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace toriyomi;
+using namespace toriyomi::pipeline;
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * @brief 프레임마다 첫 픽셀에 번호를 적는 가짜 공급원
+ *
+ * staticAfter 장 이후로는 같은 화면이고, noise면 그 뒤에도 다른 픽셀이 잡음 수준으로 흔들림.
+ */
+class FakeFrameSource : public FrameSource {
+public:
+    explicit FakeFrameSource(bool startResult = true, int staticAfter = -1, bool noise = false)
+        : startResult_(startResult), staticAfter_(staticAfter), noise_(noise) {}
+
+    bool Start() override {
+        started = true;
+        return startResult_;
+    }
+    void Stop() override { stopped = true; }
+    cv::Mat CaptureFrame() override {
+        cv::Mat frame(8, 8, CV_8UC1, cv::Scalar(0));
+        const int number = ++captured;
+        const int shown = staticAfter_ >= 0 ? std::min(number, staticAfter_) : number;
+        frame.ptr<unsigned char>(0)[0] = static_cast<unsigned char>(shown * 37);
+        if (noise_) {
+            frame.ptr<unsigned char>(4)[4] = static_cast<unsigned char>(number % 2 == 0 ? 2 : 0);
+        }
+        return frame;
+    }
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> stopped{false};
+    std::atomic<int> captured{0};
+
+private:
+    bool startResult_;
+    int staticAfter_;
+    bool noise_;
+};
+
+/**
+ * @brief 정해진 문장을 돌려주는 가짜 OCR 엔진 (호출마다 지연 가능)
+ */
+class FakeOcrEngine : public ocr::IOcrEngine {
+public:
+    FakeOcrEngine(std::string text, std::chrono::milliseconds delay = 0ms, bool initialized = true)
+        : text_(std::move(text)), delay_(delay), initialized_(initialized) {}
+
+    bool Initialize(const std::string&, const std::string&) override { return initialized_; }
+    std::vector<ocr::TextSegment> RecognizeText(const cv::Mat&) override {
+        ++calls;
+        if (delay_.count() > 0) {
+            std::this_thread::sleep_for(delay_);
+        }
+        ocr::TextSegment segment;
+        segment.text = text_;
+        segment.boundingBox = cv::Rect(40, 80, 300, 40);
+        segment.confidence = 95.0f;
+        return {segment};
+    }
+    void Shutdown() override {}
+    bool IsInitialized() const override { return initialized_; }
+    std::string GetEngineName() const override { return "Fake"; }
+
+    std::atomic<int> calls{0};
+
+private:
+    std::string text_;
+    std::chrono::milliseconds delay_;
+    bool initialized_;
+};
+
+const std::vector<std::string> kScript = {
+    "おはようございます。", "今日は晴れですね。", "散歩に行きましょうか。", "駅前の喫茶店で待ってます。",
+    "雨が降りそうだ。", "傘を持っていこう。", "ありがとう、助かったよ。", "また明日会いましょう。",
+};
+
+/**
+ * @brief 호출마다 대본의 다음 문장을 돌려주는 가짜 OCR 엔진 (끝나면 마지막 문장 유지)
+ */
+class ScriptedOcrEngine : public ocr::IOcrEngine {
+public:
+    bool Initialize(const std::string&, const std::string&) override { return true; }
+    std::vector<ocr::TextSegment> RecognizeText(const cv::Mat&) override {
+        const std::size_t line = std::min<std::size_t>(calls++, kScript.size() - 1);
+        ocr::TextSegment segment;
+        segment.text = kScript[line];
+        segment.boundingBox = cv::Rect(40, 80, 300, 40);
+        segment.confidence = 95.0f;
+        return {segment};
+    }
+    void Shutdown() override {}
+    bool IsInitialized() const override { return true; }
+    std::string GetEngineName() const override { return "Scripted"; }
+
+    std::atomic<int> calls{0};
+};
+
+PipelineOptions FastOptions() {
+    PipelineOptions options;
+    options.captureInterval = 1ms;
+    options.statsInterval = 0ms;
+    return options;
+}
+
+}  // namespace
+
+TEST(ChannelTest, BlockPolicyMakesProducerWait) {
+    Channel<int> channel(1);
+    ASSERT_TRUE(channel.Push(1));
+
+    std::atomic<bool> pushed{false};
+    std::thread producer([&]() {
+        pushed = channel.Push(2);
+    });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(pushed.load());
+
+    EXPECT_EQ(channel.Pop(), 1);
+    producer.join();
+    EXPECT_TRUE(pushed.load());
+    EXPECT_EQ(channel.Pop(), 2);
+
+    const auto stats = channel.GetStats();
+    EXPECT_EQ(stats.blockedWaits, 1u);
+    EXPECT_GT(stats.blockedMs, 0.0);
+    EXPECT_EQ(stats.dropped, 0u);
+}
+
+TEST(ChannelTest, CloseWakesWaitersAndDrainsRemainingItems) {
+    Channel<int> channel(2, OverflowPolicy::DropOldest);
+    channel.Push(1);
+    channel.Push(2);
+    channel.Push(3);    // 1 버림
+    EXPECT_EQ(channel.GetStats().dropped, 1u);
+
+    channel.Close();
+    EXPECT_FALSE(channel.Push(4));
+    EXPECT_EQ(channel.Pop(), 2);
+    EXPECT_EQ(channel.Pop(), 3);
+    EXPECT_EQ(channel.Pop(), std::nullopt);
+
+    Channel<int> empty(1);
+    std::thread consumer([&]() { EXPECT_EQ(empty.Pop(), std::nullopt); });
+    std::this_thread::sleep_for(10ms);
+    empty.Close();
+    consumer.join();
+}
+
+TEST(PipelineTest, DeliversSentencesAndStopsInOrder) {
+    auto source = std::make_shared<FakeFrameSource>();
+    auto engine = std::make_shared<FakeOcrEngine>("今日は晴れ。");
+    Pipeline pipeline(source, engine, FastOptions());
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<sentence::TypewriterEvent> events;
+    pipeline.SubscribeSentences([&](const sentence::TypewriterEvent& event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(event);
+        cv.notify_all();
+    });
+    std::atomic<int> ocrResults{0};
+    std::atomic<std::uint64_t> lastSequence{0};
+    pipeline.SubscribeOcrResults([&](std::shared_ptr<const ocr::OcrResult> result) {
+        EXPECT_GT(result->sequence, lastSequence.load());
+        lastSequence = result->sequence;
+        ++ocrResults;
+    });
+
+    ASSERT_TRUE(pipeline.Start());
+    EXPECT_TRUE(pipeline.IsRunning());
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, 5s, [&]() { return !events.empty(); }));
+    }
+    // 같은 화면이 계속 보여도 확정 문장은 한 번만
+    while (ocrResults.load() < 10) {
+        std::this_thread::sleep_for(1ms);
+    }
+    pipeline.Stop();
+    EXPECT_FALSE(pipeline.IsRunning());
+    EXPECT_TRUE(source->stopped.load());
+
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, sentence::TypewriterEvent::Kind::Final);
+    EXPECT_EQ(events[0].text, "今日は晴れ。");
+
+    uint64_t sequence = 0;
+    EXPECT_FALSE(pipeline.GetLatestFrame(&sequence).empty());
+    EXPECT_GE(sequence, 10u);
+    ASSERT_NE(pipeline.GetLatestResult(), nullptr);
+
+    const auto stats = pipeline.GetStats();
+    EXPECT_GE(stats.framesRecognized, 10u);
+    EXPECT_EQ(stats.sentenceEvents, 1u);
+
+    // 정지 후에는 다시 시작하지 않음
+    EXPECT_FALSE(pipeline.Start());
+}
+
+TEST(PipelineTest, SlowSubscribersReceiveEveryResultInOrder) {
+    // 구독자가 느려도 최신 결과만 남기지 않고 모든 결과/문장을 순서대로 전달
+    auto source = std::make_shared<FakeFrameSource>();
+    auto engine = std::make_shared<ScriptedOcrEngine>();
+    PipelineOptions options = FastOptions();
+    options.frameQueueCapacity = 1;
+    options.resultQueueCapacity = 1;
+    Pipeline pipeline(source, engine, options);
+
+    std::mutex mutex;
+    std::vector<std::uint64_t> sequences;
+    pipeline.SubscribeOcrResults([&](std::shared_ptr<const ocr::OcrResult> result) {
+        std::this_thread::sleep_for(2ms);
+        std::lock_guard<std::mutex> lock(mutex);
+        sequences.push_back(result->sequence);
+    });
+    std::condition_variable cv;
+    std::vector<std::string> finals;
+    pipeline.SubscribeSentences([&](const sentence::TypewriterEvent& event) {
+        std::this_thread::sleep_for(5ms);
+        if (event.kind != sentence::TypewriterEvent::Kind::Final) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        finals.push_back(event.text);
+        cv.notify_all();
+    });
+
+    ASSERT_TRUE(pipeline.Start());
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, 5s, [&]() { return finals.size() >= kScript.size() - 1; }));
+    }
+    pipeline.Stop();
+
+    for (std::size_t i = 0; i < sequences.size(); ++i) {
+        EXPECT_EQ(sequences[i], sequences.front() + i);
+    }
+    EXPECT_EQ(sequences.size(), pipeline.GetStats().framesRecognized);
+    // 마지막 문장은 화면에 남아 있어 확정 전일 수 있음
+    ASSERT_GE(finals.size(), kScript.size() - 1);
+    for (std::size_t i = 0; i < finals.size(); ++i) {
+        EXPECT_EQ(finals[i], kScript[i]);
+    }
+}
+
+TEST(PipelineTest, SlowOcrThrottlesCapture) {
+    auto source = std::make_shared<FakeFrameSource>();
+    auto engine = std::make_shared<FakeOcrEngine>("待って", 20ms);
+    PipelineOptions options = FastOptions();
+    options.frameQueueCapacity = 1;
+    Pipeline pipeline(source, engine, options);
+
+    std::atomic<int> statsCalls{0};
+    pipeline.SubscribeStats([&](const PipelineStats&) { ++statsCalls; });
+
+    ASSERT_TRUE(pipeline.Start());
+    std::this_thread::sleep_for(200ms);
+    pipeline.Stop();
+
+    // 1ms 간격이어도 OCR(20ms)이 가져간 만큼만 캡처 (처리 중 1개 + 대기 1개 + 정지 직전 1개)
+    const auto stats = pipeline.GetStats();
+    EXPECT_LE(source->captured.load(), engine->calls.load() + 2);
+    EXPECT_LT(source->captured.load(), 30);
+    EXPECT_GT(stats.backpressureWaits, 0u);
+    EXPECT_GT(stats.averageOcrMs, 10.0);
+    EXPECT_GT(statsCalls.load(), 0);
+}
+
+TEST(PipelineTest, ChangeDetectionRunsOcrOnceWhenScreenSettles) {
+    // 3장 동안 글자가 나타난 뒤 멈추는 화면
+    auto source = std::make_shared<FakeFrameSource>(true, 3);
+    auto engine = std::make_shared<FakeOcrEngine>("待って");
+    PipelineOptions options = FastOptions();
+    options.ocrSettleTime = 20ms;
+    options.fallbackOcrInterval = 0ms;
+    Pipeline pipeline(source, engine, options);
+    pipeline.SetChangeDetection(true);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<sentence::TypewriterEvent> events;
+    pipeline.SubscribeSentences([&](const sentence::TypewriterEvent& event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(event);
+        cv.notify_all();
+    });
+
+    ASSERT_TRUE(pipeline.Start());
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, 5s, [&]() {
+            return std::any_of(events.begin(), events.end(), [](const auto& event) {
+                return event.kind == sentence::TypewriterEvent::Kind::Final;
+            });
+        }));
+    }
+    // 멈춘 화면을 계속 찍어도 OCR은 더 돌지 않음
+    const int capturedBefore = source->captured.load();
+    while (source->captured.load() < capturedBefore + 3) {
+        std::this_thread::sleep_for(1ms);
+    }
+    pipeline.Stop();
+
+    // 문장 부호 없이도 안정된 화면이므로 settleTime을 기다리지 않고 확정
+    EXPECT_EQ(engine->calls.load(), 1);
+    ASSERT_FALSE(events.empty());
+    EXPECT_EQ(events.back().kind, sentence::TypewriterEvent::Kind::Final);
+    EXPECT_EQ(events.back().text, "待って");
+
+    const auto stats = pipeline.GetStats();
+    EXPECT_EQ(stats.trigger.settledTriggers, 1u);
+    EXPECT_GT(stats.trigger.framesHeld, 0u);
+    EXPECT_EQ(stats.framesRecognized, 1u);
+}
+
+TEST(PipelineTest, ChangeDetectionSettlesDespitePixelNoise) {
+    // 글자가 멈춘 뒤에도 픽셀 하나가 계속 깜빡이는 화면 (정확한 해시로는 안정되지 않음)
+    auto source = std::make_shared<FakeFrameSource>(true, 3, true);
+    auto engine = std::make_shared<FakeOcrEngine>("待って");
+    PipelineOptions options = FastOptions();
+    options.ocrSettleTime = 20ms;
+    options.fallbackOcrInterval = 0ms;
+    Pipeline pipeline(source, engine, options);
+    pipeline.SetChangeDetection(true);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<sentence::TypewriterEvent> events;
+    pipeline.SubscribeSentences([&](const sentence::TypewriterEvent& event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(event);
+        cv.notify_all();
+    });
+
+    ASSERT_TRUE(pipeline.Start());
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, 5s, [&]() {
+            return std::any_of(events.begin(), events.end(), [](const auto& event) {
+                return event.kind == sentence::TypewriterEvent::Kind::Final;
+            });
+        }));
+    }
+    // 멈춘 화면을 계속 찍어도 OCR은 더 돌지 않음
+    const int capturedBefore = source->captured.load();
+    while (source->captured.load() < capturedBefore + 3) {
+        std::this_thread::sleep_for(1ms);
+    }
+    pipeline.Stop();
+
+    EXPECT_EQ(engine->calls.load(), 1);
+    ASSERT_FALSE(events.empty());
+    EXPECT_EQ(events.back().kind, sentence::TypewriterEvent::Kind::Final);
+    EXPECT_EQ(events.back().text, "待って");
+
+    const auto stats = pipeline.GetStats();
+    EXPECT_EQ(stats.trigger.settledTriggers, 1u);
+    EXPECT_GT(stats.trigger.framesHeld, 0u);
+    EXPECT_EQ(stats.framesRecognized, 1u);
+}
+
+TEST(PipelineTest, RefusesToStartWithoutReadyStages) {
+    auto failingSource = std::make_shared<FakeFrameSource>(false);
+    Pipeline failing(failingSource, std::make_shared<FakeOcrEngine>("x"));
+    EXPECT_FALSE(failing.Start());
+    EXPECT_TRUE(failingSource->started.load());
+
+    auto source = std::make_shared<FakeFrameSource>();
+    Pipeline uninitialized(source, std::make_shared<FakeOcrEngine>("x", 0ms, false));
+    EXPECT_FALSE(uninitialized.Start());
+    EXPECT_FALSE(source->started.load());
+
+    // 시작하지 않은 파이프라인 정지는 아무 일도 하지 않음
+    uninitialized.Stop();
+    EXPECT_FALSE(source->stopped.load());
+}
+
+TEST(PipelineStopperTest, StopsAttachmentsBeforePipelineOffTheCallerThread) {
+    auto source = std::make_shared<FakeFrameSource>();
+    auto pipeline = std::make_unique<Pipeline>(source, std::make_shared<FakeOcrEngine>("x"), FastOptions());
+    ASSERT_TRUE(pipeline->Start());
+
+    PipelineStopper stopper;
+    std::atomic<bool> sourceStoppedFirst{true};
+    std::promise<PipelineStopSummary> finished;
+    const auto callerThread = std::this_thread::get_id();
+    std::atomic<bool> ranOnCaller{false};
+
+    std::vector<PipelineStopper::StopStep> attachments;
+    attachments.emplace_back([&]() {
+        sourceStoppedFirst = !source->stopped.load();
+        ranOnCaller = std::this_thread::get_id() == callerThread;
+    });
+    stopper.StopAsync(std::move(pipeline), std::move(attachments),
+                      [&](const PipelineStopSummary& summary) { finished.set_value(summary); });
+
+    auto future = finished.get_future();
+    ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+    const auto summary = future.get();
+    EXPECT_TRUE(summary.attachmentsStopped);
+    EXPECT_TRUE(summary.pipelineStopped);
+    EXPECT_EQ(summary.remaining, 0u);
+    EXPECT_TRUE(sourceStoppedFirst.load());
+    EXPECT_FALSE(ranOnCaller.load());
+    EXPECT_TRUE(source->stopped.load());
+
+    stopper.WaitAll();
+    EXPECT_EQ(stopper.InFlight(), 0u);
+}
+
+TEST(PipelineStopperTest, DestructorWaitsForInFlightStops) {
+    std::atomic<bool> attachmentDone{false};
+    {
+        PipelineStopper stopper;
+        std::vector<PipelineStopper::StopStep> attachments;
+        attachments.emplace_back([&]() {
+            std::this_thread::sleep_for(30ms);
+            attachmentDone = true;
+        });
+        stopper.StopAsync(nullptr, std::move(attachments), nullptr);
+        EXPECT_EQ(stopper.InFlight(), 1u);
+    }
+    EXPECT_TRUE(attachmentDone.load());
+}
@@ -0,0 +1,68 @@
+// ToriYomi - 미리보기 프레임 축소 단위 테스트
+
+#include "core/capture/preview_downsampler.h"
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+using namespace toriyomi::capture;
+
+TEST(PreviewDownsamplerTest, FitsWithinPreviewBoundsKeepingAspect) {
+    EXPECT_EQ(PreviewDownsampler::FitWithin(cv::Size(1920, 1080), cv::Size(960, 540)), cv::Size(960, 540));
+    EXPECT_EQ(PreviewDownsampler::FitWithin(cv::Size(1280, 1024), cv::Size(960, 540)), cv::Size(675, 540));
+    EXPECT_EQ(PreviewDownsampler::FitWithin(cv::Size(640, 480), cv::Size(960, 540)), cv::Size(640, 480));
+    EXPECT_EQ(PreviewDownsampler::FitWithin(cv::Size(0, 480), cv::Size(960, 540)), cv::Size());
+}
+
+TEST(PreviewDownsamplerTest, AveragesAreaAndKeepsChannelLayout) {
+    // 2x2 블록마다 0/200 체크무늬 → 절반 크기에서 모두 100
+    cv::Mat frame(4, 8, CV_8UC4, cv::Scalar(0, 0, 0, 255));
+    for (int y = 0; y < frame.rows; ++y) {
+        auto* row = frame.ptr<unsigned char>(y);
+        for (int x = 0; x < frame.cols; ++x) {
+            row[x * 4] = static_cast<unsigned char>(((x + y) % 2) * 200);
+        }
+    }
+
+    PreviewDownsampler downsampler(cv::Size(4, 2));
+    auto preview = downsampler.Update(frame, 1);
+    ASSERT_TRUE(preview.has_value());
+    EXPECT_EQ(preview->version, 1u);
+    EXPECT_EQ(preview->sourceSize, cv::Size(8, 4));
+    ASSERT_EQ(preview->image.size(), cv::Size(4, 2));
+    EXPECT_EQ(preview->image.type(), CV_8UC4);
+    EXPECT_EQ(preview->image.ptr<unsigned char>(1)[3 * 4], 100);
+    EXPECT_EQ(preview->image.ptr<unsigned char>(1)[3 * 4 + 3], 255);
+}
+
+TEST(PreviewDownsamplerTest, PublishesOnlyWhenFrameChanges) {
+    PreviewDownsampler downsampler(cv::Size(320, 180));
+    cv::Mat frame(360, 640, CV_8UC3, cv::Scalar(10, 20, 30));
+
+    ASSERT_TRUE(downsampler.Update(frame, 1).has_value());
+    // 같은 캡처 번호는 축소 없이 건너뜀
+    EXPECT_FALSE(downsampler.Update(frame, 1).has_value());
+    // 번호가 바뀌어도 내용이 같으면 다시 올리지 않음
+    EXPECT_FALSE(downsampler.Update(frame.clone(), 2).has_value());
+
+    cv::Mat changed = frame.clone();
+    changed.ptr<unsigned char>(100)[300] = 200;
+    auto preview = downsampler.Update(changed, 3);
+    ASSERT_TRUE(preview.has_value());
+    EXPECT_EQ(preview->version, 2u);
+
+    // 창이 바뀌면 같은 내용이라도 새 버전으로 올림
+    downsampler.Reset();
+    preview = downsampler.Update(changed, 0);
+    ASSERT_TRUE(preview.has_value());
+    EXPECT_EQ(preview->version, 3u);
+}
+
+TEST(PreviewDownsamplerTest, SharesBufferWhenNoScalingNeeded) {
+    PreviewDownsampler downsampler(cv::Size(960, 540));
+    cv::Mat frame(100, 200, CV_8UC4, cv::Scalar(1, 2, 3, 255));
+
+    auto preview = downsampler.Update(frame, 1);
+    ASSERT_TRUE(preview.has_value());
+    EXPECT_EQ(preview->image.data, frame.data);
+    EXPECT_FALSE(downsampler.Update(cv::Mat(), 2).has_value());
+}
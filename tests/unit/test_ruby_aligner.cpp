@@ -0,0 +1,106 @@
+// ToriYomi - 읽기/표면형 정렬 단위 테스트
+
+#include "core/tokenizer/ruby_aligner.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+using namespace toriyomi::tokenizer;
+
+TEST(RubyAlignerTest, ExcludesOkurigana) {
+    const auto segments = AlignRuby("食べる", "タベル");
+    ASSERT_EQ(segments.size(), 1u);
+    EXPECT_EQ(segments[0].charStart, 0u);
+    EXPECT_EQ(segments[0].charLength, 1u);
+    EXPECT_EQ(segments[0].reading, "た");
+}
+
+TEST(RubyAlignerTest, SplitsAlternatingKanjiAndKanaRuns) {
+    const auto segments = AlignRuby("取り扱い", "トリアツカイ");
+    ASSERT_EQ(segments.size(), 2u);
+    EXPECT_EQ(segments[0].reading, "と");
+    EXPECT_EQ(segments[1].charStart, 2u);
+    EXPECT_EQ(segments[1].reading, "あつか");
+
+    // 앞쪽 가나 + 한자 (お茶)
+    const auto prefixed = AlignRuby("お茶", "オチャ");
+    ASSERT_EQ(prefixed.size(), 1u);
+    EXPECT_EQ(prefixed[0].charStart, 1u);
+    EXPECT_EQ(prefixed[0].reading, "ちゃ");
+}
+
+TEST(RubyAlignerTest, KeepsGroupRubyWithoutTable) {
+    // 숙자훈은 글자 단위로 나눌 수 없으므로 구간 전체
+    const auto segments = AlignRuby("今日", "キョウ");
+    ASSERT_EQ(segments.size(), 1u);
+    EXPECT_EQ(segments[0].charLength, 2u);
+    EXPECT_EQ(segments[0].reading, "きょう");
+}
+
+TEST(RubyAlignerTest, ReturnsEmptyWhenAlignmentImpossible) {
+    EXPECT_TRUE(AlignRuby("です", "デス").empty());          // 한자 없음
+    EXPECT_TRUE(AlignRuby("食べる", "ノム").empty());        // 오쿠리가나 불일치
+    EXPECT_TRUE(AlignRuby("謎", "謎").empty());              // 읽기 없는 미지어
+    EXPECT_TRUE(AlignRuby("", "").empty());
+}
+
+TEST(RubyAlignerTest, TableSplitsKanjiRunWithSoundChanges) {
+    KanjiReadingTable table;
+    table.Add(U'学', "ガク");
+    table.Add(U'校', "コウ");
+    table.Add(U'手', "て");
+    table.Add(U'紙', "し");
+    table.Add(U'紙', "かみ");
+
+    const auto school = AlignRuby("学校", "ガッコウ", &table);   // 촉음화
+    ASSERT_EQ(school.size(), 2u);
+    EXPECT_EQ(school[0].reading, "がっ");
+    EXPECT_EQ(school[1].reading, "こう");
+
+    const auto letter = AlignRuby("手紙", "テガミ", &table);     // 연탁
+    ASSERT_EQ(letter.size(), 2u);
+    EXPECT_EQ(letter[0].reading, "て");
+    EXPECT_EQ(letter[1].reading, "がみ");
+}
+
+TEST(RubyAlignerTest, TableDisambiguatesAlignment) {
+    // 物の怪 / もののけ: 物=も + 怪=のけ 와 物=もの + 怪=け 둘 다 형식상 가능
+    const auto withoutTable = AlignRuby("物の怪", "モノノケ");
+    ASSERT_EQ(withoutTable.size(), 2u);
+    EXPECT_EQ(withoutTable[0].reading, "も");
+
+    KanjiReadingTable table;
+    table.Add(U'物', "もの");
+    table.Add(U'怪', "け");
+    const auto segments = AlignRuby("物の怪", "モノノケ", &table);
+    ASSERT_EQ(segments.size(), 2u);
+    EXPECT_EQ(segments[0].reading, "もの");
+    EXPECT_EQ(segments[1].charStart, 2u);
+    EXPECT_EQ(segments[1].reading, "け");
+
+    // 한 구간 안에서 표로 나눌 수 없는 글자가 있으면 그룹 루비 유지
+    table.Add(U'見', "み");
+    const auto heading = AlignRuby("見出し", "ミダシ", &table);
+    ASSERT_EQ(heading.size(), 1u);
+    EXPECT_EQ(heading[0].charLength, 2u);
+    EXPECT_EQ(heading[0].reading, "みだ");
+}
+
+TEST(RubyAlignerTest, LoadsTableFromTsv) {
+    const auto path = std::filesystem::temp_directory_path() / "toriyomi_kanji_readings_test.tsv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "# comment\n学\tガク,まな\r\n無効な行\n校\tこう\n";
+    }
+
+    KanjiReadingTable table;
+    ASSERT_TRUE(table.LoadFromFile(path));
+    EXPECT_EQ(table.Size(), 2u);
+    ASSERT_NE(table.Find(U'学'), nullptr);
+    EXPECT_EQ(table.Find(U'学')->front(), "がく");
+    EXPECT_EQ(table.Find(U'学')->size(), 2u);
+    EXPECT_EQ(table.Find(U'花'), nullptr);
+
+    std::filesystem::remove(path);
+    EXPECT_FALSE(KanjiReadingTable().LoadFromFile(path));
+}
@@ -0,0 +1,143 @@
+// ToriYomi - 문장 분석 캐시 단위 테스트
+
+#include "core/tokenizer/sentence_analysis_cache.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+using namespace toriyomi::tokenizer;
+
+namespace {
+
+SentenceAnalysis MakeAnalysis(const std::string& surface, const std::string& reading) {
+    SentenceAnalysis analysis;
+    Token token{};
+    token.surface = surface;
+    token.reading = reading;
+    token.baseForm = surface;
+    token.partOfSpeech = "名詞";
+    token.posTag = PartOfSpeech::Noun;
+    analysis.tokens.push_back(token);
+
+    FuriganaInfo info{};
+    info.baseText = surface;
+    info.reading = reading;
+    info.needsRuby = true;
+    analysis.furigana.push_back(info);
+    return analysis;
+}
+
+std::filesystem::path TempCachePath() {
+    const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    return std::filesystem::temp_directory_path() / "toriyomi_test" /
+           ("sentence_cache_" + std::to_string(stamp) + ".json");
+}
+
+}  // namespace
+
+TEST(SentenceAnalysisCacheTest, HitsAfterInsertWithNormalizedKey) {
+    SentenceAnalysisCache cache;
+    EXPECT_EQ(cache.Find("今日は"), nullptr);
+
+    cache.Insert("今日は\n", MakeAnalysis("今日", "キョウ"));
+    const auto hit = cache.Find("\xE3\x80\x80今日は ");
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ(hit->tokens[0].reading, "キョウ");
+
+    const auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_GT(stats.bytes, 0u);
+}
+
+TEST(SentenceAnalysisCacheTest, EvictsLeastRecentlyUsedWhenOverBudget) {
+    SentenceAnalysisCache cache;
+    cache.Insert("A", MakeAnalysis("A", "エー"));
+    const std::size_t entryBytes = cache.GetStats().bytes;
+
+    // 항목 두 개 분량만 허용
+    cache.SetMaxBytes(entryBytes * 2 + entryBytes / 2);
+    cache.Insert("B", MakeAnalysis("B", "ビー"));
+    ASSERT_NE(cache.Find("A"), nullptr);  // A를 최근 사용으로 갱신
+
+    cache.Insert("C", MakeAnalysis("C", "シー"));
+    EXPECT_NE(cache.Find("A"), nullptr);
+    EXPECT_EQ(cache.Find("B"), nullptr);
+    EXPECT_NE(cache.Find("C"), nullptr);
+    EXPECT_EQ(cache.GetStats().evictions, 1u);
+    EXPECT_LE(cache.GetStats().bytes, cache.GetStats().maxBytes);
+}
+
+TEST(SentenceAnalysisCacheTest, ResultOutlivesEviction) {
+    SentenceAnalysisCache cache;
+    cache.Insert("猫", MakeAnalysis("猫", "ネコ"));
+    const auto held = cache.Find("猫");
+    cache.Clear();
+    ASSERT_NE(held, nullptr);
+    EXPECT_EQ(held->tokens[0].surface, "猫");
+    EXPECT_EQ(cache.GetStats().entries, 0u);
+}
+
+TEST(SentenceAnalysisCacheTest, PersistsAndRestoresRecencyOrder) {
+    const auto path = TempCachePath();
+    {
+        SentenceAnalysisCache cache;
+        cache.Insert("古い", MakeAnalysis("古い", "フルイ"));
+        cache.Insert("新しい", MakeAnalysis("新しい", "アタラシイ"));
+        ASSERT_TRUE(cache.SaveToFile(path));
+    }
+
+    SentenceAnalysisCache restored;
+    ASSERT_TRUE(restored.LoadFromFile(path));
+    EXPECT_EQ(restored.GetStats().entries, 2u);
+
+    const auto hit = restored.Find("新しい");
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ(hit->tokens[0].posTag, PartOfSpeech::Noun);
+    ASSERT_EQ(hit->furigana.size(), 1u);
+    EXPECT_TRUE(hit->furigana[0].needsRuby);
+
+    // 전부는 못 들어가는 상한이면 가장 최근에 사용된 항목이 남음
+    SentenceAnalysisCache small(restored.GetStats().bytes - 1);
+    ASSERT_TRUE(small.LoadFromFile(path));
+    EXPECT_NE(small.Find("新しい"), nullptr);
+    EXPECT_EQ(small.Find("古い"), nullptr);
+
+    std::filesystem::remove(path);
+    EXPECT_FALSE(restored.LoadFromFile(path));
+}
+
+TEST(SentenceAnalysisCacheTest, RejectsEntriesFromAnotherDictionary) {
+    const auto path = TempCachePath();
+    {
+        SentenceAnalysisCache cache;
+        cache.SetSignature("game_0123.dic");
+        cache.Insert("翠星", MakeAnalysis("翠星", "スイセイ"));
+        ASSERT_TRUE(cache.SaveToFile(path));
+
+        // 같은 식별자면 유지, 바뀌면 비움
+        cache.SetSignature("game_0123.dic");
+        EXPECT_EQ(cache.GetStats().entries, 1u);
+        cache.SetSignature("game_4567.dic");
+        EXPECT_EQ(cache.GetStats().entries, 0u);
+    }
+
+    SentenceAnalysisCache systemOnly;
+    EXPECT_FALSE(systemOnly.LoadFromFile(path));
+    EXPECT_EQ(systemOnly.GetStats().entries, 0u);
+
+    SentenceAnalysisCache sameDictionary;
+    sameDictionary.SetSignature("game_0123.dic");
+    ASSERT_TRUE(sameDictionary.LoadFromFile(path));
+    EXPECT_NE(sameDictionary.Find("翠星"), nullptr);
+
+    std::filesystem::remove(path);
+}
+
+TEST(SentenceAnalysisCacheTest, MakesSafeFileNames) {
+    EXPECT_EQ(SentenceAnalysisCache::MakeCacheFileName("ゲーム: 第1章 <体験版>"), "ゲーム_ 第1章 _体験版_.json");
+    EXPECT_EQ(SentenceAnalysisCache::MakeCacheFileName(" ... "), "untitled.json");
+    EXPECT_LE(SentenceAnalysisCache::MakeCacheFileName(std::string(300, 'a')).size(), 125u);
+}
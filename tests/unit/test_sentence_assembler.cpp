@@ -0,0 +1,81 @@
+// ToriYomi - 문장 조립 단위 테스트
+
+#include "core/sentence/sentence_assembler.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi;
+using namespace toriyomi::sentence;
+
+namespace {
+
+ocr::TextSegment MakeSegment(const std::string& text, int x, int y, int width, int height,
+                             float confidence = 95.0f) {
+    ocr::TextSegment segment;
+    segment.text = text;
+    segment.boundingBox = cv::Rect(x, y, width, height);
+    segment.confidence = confidence;
+    return segment;
+}
+
+}  // namespace
+
+TEST(SentenceAssemblerTest, GroupsSegmentsIntoLines) {
+    SentenceAssembler assembler;
+    const std::vector<ocr::TextSegment> segments = {
+        MakeSegment("行こうか", 260, 140, 160, 40),
+        MakeSegment("　今日は天気がいいから", 40, 80, 400, 40),
+        MakeSegment("散歩に", 40, 140, 200, 40),
+    };
+
+    const auto sentence = assembler.AssembleFrame(segments);
+    ASSERT_TRUE(sentence.has_value());
+    EXPECT_EQ(*sentence, "今日は天気がいいから\n散歩に行こうか");
+}
+
+TEST(SentenceAssemblerTest, SkipsRubyNoiseAndLowConfidence) {
+    SentenceAssembler assembler;
+    std::vector<ocr::TextSegment> segments = {
+        MakeSegment("きょう", 40, 60, 60, 14),           // 今日 위 후리가나
+        MakeSegment("今日は晴れ", 40, 80, 300, 40),
+        MakeSegment("ゴミ", 400, 300, 60, 40, 30.0f),   // 낮은 신뢰도
+        MakeSegment("点", 500, 400, 10, 10),            // 너무 작음
+    };
+
+    auto sentence = assembler.AssembleFrame(segments);
+    ASSERT_TRUE(sentence.has_value());
+    EXPECT_EQ(*sentence, "今日は晴れ");
+
+    segments = {MakeSegment("Hello", 40, 80, 120, 40), MakeSegment("world", 170, 80, 120, 40)};
+    sentence = assembler.AssembleFrame(segments);
+    ASSERT_TRUE(sentence.has_value());
+    EXPECT_EQ(*sentence, "Hello world");
+
+    EXPECT_FALSE(assembler.AssembleFrame({}).has_value());
+}
+
+TEST(SentenceAssemblerTest, RequiresStableFramesAndSuppressesDuplicates) {
+    SentenceAssembler assembler;
+    assembler.SetCaptureIntervalSeconds(1.0);   // 안정 프레임 2개
+
+    const std::vector<ocr::TextSegment> frame = {MakeSegment("ラーメンを食べに行こう", 40, 80, 400, 40)};
+    const std::vector<ocr::TextSegment> jitter = {MakeSegment("ラ一メンを食べに行こう", 40, 80, 400, 40)};
+
+    EXPECT_FALSE(assembler.TryAssemble(frame).has_value());
+    // 한 글자 흔들림은 같은 문장으로 이어서 셈
+    const auto sentence = assembler.TryAssemble(jitter);
+    ASSERT_TRUE(sentence.has_value());
+    EXPECT_EQ(*sentence, "ラ一メンを食べに行こう");
+
+    assembler.MarkSentencePublished(*sentence);
+    EXPECT_TRUE(assembler.IsDuplicate("ラーメンを食べに行こう"));
+    EXPECT_FALSE(assembler.TryAssemble(frame).has_value());
+    EXPECT_FALSE(assembler.TryAssemble(frame).has_value());
+
+    assembler.MarkSentenceInFlight("それじゃあまた明日");
+    EXPECT_TRUE(assembler.IsDuplicate("それじゃあまた明日"));
+    assembler.ClearSentenceInFlight("それじゃあまた明日");
+    EXPECT_FALSE(assembler.IsDuplicate("それじゃあまた明日"));
+
+    assembler.Reset();
+    EXPECT_FALSE(assembler.IsDuplicate("ラーメンを食べに行こう"));
+}
@@ -0,0 +1,85 @@
+// ToriYomi - 문장 유사도 단위 테스트
+
+#include "core/sentence/sentence_similarity.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace toriyomi::sentence;
+
+namespace {
+
+std::size_t ReferenceDistance(std::u32string_view a, std::u32string_view b) {
+    std::vector<std::size_t> row(b.size() + 1);
+    for (std::size_t j = 0; j <= b.size(); ++j) {
+        row[j] = j;
+    }
+    for (std::size_t i = 1; i <= a.size(); ++i) {
+        std::size_t diagonal = row[0];
+        row[0] = i;
+        for (std::size_t j = 1; j <= b.size(); ++j) {
+            const std::size_t above = row[j];
+            row[j] = std::min({above + 1, row[j - 1] + 1, diagonal + (a[i - 1] == b[j - 1] ? 0 : 1)});
+            diagonal = above;
+        }
+    }
+    return row[b.size()];
+}
+
+}  // namespace
+
+TEST(SentenceSimilarityTest, ComputesEditDistance) {
+    EXPECT_EQ(EditDistanceUtf8("", ""), 0u);
+    EXPECT_EQ(EditDistanceUtf8("", "今日は"), 3u);
+    EXPECT_EQ(EditDistanceUtf8("今日は", "今日は"), 0u);
+    EXPECT_EQ(EditDistanceUtf8("ちょっと待って", "ちょつと待って"), 1u);
+    EXPECT_EQ(EditDistanceUtf8("kitten", "sitting"), 3u);
+    EXPECT_EQ(EditDistanceUtf8("sitting", "kitten"), 3u);
+}
+
+TEST(SentenceSimilarityTest, MatchesReferenceAcrossBlocks) {
+    // 64글자를 넘는 패턴(여러 블록)까지 DP 결과와 비교
+    std::mt19937 rng(42);
+    const std::u32string alphabet = U"あいうえおかきくけこー一っつ";
+    std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+    std::uniform_int_distribution<std::size_t> length(0, 200);
+
+    for (int trial = 0; trial < 200; ++trial) {
+        std::u32string a(length(rng), U' ');
+        std::u32string b(length(rng), U' ');
+        for (auto& ch : a) ch = alphabet[pick(rng)];
+        for (auto& ch : b) ch = alphabet[pick(rng)];
+        ASSERT_EQ(EditDistance(a, b), ReferenceDistance(a, b)) << "trial " << trial;
+    }
+}
+
+TEST(SentenceSimilarityTest, DetectsOcrJitter) {
+    EXPECT_TRUE(IsNearDuplicateUtf8("ラーメンを食べに行こう", "ラ一メンを食べに行こう"));
+    EXPECT_FALSE(IsNearDuplicateUtf8("今日は晴れ", "明日は雨だ"));
+    // 짧은 문장은 정확히 같아야 함
+    EXPECT_FALSE(IsNearDuplicateUtf8("はい", "はぃ"));
+    EXPECT_TRUE(IsNearDuplicateUtf8("はい", "はい"));
+
+    SimilarityOptions strict;
+    strict.minAllowedEdits = 0;
+    strict.maxEditRatio = 0.0;
+    EXPECT_FALSE(IsNearDuplicateUtf8("ラーメンを食べに行こう", "ラ一メンを食べに行こう", strict));
+}
+
+TEST(SentenceSimilarityTest, HistoryRemembersRecentSentences) {
+    RecentSentenceHistory history(2);
+    history.Add("おはようございます");
+    history.Add("今日もいい天気ですね");
+    EXPECT_TRUE(history.ContainsSimilar("おはようござぃます"));
+    EXPECT_TRUE(history.ContainsSimilar("今日もいい天気ですね"));
+    EXPECT_FALSE(history.ContainsSimilar("それじゃあ行こうか"));
+
+    // 용량을 넘으면 가장 오래된 문장부터 잊음
+    history.Add("それじゃあ行こうか");
+    EXPECT_EQ(history.Size(), 2u);
+    EXPECT_FALSE(history.ContainsSimilar("おはようございます"));
+
+    history.Clear();
+    EXPECT_FALSE(history.ContainsSimilar("それじゃあ行こうか"));
+}
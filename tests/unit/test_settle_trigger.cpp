@@ -0,0 +1,96 @@
+// ToriYomi - 화면 안정 시 OCR 트리거 단위 테스트
+
+#include "core/pipeline/settle_trigger.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::pipeline;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Clock = SettleTrigger::Clock;
+
+SettleTriggerOptions TestOptions() {
+    SettleTriggerOptions options;
+    options.settleTime = 200ms;
+    options.fallbackInterval = 5000ms;
+    return options;
+}
+
+}  // namespace
+
+TEST(SettleTriggerTest, FiresOnceAfterChangeBurstSettles) {
+    SettleTrigger trigger(TestOptions());
+    const Clock::time_point start{};
+
+    // 글자가 나타나는 동안은 요청하지 않음
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(trigger.Update(true, start + i * 100ms), TriggerReason::None);
+    }
+    const Clock::time_point lastChange = start + 400ms;
+
+    // 멈춘 직후 프레임은 아직 안정 시간 전
+    EXPECT_EQ(trigger.Update(false, lastChange + 100ms), TriggerReason::None);
+    EXPECT_EQ(trigger.Update(false, lastChange + 200ms), TriggerReason::Settled);
+
+    // 같은 화면은 다시 읽지 않음
+    EXPECT_EQ(trigger.Update(false, lastChange + 300ms), TriggerReason::None);
+    EXPECT_EQ(trigger.Update(false, lastChange + 1000ms), TriggerReason::None);
+
+    const auto stats = trigger.GetStats();
+    EXPECT_EQ(stats.framesSeen, 9u);
+    EXPECT_EQ(stats.changedFrames, 5u);
+    EXPECT_EQ(stats.settledTriggers, 1u);
+    EXPECT_EQ(stats.framesHeld, 8u);
+}
+
+TEST(SettleTriggerTest, NextBurstTriggersAgain) {
+    SettleTrigger trigger(TestOptions());
+    const Clock::time_point start{};
+
+    trigger.Update(true, start);
+    EXPECT_EQ(trigger.Update(false, start + 250ms), TriggerReason::Settled);
+
+    trigger.Update(true, start + 1000ms);
+    trigger.Update(true, start + 1100ms);
+    EXPECT_EQ(trigger.Update(false, start + 1250ms), TriggerReason::None);
+    EXPECT_EQ(trigger.Update(false, start + 1300ms), TriggerReason::Settled);
+    EXPECT_EQ(trigger.GetStats().settledTriggers, 2u);
+}
+
+TEST(SettleTriggerTest, FallbackFiresWhenNeverSettlingOrLongStatic) {
+    SettleTrigger trigger(TestOptions());
+    const Clock::time_point start{};
+
+    // 계속 바뀌는 화면(애니메이션)도 주기마다 한 번은 읽음
+    Clock::time_point now = start;
+    int fallbacks = 0;
+    for (; now <= start + 10000ms; now += 250ms) {
+        if (trigger.Update(true, now) == TriggerReason::Fallback) {
+            ++fallbacks;
+        }
+    }
+    EXPECT_EQ(fallbacks, 2);
+
+    // 오래 그대로인 화면도 주기마다 다시 읽음
+    EXPECT_EQ(trigger.Update(false, now), TriggerReason::Settled);
+    EXPECT_EQ(trigger.Update(false, now + 4000ms), TriggerReason::None);
+    EXPECT_EQ(trigger.Update(false, now + 5000ms), TriggerReason::Fallback);
+    EXPECT_EQ(trigger.GetStats().fallbackTriggers, 3u);
+}
+
+TEST(SettleTriggerTest, DisabledFallbackAndReset) {
+    SettleTriggerOptions options = TestOptions();
+    options.fallbackInterval = 0ms;
+    SettleTrigger trigger(options);
+    const Clock::time_point start{};
+
+    trigger.Update(true, start);
+    EXPECT_EQ(trigger.Update(false, start + 200ms), TriggerReason::Settled);
+    EXPECT_EQ(trigger.Update(false, start + 60000ms), TriggerReason::None);
+
+    // 초기화하면 이전 변화는 잊음
+    trigger.Update(true, start + 61000ms);
+    trigger.Reset();
+    EXPECT_EQ(trigger.Update(false, start + 62000ms), TriggerReason::None);
+}
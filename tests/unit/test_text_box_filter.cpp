@@ -0,0 +1,110 @@
+#include "core/ocr/text_box_filter.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::ocr;
+
+namespace {
+const cv::Size kImageSize(1280, 720);
+}
+
+TEST(TextBoxFilterTest, KeepsRegularLines) {
+    TextBoxFilter filter;
+    std::vector<cv::Rect> boxes = {
+        cv::Rect(100, 500, 800, 40),
+        cv::Rect(100, 560, 600, 40),
+    };
+
+    auto kept = filter.Apply(boxes, kImageSize);
+    ASSERT_EQ(kept.size(), 2u);
+    EXPECT_EQ(kept[0], 0u);
+    EXPECT_EQ(kept[1], 1u);
+}
+
+TEST(TextBoxFilterTest, RejectsTinyAndThinBoxes) {
+    TextBoxFilter filter;
+    std::vector<cv::Rect> boxes = {
+        cv::Rect(10, 10, 12, 12),      // 면적 미달
+        cv::Rect(10, 100, 1200, 4),    // 너무 얇음
+        cv::Rect(10, 200, 1200, 20),   // 종횡비 60
+    };
+
+    auto reasons = filter.Evaluate(boxes, kImageSize);
+    EXPECT_EQ(reasons[0], BoxRejectReason::Area);
+    EXPECT_EQ(reasons[1], BoxRejectReason::Area);
+    EXPECT_EQ(reasons[2], BoxRejectReason::Aspect);
+}
+
+TEST(TextBoxFilterTest, DropsRubyDirectlyAboveLine) {
+    TextBoxFilter filter;
+    std::vector<cv::Rect> boxes = {
+        cv::Rect(220, 482, 48, 16),    // 루비 (라인 바로 위)
+        cv::Rect(100, 500, 800, 40),   // 본문 라인
+    };
+
+    auto reasons = filter.Evaluate(boxes, kImageSize);
+    EXPECT_EQ(reasons[0], BoxRejectReason::Ruby);
+    EXPECT_EQ(reasons[1], BoxRejectReason::None);
+}
+
+TEST(TextBoxFilterTest, KeepsSmallBoxFarAboveLine) {
+    TextBoxFilter filter;
+    std::vector<cv::Rect> boxes = {
+        cv::Rect(220, 300, 48, 16),    // 라인과 멀리 떨어진 작은 박스 (이름표 등)
+        cv::Rect(100, 500, 800, 40),
+    };
+
+    auto reasons = filter.Evaluate(boxes, kImageSize);
+    EXPECT_EQ(reasons[0], BoxRejectReason::None);
+}
+
+TEST(TextBoxFilterTest, RubyRuleCanBeDisabled) {
+    TextBoxFilterConfig config;
+    config.dropRuby = false;
+    TextBoxFilter filter(config);
+    std::vector<cv::Rect> boxes = {
+        cv::Rect(220, 482, 48, 16),
+        cv::Rect(100, 500, 800, 40),
+    };
+
+    EXPECT_EQ(filter.Apply(boxes, kImageSize).size(), 2u);
+}
+
+TEST(TextBoxFilterTest, RejectsBoxesOutsideRoi) {
+    TextBoxFilterConfig config;
+    config.roiY = 0.5f;
+    config.roiHeight = 0.5f;
+    TextBoxFilter filter(config);
+    std::vector<cv::Rect> boxes = {
+        cv::Rect(20, 20, 200, 30),     // 상단 UI 영역
+        cv::Rect(100, 500, 800, 40),   // 대사창
+    };
+
+    auto reasons = filter.Evaluate(boxes, kImageSize);
+    EXPECT_EQ(reasons[0], BoxRejectReason::OutsideRoi);
+    EXPECT_EQ(reasons[1], BoxRejectReason::None);
+}
+
+TEST(TextBoxFilterTest, AppliesCustomRules) {
+    TextBoxFilter filter;
+    filter.AddRule("right-edge", [](std::size_t index, const std::vector<cv::Rect>& boxes,
+                                     const cv::Size& imageSize) {
+        return boxes[index].x > imageSize.width * 3 / 4;
+    });
+    std::vector<cv::Rect> boxes = {
+        cv::Rect(100, 500, 800, 40),
+        cv::Rect(1100, 20, 100, 30),
+    };
+
+    auto reasons = filter.Evaluate(boxes, kImageSize);
+    EXPECT_EQ(reasons[0], BoxRejectReason::None);
+    EXPECT_EQ(reasons[1], BoxRejectReason::Custom);
+}
+
+TEST(TextBoxFilterTest, DisabledFilterKeepsEverything) {
+    TextBoxFilterConfig config;
+    config.enabled = false;
+    TextBoxFilter filter(config);
+    std::vector<cv::Rect> boxes = {cv::Rect(0, 0, 1, 1)};
+
+    EXPECT_EQ(filter.Apply(boxes, kImageSize).size(), 1u);
+}
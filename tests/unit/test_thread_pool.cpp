@@ -0,0 +1,48 @@
+// ToriYomi - 스레드 풀 단위 테스트
+
+#include "common/concurrency/thread_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <vector>
+
+using toriyomi::concurrency::ThreadPool;
+
+TEST(ThreadPoolTest, RunsSubmittedTasks) {
+    std::atomic<int> sum{0};
+    {
+        ThreadPool pool(3);
+        EXPECT_EQ(pool.ThreadCount(), 3u);
+        for (int i = 1; i <= 100; ++i) {
+            pool.Submit([&sum, i]() { sum += i; });
+        }
+    }
+    // 소멸 시 남은 작업까지 실행
+    EXPECT_EQ(sum.load(), 5050);
+}
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+    std::vector<int> visits(1000, 0);
+    pool.ParallelFor(visits.size(), [&](std::size_t i) { ++visits[i]; });
+    for (int count : visits) {
+        ASSERT_EQ(count, 1);
+    }
+
+    pool.ParallelFor(0, [](std::size_t) { FAIL(); });
+}
+
+TEST(ThreadPoolTest, NestedParallelForDoesNotDeadlock) {
+    ThreadPool pool(2);
+    std::atomic<int> total{0};
+    std::promise<void> finished;
+    pool.Submit([&]() {
+        // 풀 스레드 안에서 다시 ParallelFor (모든 작업 스레드가 바빠도 호출 스레드가 처리)
+        pool.ParallelFor(8, [&](std::size_t) {
+            pool.ParallelFor(8, [&](std::size_t) { ++total; });
+        });
+        finished.set_value();
+    });
+    ASSERT_EQ(finished.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(total.load(), 64);
+}
@@ -0,0 +1,128 @@
+// ToriYomi - 타일 분할 검출 단위 테스트
+
+#include "core/ocr/tiled_detection.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+using namespace toriyomi::ocr;
+
+namespace {
+
+TiledDetectionConfig EnabledConfig() {
+    TiledDetectionConfig config;
+    config.enabled = true;
+    config.tileSize = 1280;
+    config.overlap = 192;
+    config.minFrameSide = 1600;
+    return config;
+}
+
+DetectionQuad Box(float x, float y, float width, float height) {
+    return {cv::Point2f(x, y), cv::Point2f(x + width - 1, y),
+            cv::Point2f(x + width - 1, y + height - 1), cv::Point2f(x, y + height - 1)};
+}
+
+cv::Rect BoundsOf(const DetectionQuad& quad) {
+    float minX = quad[0].x, maxX = quad[0].x, minY = quad[0].y, maxY = quad[0].y;
+    for (const auto& point : quad) {
+        minX = std::min(minX, point.x);
+        maxX = std::max(maxX, point.x);
+        minY = std::min(minY, point.y);
+        maxY = std::max(maxY, point.y);
+    }
+    return cv::Rect(static_cast<int>(minX), static_cast<int>(minY),
+                    static_cast<int>(maxX - minX) + 1, static_cast<int>(maxY - minY) + 1);
+}
+
+}  // namespace
+
+TEST(TiledDetectionTest, SmallFramesAreNotTiled) {
+    const auto tiles = PlanDetectionTiles(cv::Size(1280, 720), EnabledConfig());
+    ASSERT_EQ(tiles.size(), 1u);
+    EXPECT_EQ(tiles[0], cv::Rect(0, 0, 1280, 720));
+
+    TiledDetectionConfig disabled = EnabledConfig();
+    disabled.enabled = false;
+    EXPECT_EQ(PlanDetectionTiles(cv::Size(3840, 2160), disabled).size(), 1u);
+}
+
+TEST(TiledDetectionTest, TilesCoverFrameWithOverlapAndEqualSize) {
+    const cv::Size frame(3840, 2160);
+    const auto tiles = PlanDetectionTiles(frame, EnabledConfig());
+    ASSERT_GT(tiles.size(), 1u);
+
+    int coveredRight = 0;
+    int coveredBottom = 0;
+    for (const auto& tile : tiles) {
+        EXPECT_EQ(tile.size(), cv::Size(1280, 1280));
+        EXPECT_GE(tile.x, 0);
+        EXPECT_GE(tile.y, 0);
+        EXPECT_LE(tile.x + tile.width, frame.width);
+        EXPECT_LE(tile.y + tile.height, frame.height);
+        coveredRight = std::max(coveredRight, tile.x + tile.width);
+        coveredBottom = std::max(coveredBottom, tile.y + tile.height);
+    }
+    EXPECT_EQ(coveredRight, frame.width);
+    EXPECT_EQ(coveredBottom, frame.height);
+
+    // 같은 행의 이웃 타일은 overlap 이상 겹침
+    EXPECT_EQ(tiles[0].y, tiles[1].y);
+    EXPECT_GE(tiles[0].x + tiles[0].width - tiles[1].x, 192);
+}
+
+TEST(TiledDetectionTest, DeduplicatesBoxSeenByBothTiles) {
+    const cv::Size frame(2300, 1000);
+    const auto tiles = PlanDetectionTiles(frame, EnabledConfig());
+    ASSERT_EQ(tiles.size(), 2u);
+
+    // 겹침 영역 안의 짧은 라인 (프레임 x = 1150 ~ 1230)
+    const float x = 1150.0f;
+    std::vector<std::vector<DetectionQuad>> polys = {
+        {Box(x - tiles[0].x, 300, 80, 30)},
+        {Box(x - tiles[1].x, 300, 80, 30)},
+    };
+
+    const auto merged = MergeTiledDetections(polys, tiles, frame, EnabledConfig());
+    ASSERT_EQ(merged.size(), 1u);
+    EXPECT_EQ(BoundsOf(merged[0]), cv::Rect(1150, 300, 80, 30));
+}
+
+TEST(TiledDetectionTest, JoinsLineCutAtSeam) {
+    const cv::Size frame(2300, 1000);
+    const auto tiles = PlanDetectionTiles(frame, EnabledConfig());
+    ASSERT_EQ(tiles.size(), 2u);
+    const int seamLeft = tiles[1].x;                        // 두 번째 타일 시작
+    const int seamRight = tiles[0].x + tiles[0].width;      // 첫 번째 타일 끝
+
+    // 프레임 x = 900 ~ 1700 라인이 양쪽 타일에서 잘려서 검출됨
+    std::vector<std::vector<DetectionQuad>> polys = {
+        {Box(900, 500, static_cast<float>(seamRight - 900), 32)},
+        {Box(0, 502, static_cast<float>(1700 - seamLeft), 30)},
+    };
+
+    const auto merged = MergeTiledDetections(polys, tiles, frame, EnabledConfig());
+    ASSERT_EQ(merged.size(), 1u);
+    const cv::Rect bounds = BoundsOf(merged[0]);
+    EXPECT_EQ(bounds.x, 900);
+    EXPECT_EQ(bounds.x + bounds.width, 1700);
+    EXPECT_EQ(bounds.y, 500);
+}
+
+TEST(TiledDetectionTest, KeepsUnrelatedBoxesAndTheirShape) {
+    const cv::Size frame(2300, 1000);
+    const auto tiles = PlanDetectionTiles(frame, EnabledConfig());
+    ASSERT_EQ(tiles.size(), 2u);
+
+    const DetectionQuad rotated = {cv::Point2f(100, 110), cv::Point2f(300, 100),
+                                   cv::Point2f(302, 130), cv::Point2f(102, 140)};
+    std::vector<std::vector<DetectionQuad>> polys = {
+        {rotated, Box(400, 800, 200, 30)},
+        {Box(900, 100, 200, 30)},
+    };
+
+    const auto merged = MergeTiledDetections(polys, tiles, frame, EnabledConfig());
+    ASSERT_EQ(merged.size(), 3u);
+    EXPECT_EQ(merged[0][1].x, 300.0f);
+    EXPECT_EQ(merged[0][1].y, 100.0f);
+    EXPECT_EQ(BoundsOf(merged[2]).x, tiles[1].x + 900);
+}
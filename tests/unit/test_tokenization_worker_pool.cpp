@@ -0,0 +1,161 @@
+// ToriYomi - 형태소 분석 작업 풀 단위 테스트
+
+#include "core/pipeline/tokenization_worker_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <vector>
+
+using namespace toriyomi::pipeline;
+
+namespace {
+
+/**
+ * @brief 작업 스레드 하나를 막아 두고 큐 동작을 확인하기 위한 도우미
+ */
+class Blocker {
+public:
+    TokenizationJob Job() {
+        TokenizationJob job;
+        job.key = 0;
+        job.run = [this]() {
+            started_.set_value();
+            release_.get_future().wait();
+        };
+        return job;
+    }
+
+    void WaitStarted() { started_.get_future().wait(); }
+    void Release() { release_.set_value(); }
+
+private:
+    std::promise<void> started_;
+    std::promise<void> release_;
+};
+
+void WaitForCompleted(const TokenizationWorkerPool& pool, std::uint64_t count) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool.GetMetrics().completed < count && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+}  // namespace
+
+TEST(TokenizationWorkerPoolTest, RunsFinalsInOrderAndSupersedesPartials) {
+    TokenizationWorkerPoolOptions options;
+    options.workerCount = 1;
+    TokenizationWorkerPool pool(options);
+
+    Blocker blocker;
+    pool.Submit(blocker.Job());
+    blocker.WaitStarted();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::vector<std::string> cancelled;
+    auto makeJob = [&](std::uint64_t key, bool partial, std::string name) {
+        TokenizationJob job;
+        job.key = key;
+        job.supersedable = partial;
+        job.run = [&, name]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+        job.cancel = [&, name]() { cancelled.push_back(name); };
+        return job;
+    };
+
+    pool.Submit(makeJob(1, true, "1-partial"));
+    pool.Submit(makeJob(1, false, "1-final"));      // 1-partial 취소
+    pool.Submit(makeJob(2, true, "2-partial-a"));
+    pool.Submit(makeJob(2, true, "2-partial-b"));   // 2-partial-a 취소
+    pool.Submit(makeJob(3, false, "3-final"));      // 2-partial-b 취소
+    pool.Submit(makeJob(9, true, "9-partial"));
+    pool.Submit(makeJob(4, false, "4-final"));      // 더 새 문장의 부분 작업은 그대로
+    EXPECT_EQ(cancelled, (std::vector<std::string>{"1-partial", "2-partial-a", "2-partial-b"}));
+    EXPECT_EQ(pool.GetMetrics().queueDepth, 4u);
+
+    blocker.Release();
+    WaitForCompleted(pool, 5);
+    pool.Shutdown();
+
+    // 확정 작업은 들어온 순서대로 먼저, 부분 작업은 그 뒤에
+    EXPECT_EQ(order, (std::vector<std::string>{"1-final", "3-final", "4-final", "9-partial"}));
+    const auto metrics = pool.GetMetrics();
+    EXPECT_EQ(metrics.submitted, 8u);
+    EXPECT_EQ(metrics.completed, 5u);
+    EXPECT_EQ(metrics.superseded, 3u);
+    EXPECT_EQ(metrics.dropped, 0u);
+    EXPECT_GT(metrics.maxLatencyMs, 0.0);
+}
+
+TEST(TokenizationWorkerPoolTest, BoundsQueueDepth) {
+    TokenizationWorkerPoolOptions options;
+    options.workerCount = 1;
+    options.maxQueueDepth = 2;
+    TokenizationWorkerPool pool(options);
+
+    Blocker blocker;
+    pool.Submit(blocker.Job());
+    blocker.WaitStarted();
+
+    std::vector<std::uint64_t> cancelled;
+    auto submit = [&](std::uint64_t key, bool partial) {
+        TokenizationJob job;
+        job.key = key;
+        job.supersedable = partial;
+        job.cancel = [&cancelled, key]() { cancelled.push_back(key); };
+        pool.Submit(std::move(job));
+    };
+    // 확정 작업은 상한과 관계없이 모두 대기
+    for (std::uint64_t key = 1; key <= 4; ++key) {
+        submit(key, false);
+    }
+    EXPECT_TRUE(cancelled.empty());
+
+    // 부분 작업은 상한을 넘으면 가장 오래된 것부터 버림
+    for (std::uint64_t key = 40; key >= 10; key -= 10) {
+        submit(key, true);
+    }
+    EXPECT_EQ(cancelled, (std::vector<std::uint64_t>{40, 30}));
+    const auto metrics = pool.GetMetrics();
+    EXPECT_EQ(metrics.queueDepth, 6u);
+    EXPECT_EQ(metrics.peakQueueDepth, 6u);
+    EXPECT_EQ(metrics.dropped, 2u);
+
+    blocker.Release();
+    WaitForCompleted(pool, 7);
+    pool.Shutdown();
+    EXPECT_EQ(cancelled.size(), 2u);
+    EXPECT_EQ(pool.GetMetrics().completed, 7u);
+}
+
+TEST(TokenizationWorkerPoolTest, CancelsPendingJobsOnShutdown) {
+    TokenizationWorkerPoolOptions options;
+    options.workerCount = 1;
+    TokenizationWorkerPool pool(options);
+
+    Blocker blocker;
+    pool.Submit(blocker.Job());
+    blocker.WaitStarted();
+
+    std::atomic<int> ran{0};
+    std::atomic<int> cancelled{0};
+    TokenizationJob job;
+    job.key = 1;
+    job.run = [&]() { ++ran; };
+    job.cancel = [&]() { ++cancelled; };
+    pool.Submit(job);
+
+    blocker.Release();
+    pool.Shutdown();
+    EXPECT_EQ(ran.load() + cancelled.load(), 1);
+
+    // 종료 후 제출은 거부하고 취소 콜백 호출
+    EXPECT_FALSE(pool.Submit(job));
+    EXPECT_EQ(ran.load() + cancelled.load(), 2);
+}
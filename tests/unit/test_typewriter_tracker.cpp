@@ -0,0 +1,118 @@
+// ToriYomi - 타자기 효과 추적 단위 테스트
+
+#include "core/sentence/typewriter_tracker.h"
+#include <gtest/gtest.h>
+
+using namespace toriyomi::sentence;
+using namespace std::chrono_literals;
+using Kind = TypewriterEvent::Kind;
+
+namespace {
+
+class TypewriterTrackerTest : public ::testing::Test {
+protected:
+    std::vector<TypewriterEvent> Feed(std::string_view text, std::chrono::milliseconds elapsed = 100ms) {
+        now_ += elapsed;
+        return tracker_.Update(text, now_);
+    }
+
+    TypewriterTracker tracker_;
+    TypewriterTracker::Clock::time_point now_{};
+};
+
+}  // namespace
+
+TEST_F(TypewriterTrackerTest, EmitsPartialsWhileTextGrows) {
+    EXPECT_TRUE(Feed("今").empty());   // minPartialChars 미만
+
+    auto events = Feed("今日は");
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Partial);
+    EXPECT_EQ(events[0].text, "今日は");
+    const auto id = events[0].sentenceId;
+
+    EXPECT_TRUE(Feed("今日は良").empty());   // partialStepChars만큼 늘지 않음
+    events = Feed("今日は良い天");
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Partial);
+    EXPECT_EQ(events[0].sentenceId, id);
+
+    // 멈춘 뒤 settleTime이 지나야 확정
+    EXPECT_TRUE(Feed("今日は良い天気", 100ms).empty());
+    EXPECT_TRUE(Feed("今日は良い天気", 500ms).empty());
+    events = Feed("今日は良い天気", 700ms);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Final);
+    EXPECT_EQ(events[0].text, "今日は良い天気");
+    EXPECT_EQ(events[0].sentenceId, id);
+    EXPECT_FALSE(events[0].revision);
+
+    // 확정 후 같은 텍스트는 더 이상 이벤트 없음
+    EXPECT_TRUE(Feed("今日は良い天気", 2000ms).empty());
+}
+
+TEST_F(TypewriterTrackerTest, FinalizesOnTerminalPunctuationAndRevises) {
+    Feed("そうだね");
+    auto events = Feed("そうだね。");
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Final);
+    const auto id = events[0].sentenceId;
+
+    // 같은 상자에서 다음 문장이 이어지면 같은 문장의 개정으로 다시 확정
+    events = Feed("そうだね。また明日");
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Partial);
+    EXPECT_TRUE(events[0].revision);
+    events = Feed("そうだね。また明日！");
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Final);
+    EXPECT_TRUE(events[0].revision);
+    EXPECT_EQ(events[0].sentenceId, id);
+}
+
+TEST_F(TypewriterTrackerTest, DistinguishesNewSentenceFromExtension) {
+    Feed("彼は東京へ");
+    auto events = Feed("明日");
+    // 이전 미확정 문장을 확정하고 새 문장 시작
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].kind, Kind::Final);
+    EXPECT_EQ(events[0].text, "彼は東京へ");
+    EXPECT_EQ(events[1].kind, Kind::Partial);
+    EXPECT_EQ(events[1].text, "明日");
+    EXPECT_NE(events[0].sentenceId, events[1].sentenceId);
+
+    // 텍스트 상자가 사라지면 확정
+    events = Feed("");
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Final);
+    EXPECT_EQ(events[0].text, "明日");
+    EXPECT_TRUE(Feed("").empty());
+}
+
+TEST_F(TypewriterTrackerTest, ToleratesOcrNoise) {
+    EXPECT_TRUE(TypewriterTracker::IsExtension("今日は良い天気です", "今日は艮い天気ですね"));
+    EXPECT_FALSE(TypewriterTracker::IsExtension("今日は", "今日わ良い"));
+    EXPECT_FALSE(TypewriterTracker::IsExtension("今日は", "今日は"));
+    EXPECT_FALSE(TypewriterTracker::IsExtension("", "今日は"));
+
+    Feed("今日は良い天気");
+    // 뒤 글자를 놓친 프레임은 무시
+    EXPECT_TRUE(Feed("今日は良い").empty());
+    const auto events = tracker_.Flush();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].text, "今日は良い天気");
+    EXPECT_TRUE(tracker_.Flush().empty());
+}
+
+TEST_F(TypewriterTrackerTest, TreatsSameLengthJitterAsSameSentence) {
+    auto events = Feed("ラーメンを食べに行こう");
+    ASSERT_EQ(events.size(), 1u);
+    const auto id = events[0].sentenceId;
+
+    // 한 글자만 다르게 읽힌 프레임은 새 문장이 아니며 안정 시간도 이어서 셈
+    EXPECT_TRUE(Feed("ラ一メンを食べに行こう", 600ms).empty());
+    events = Feed("ラーメンを食べに行こう", 600ms);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].kind, Kind::Final);
+    EXPECT_EQ(events[0].sentenceId, id);
+}
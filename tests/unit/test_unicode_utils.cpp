@@ -0,0 +1,98 @@
+// ToriYomi - UTF-8 문자 분류 유틸리티 단위 테스트
+
+#include "common/text/unicode_utils.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace toriyomi::text;
+
+static_assert(ClassifyCodePoint(U'あ') == Script::Hiragana);
+static_assert(ClassifyCodePoint(U'ア') == Script::Katakana);
+static_assert(ClassifyCodePoint(U'漢') == Script::Kanji);
+
+TEST(UnicodeUtilsTest, ClassifiesJapaneseScripts) {
+    EXPECT_EQ(ClassifyCodePoint(U'a'), Script::Ascii);
+    EXPECT_EQ(ClassifyCodePoint(U'ー'), Script::Katakana);
+    EXPECT_EQ(ClassifyCodePoint(U'々'), Script::Kanji);
+    EXPECT_EQ(ClassifyCodePoint(U'、'), Script::Punctuation);
+    EXPECT_EQ(ClassifyCodePoint(U'・'), Script::Punctuation);
+    EXPECT_EQ(ClassifyCodePoint(U'ｱ'), Script::HalfwidthKatakana);
+    EXPECT_EQ(ClassifyCodePoint(U'！'), Script::Fullwidth);
+    EXPECT_EQ(ClassifyCodePoint(U'𠮷'), Script::Kanji);
+    EXPECT_EQ(ClassifyCodePoint(U'한'), Script::Other);
+
+    EXPECT_TRUE(IsKana(U'ぁ'));
+    EXPECT_TRUE(IsKana(U'ｶ'));
+    EXPECT_FALSE(IsKana(U'漢'));
+    EXPECT_TRUE(IsJapaneseScript(U'。'));
+    EXPECT_FALSE(IsJapaneseScript(U'é'));
+}
+
+TEST(UnicodeUtilsTest, DecodesAndRejectsInvalidUtf8) {
+    const std::string text = "aé漢𠮷";
+    std::size_t pos = 0;
+    EXPECT_EQ(DecodeUtf8(text, pos), U'a');
+    EXPECT_EQ(DecodeUtf8(text, pos), U'é');
+    EXPECT_EQ(DecodeUtf8(text, pos), U'漢');
+    EXPECT_EQ(DecodeUtf8(text, pos), U'𠮷');
+    EXPECT_EQ(pos, text.size());
+
+    // 잘린 시퀀스, 과잉 인코딩은 U+FFFD + 1바이트 전진
+    const std::string broken = "\xE6\xBC" "\xC0\xAF";
+    pos = 0;
+    EXPECT_EQ(DecodeUtf8(broken, pos), kReplacementCharacter);
+    EXPECT_EQ(pos, 1u);
+    pos = 2;
+    EXPECT_EQ(DecodeUtf8(broken, pos), kReplacementCharacter);
+    EXPECT_EQ(pos, 3u);
+
+    std::string encoded;
+    AppendUtf8(encoded, U'a');
+    AppendUtf8(encoded, U'é');
+    AppendUtf8(encoded, U'漢');
+    AppendUtf8(encoded, U'𠮷');
+    EXPECT_EQ(encoded, text);
+}
+
+TEST(UnicodeUtilsTest, SkipsAsciiRuns) {
+    const std::string ascii(40, 'x');
+    EXPECT_EQ(AsciiPrefixLength(ascii), 40u);
+    EXPECT_EQ(AsciiPrefixLength(ascii + "漢"), 40u);
+    EXPECT_EQ(AsciiPrefixLength(std::string(17, 'x') + "あ" + ascii), 17u);
+    EXPECT_EQ(AsciiPrefixLength(""), 0u);
+
+    EXPECT_TRUE(ContainsKanji(ascii + "今日" + ascii));
+    EXPECT_FALSE(ContainsKanji(ascii + "カタカナ"));
+    EXPECT_TRUE(ContainsScript("abcｱ", Script::HalfwidthKatakana));
+}
+
+TEST(UnicodeUtilsTest, ConvertsKatakanaInPlace) {
+    EXPECT_EQ(KatakanaToHiragana("キョウ"), "きょう");
+    EXPECT_EQ(KatakanaToHiragana("ヴァイオリン"), "ゔぁいおりん");
+    // 장음 부호, 가운뎃점, 한자, ASCII는 유지
+    EXPECT_EQ(KatakanaToHiragana("ラーメン・A定食"), "らーめん・A定食");
+    EXPECT_EQ(KatakanaToHiragana("ヽヾ"), "ゝゞ");
+
+    std::string invalid = "\xE3\x82" "ア";
+    KatakanaToHiraganaInPlace(invalid);
+    EXPECT_EQ(invalid, "\xE3\x82" "あ");
+}
+
+TEST(UnicodeUtilsTest, ConvertsHiraganaInPlace) {
+    EXPECT_EQ(HiraganaToKatakana("きょう"), "キョウ");
+    EXPECT_EQ(HiraganaToKatakana("ゔぁいおりん"), "ヴァイオリン");
+    EXPECT_EQ(HiraganaToKatakana("らーめん・A定食"), "ラーメン・A定食");
+    EXPECT_EQ(HiraganaToKatakana("ゝゞ"), "ヽヾ");
+    EXPECT_EQ(KatakanaToHiragana(HiraganaToKatakana("ゖ")), "ゖ");
+}
+
+TEST(UnicodeUtilsTest, TrimsWhitespaceAndCountsCodePoints) {
+    EXPECT_EQ(TrimWhitespace("　 今日は\t\n"), "今日は");
+    EXPECT_EQ(TrimWhitespace("a b"), "a b");
+    EXPECT_EQ(TrimWhitespace("　　"), "");
+    EXPECT_EQ(TrimWhitespace(""), "");
+    EXPECT_EQ(CountCodePoints("今日はgood"), 7u);
+    EXPECT_EQ(CountCodePoints("𠮷"), 1u);
+    EXPECT_TRUE(IsWhitespace(U'　'));
+    EXPECT_FALSE(IsWhitespace(U'あ'));
+}
@@ -0,0 +1,144 @@
+// ToriYomi - 게임별 사용자 사전 단위 테스트
+
+#include "core/tokenizer/user_dictionary.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+using namespace toriyomi::tokenizer;
+
+namespace {
+
+Token MakeToken(const char* surface, const char* reading, PartOfSpeech pos = PartOfSpeech::Noun) {
+    Token token;
+    token.surface = surface;
+    token.reading = reading;
+    token.posTag = pos;
+    token.confidence = 1.0f;
+    return token;
+}
+
+}  // namespace
+
+TEST(UserDictionaryTest, LoadsAndSavesWordList) {
+    const auto path = std::filesystem::temp_directory_path() / "toriyomi_test_user_words.tsv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "# 주석\n"
+            << "翠星\tすいせい\t人名\r\n"
+            << "\n"
+            << "アルカディア\n"
+            << "  魔導院 \tまどういん\n";
+    }
+
+    auto words = LoadUserWordList(path);
+    ASSERT_TRUE(words.has_value());
+    ASSERT_EQ(words->size(), 3u);
+    EXPECT_EQ((*words)[0].surface, "翠星");
+    EXPECT_EQ((*words)[0].reading, "すいせい");
+    EXPECT_EQ((*words)[0].category, "人名");
+    EXPECT_EQ((*words)[1].surface, "アルカディア");
+    EXPECT_TRUE((*words)[1].reading.empty());
+    EXPECT_EQ((*words)[2].surface, "魔導院");
+
+    ASSERT_TRUE(SaveUserWordList(path, *words));
+    const auto reloaded = LoadUserWordList(path);
+    ASSERT_TRUE(reloaded.has_value());
+    ASSERT_EQ(reloaded->size(), 3u);
+    EXPECT_EQ((*reloaded)[0].category, "人名");
+    EXPECT_EQ((*reloaded)[2].reading, "まどういん");
+
+    std::filesystem::remove(path);
+    EXPECT_FALSE(LoadUserWordList(path).has_value());
+}
+
+TEST(UserDictionaryTest, FormatsIpadicCsv) {
+    const std::string csv = FormatUserDictionaryCsv({
+        {"翠星", "すいせい", "人名"},
+        {"アルカディア", "", ""},
+        {"翠星", "みどりぼし", ""},     // 중복 표기
+        {"悪,い", "わるい", ""},         // CSV 구분자 포함
+    });
+    EXPECT_EQ(csv,
+              "翠星,,,-1131,名詞,固有名詞,人名,一般,*,*,翠星,スイセイ,スイセイ\n"
+              "アルカディア,,,-5878,名詞,固有名詞,一般,*,*,*,アルカディア,アルカディア,アルカディア\n");
+    EXPECT_TRUE(FormatUserDictionaryCsv({}).empty());
+}
+
+TEST(UserDictionaryTest, ClampsLongWordCostToShortRange) {
+    // 20글자: -400 * 20^1.5 ≈ -35777 → 16비트 하한으로 제한
+    const std::string surface = "アルカディアルミナリアスイセイマドウイン";
+    const std::string csv = FormatUserDictionaryCsv({{surface, "", ""}});
+    EXPECT_EQ(csv.rfind(surface + ",,,-32767,名詞,", 0), 0u);
+}
+
+TEST(UserDictionaryTest, ValidatesCsvBeforeIndexing) {
+    const std::string csv = FormatUserDictionaryCsv({
+        {"翠星", "すいせい", "人名"},
+        {"\xE7\xBF", "", ""},        // 잘린 UTF-8은 건너뜀
+    });
+    EXPECT_EQ(csv.find('\n'), csv.size() - 1);
+    EXPECT_TRUE(ValidateUserDictionaryCsv(csv));
+
+    std::string error;
+    EXPECT_FALSE(ValidateUserDictionaryCsv("", &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(ValidateUserDictionaryCsv("翠星,,,-1131,名詞,固有名詞\n"));
+    EXPECT_FALSE(ValidateUserDictionaryCsv(
+        "翠星,,,-40000,名詞,固有名詞,人名,一般,*,*,翠星,スイセイ,スイセイ\n"));
+    EXPECT_FALSE(ValidateUserDictionaryCsv(
+        "翠星,1,1,-1131,名詞,固有名詞,人名,一般,*,*,翠星,スイセイ,スイセイ\n"));
+    EXPECT_FALSE(ValidateUserDictionaryCsv(
+        "翠星,,,-1131,名詞,固有名詞,人名,一般,*,*,翠星,スイセイ,\n"));
+}
+
+TEST(UserDictionaryTest, BuildFailsWithoutDictionarySources) {
+    const auto dir = std::filesystem::temp_directory_path() / "toriyomi_test_user_dic";
+    std::string error;
+    EXPECT_FALSE(BuildUserDictionary({{"翠星", "すいせい", ""}}, dir / "missing", dir, "game", &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(BuildUserDictionary({}, dir / "missing", dir, "game", &error));
+}
+
+TEST(UserDictionaryTest, TracksFragmentedNouns) {
+    UnknownWordTracker tracker;
+    const std::vector<Token> sentence = {
+        MakeToken("翠", "スイ"), MakeToken("星", "ホシ"), MakeToken("は", "ハ", PartOfSpeech::Particle),
+        MakeToken("ルミナリア", ""), MakeToken("に", "ニ", PartOfSpeech::Particle),
+        MakeToken("本", "ホン"), MakeToken("を", "ヲ", PartOfSpeech::Particle),
+        MakeToken("学校", "ガッコウ"),
+    };
+    for (int i = 0; i < 3; ++i) {
+        tracker.Observe(sentence);
+    }
+    tracker.Observe({MakeToken("翠", "スイ"), MakeToken("星", "ホシ")});
+
+    const auto suggestions = tracker.Suggestions(3, 10);
+    ASSERT_EQ(suggestions.size(), 2u);
+    EXPECT_EQ(suggestions[0].surface, "翠星");
+    EXPECT_EQ(suggestions[0].reading, "スイホシ");
+    EXPECT_EQ(suggestions[0].occurrences, 4u);
+    EXPECT_EQ(suggestions[1].surface, "ルミナリア");
+    EXPECT_TRUE(suggestions[1].reading.empty());
+
+    // 한 글자 명사 하나(本)와 사전 단어(学校)는 후보가 아님
+    EXPECT_EQ(tracker.Suggestions(1, 10).size(), 2u);
+
+    tracker.Forget("翠星");
+    EXPECT_EQ(tracker.Suggestions(1, 10).size(), 1u);
+    tracker.Clear();
+    EXPECT_TRUE(tracker.Suggestions(1, 10).empty());
+}
+
+TEST(UserDictionaryTest, TrackerEvictsRareCandidates) {
+    UnknownWordTracker tracker(2);
+    tracker.Observe({MakeToken("アルファ", "")});
+    tracker.Observe({MakeToken("アルファ", "")});
+    tracker.Observe({MakeToken("ベータ", "")});
+    tracker.Observe({MakeToken("ガンマ", "")});   // 가득 차면 한 번만 나온 ベータ를 버림
+
+    const auto suggestions = tracker.Suggestions(1, 10);
+    ASSERT_EQ(suggestions.size(), 2u);
+    EXPECT_EQ(suggestions[0].surface, "アルファ");
+    EXPECT_EQ(suggestions[1].surface, "ガンマ");
+}
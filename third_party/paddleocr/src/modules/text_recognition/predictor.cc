@@ -77,8 +77,9 @@ TextRecPredictor::Process(std::vector<cv::Mat> &batch_data) {
     exit(-1);
   }
 
-  auto ctc_result =
-      post_op_.at("CTCLabelDecode")->Apply(batch_infer.value()[0]);
+  std::vector<CTCCharTimesteps> ctc_timesteps;
+  auto ctc_result = post_op_.at("CTCLabelDecode")
+                        ->Apply(batch_infer.value()[0], &ctc_timesteps);
 
   if (!ctc_result.ok()) {
     INFOE(ctc_result.status().ToString().c_str());
@@ -96,6 +97,10 @@ TextRecPredictor::Process(std::vector<cv::Mat> &batch_data) {
     predictor_result.input_image = origin_image[i];
     predictor_result.rec_text = ctc_result.value()[i].first;
     predictor_result.rec_score = ctc_result.value()[i].second;
+    if (i < ctc_timesteps.size()) {
+      predictor_result.rec_char_ranges = CharRangesInImage(
+          ctc_timesteps[i], origin_image[i], batch_tobatch.value()[0]);
+    }
     predictor_result.vis_font = params_.vis_font_dir.value_or("");
     predictor_result_vec_.push_back(predictor_result);
     base_cv_result_ptr_vec.push_back(
@@ -104,6 +109,33 @@ TextRecPredictor::Process(std::vector<cv::Mat> &batch_data) {
   return base_cv_result_ptr_vec;
 }
 
+std::vector<std::pair<float, float>>
+TextRecPredictor::CharRangesInImage(const CTCCharTimesteps &timesteps,
+                                    const cv::Mat &image,
+                                    const cv::Mat &batch) const {
+  std::vector<std::pair<float, float>> ranges = {};
+  if (timesteps.seq_len <= 0 || batch.dims < 4 || image.empty()) {
+    return ranges;
+  }
+  // Timesteps cover the padded batch width; the image occupies only the
+  // left ContentWidth() columns of it.
+  const auto *resize_op =
+      static_cast<const OCRReisizeNormImg *>(pre_op_.at("ReisizeNorm").get());
+  int content_w = resize_op->ContentWidth(image);
+  if (content_w <= 0) {
+    return ranges;
+  }
+  float scale = static_cast<float>(batch.size[3]) /
+                (static_cast<float>(timesteps.seq_len) * content_w);
+  ranges.reserve(timesteps.char_ranges.size());
+  for (const auto &range : timesteps.char_ranges) {
+    float begin = std::min(1.0f, range.first * scale);
+    float end = std::min(1.0f, range.second * scale);
+    ranges.push_back({begin, std::max(begin, end)});
+  }
+  return ranges;
+}
+
 absl::Status TextRecPredictor::CheckRecModelParams() {
   auto result_models_check = Utility::GetOcrModelInfo(
       params_.lang.value_or(""), params_.ocr_version.value_or(""));
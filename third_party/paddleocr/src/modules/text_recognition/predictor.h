@@ -25,6 +25,9 @@ struct TextRecPredictorResult {
   cv::Mat input_image;
   std::string rec_text = "";
   float rec_score = 0.0;
+  // Horizontal extent of every character in rec_text as [begin, end)
+  // fractions of the input image width, derived from the CTC timesteps.
+  std::vector<std::pair<float, float>> rec_char_ranges = {};
   std::string vis_font = "";
 };
 
@@ -61,6 +64,10 @@ public:
   absl::Status CheckRecModelParams();
 
 private:
+  std::vector<std::pair<float, float>>
+  CharRangesInImage(const CTCCharTimesteps &timesteps, const cv::Mat &image,
+                    const cv::Mat &batch) const;
+
   std::unordered_map<std::string, std::unique_ptr<CTCLabelDecode>> post_op_;
   std::vector<TextRecPredictorResult> predictor_result_vec_;
   std::unique_ptr<PaddleInfer> infer_ptr_;
@@ -56,6 +56,20 @@ absl::StatusOr<cv::Mat> OCRReisizeNormImg::Resize(cv::Mat &image) const {
   return image_result.value();
 }
 
+int OCRReisizeNormImg::ContentWidth(const cv::Mat &image) const {
+  if (!input_shape_.empty()) {
+    return input_shape_[2];
+  }
+  int rec_h = rec_image_shape_[1];
+  float rec_wh_ratio = (float)rec_image_shape_[2] / (float)rec_image_shape_[1];
+  float image_wh_ratio = (float)image.size[1] / (float)image.size[0];
+  int rec_w = rec_h * std::max(rec_wh_ratio, image_wh_ratio);
+  if (rec_w > MAX_IMG_W) {
+    return MAX_IMG_W;
+  }
+  return std::min(rec_w, (int)std::ceil(rec_h * image_wh_ratio));
+}
+
 absl::StatusOr<cv::Mat> OCRReisizeNormImg::StaticResize(cv::Mat &image) const {
   cv::Mat resize_image;
   int img_c = input_shape_[0];
@@ -147,25 +161,36 @@ CTCLabelDecode::CTCLabelDecode(const std::vector<std::string> &character_list,
 }
 
 absl::StatusOr<std::vector<std::pair<std::string, float>>>
-CTCLabelDecode::Apply(const cv::Mat &preds) const {
+CTCLabelDecode::Apply(const cv::Mat &preds,
+                      std::vector<CTCCharTimesteps> *timesteps) const {
   auto preds_batch = Utility::SplitBatch(preds);
   std::vector<std::pair<std::string, float>> ctc_result = {};
   ctc_result.reserve(preds_batch.value().size());
   if (!preds_batch.ok()) {
     return preds_batch.status();
   }
+  if (timesteps != nullptr) {
+    timesteps->clear();
+    timesteps->reserve(preds_batch.value().size());
+  }
   for (const auto &pred : preds_batch.value()) {
-    auto result = Process(pred);
+    CTCCharTimesteps item_timesteps;
+    auto result =
+        Process(pred, timesteps != nullptr ? &item_timesteps : nullptr);
     if (!result.ok()) {
       return result.status();
     }
     ctc_result.push_back(result.value());
+    if (timesteps != nullptr) {
+      timesteps->push_back(std::move(item_timesteps));
+    }
   }
   return ctc_result;
 }
 
 absl::StatusOr<std::pair<std::string, float>>
-CTCLabelDecode::Process(const cv::Mat &pred_data) const {
+CTCLabelDecode::Process(const cv::Mat &pred_data,
+                        CTCCharTimesteps *timesteps) const {
   std::vector<int> shape_squeeze = {};
   for (int i = 1; i < pred_data.dims; i++) {
     shape_squeeze.push_back(pred_data.size[i]);
@@ -190,6 +215,26 @@ CTCLabelDecode::Process(const cv::Mat &pred_data) const {
     text_index.push_back(max_idx);
     text_prob.push_back(max_val);
   }
+  if (timesteps != nullptr) {
+    // Same selection as Decode(): a character starts where the argmax changes
+    // to a non-blank index and extends over its repeated timesteps.
+    timesteps->seq_len = seq_len;
+    timesteps->char_ranges.clear();
+    int t = 0;
+    int prev_idx = -1;
+    for (auto it = text_index.begin(); it != text_index.end(); ++it, ++t) {
+      bool is_ignored = std::find(IGNORE_TOKEN.begin(), IGNORE_TOKEN.end(),
+                                  *it) != IGNORE_TOKEN.end();
+      if (!is_ignored) {
+        if (*it != prev_idx) {
+          timesteps->char_ranges.push_back({t, t + 1});
+        } else {
+          timesteps->char_ranges.back().second = t + 1;
+        }
+      }
+      prev_idx = *it;
+    }
+  }
   auto decode_result = Decode(text_index, text_prob, true);
   if (!decode_result.ok()) {
     return decode_result.status();
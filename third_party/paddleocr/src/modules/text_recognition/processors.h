@@ -38,6 +38,9 @@ public:
   absl::StatusOr<cv::Mat> StaticResize(cv::Mat &image) const;
   absl::StatusOr<cv::Mat> ResizeNormImg(cv::Mat &image,
                                         float max_wh_ratio) const;
+  // Width of the resized image content inside the zero-padded output of
+  // Apply(), used to map recognizer timesteps back to input image columns.
+  int ContentWidth(const cv::Mat &image) const;
   static constexpr int MAX_IMG_W = 3200;
 
 private:
@@ -45,14 +48,24 @@ private:
   std::vector<int> input_shape_;
 };
 
+// Timestep ranges of the characters emitted by CTCLabelDecode, one
+// [begin, end) pair per decoded character, out of seq_len timesteps.
+struct CTCCharTimesteps {
+  std::vector<std::pair<int, int>> char_ranges = {};
+  int seq_len = 0;
+};
+
 class CTCLabelDecode {
 public:
   CTCLabelDecode(const std::vector<std::string> &character_list = {},
                  bool use_space_char = true);
+  // When timesteps is not null it receives one entry per batch item.
   absl::StatusOr<std::vector<std::pair<std::string, float>>>
-  Apply(const cv::Mat &preds) const;
+  Apply(const cv::Mat &preds,
+        std::vector<CTCCharTimesteps> *timesteps = nullptr) const;
   absl::StatusOr<std::pair<std::string, float>>
-  Process(const cv::Mat &pred_data) const;
+  Process(const cv::Mat &pred_data,
+          CTCCharTimesteps *timesteps = nullptr) const;
   absl::StatusOr<std::pair<std::string, float>>
   Decode(std::list<int> &text_index, std::list<float> &text_prob,
          bool is_remove_duplicate = false) const;
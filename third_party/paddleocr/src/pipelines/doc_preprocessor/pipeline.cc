@@ -120,26 +120,44 @@ _DocPreprocessorPipeline::_DocPreprocessorPipeline(
 
 std::vector<std::unique_ptr<BaseCVResult>>
 _DocPreprocessorPipeline::Predict(const std::vector<std::string> &input) {
-  auto model_setting = GetModelSettings();
-  auto status = CheckModelSettingsVaild(model_setting);
-  if (!status.ok()) {
-    INFOE("the input params for model settings are invalid!: %s",
-          status.ToString().c_str());
+  auto batches = batch_sampler_ptr_->Apply(input);
+  if (!batches.ok()) {
+    INFOE("pipeline get sample fail : %s", batches.status().ToString().c_str());
     exit(-1);
   }
+  auto input_path = batch_sampler_ptr_->InputPath();
+  return PredictInternal(batches.value(), input_path);
+};
+
+std::vector<std::unique_ptr<BaseCVResult>>
+_DocPreprocessorPipeline::Predict(const std::vector<cv::Mat> &input) {
   auto batches = batch_sampler_ptr_->Apply(input);
   if (!batches.ok()) {
     INFOE("pipeline get sample fail : %s", batches.status().ToString().c_str());
     exit(-1);
   }
   auto input_path = batch_sampler_ptr_->InputPath();
+  return PredictInternal(batches.value(), input_path);
+}
+
+std::vector<std::unique_ptr<BaseCVResult>>
+_DocPreprocessorPipeline::PredictInternal(
+    const std::vector<std::vector<cv::Mat>> &batches,
+    const std::vector<std::string> &input_path) {
+  auto model_setting = GetModelSettings();
+  auto status = CheckModelSettingsVaild(model_setting);
+  if (!status.ok()) {
+    INFOE("the input params for model settings are invalid!: %s",
+          status.ToString().c_str());
+    exit(-1);
+  }
   int index = 0;
   std::vector<cv::Mat> origin_image = {};
 
   std::vector<std::unique_ptr<BaseCVResult>> base_cv_result_ptr_vec = {};
   std::vector<DocPreprocessorPipelineResult> pipeline_result_vec = {};
   pipeline_result_vec_.clear();
-  for (auto &batch_data : batches.value()) {
+  for (auto &batch_data : batches) {
     origin_image.reserve(batch_data.size());
     for (const auto &mat : batch_data) {
       origin_image.push_back(mat.clone());
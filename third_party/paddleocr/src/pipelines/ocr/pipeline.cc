@@ -271,6 +271,23 @@ std::unordered_map<std::string, bool> _OCRPipeline::GetModelSettings() const {
   return model_settings;
 }
 
+void _OCRPipeline::SetOrientationOverrides(
+    absl::optional<int> doc_orientation_angle,
+    absl::optional<int> textline_orientation_angle) {
+  doc_orientation_override_ = doc_orientation_angle;
+  textline_orientation_override_ = textline_orientation_angle;
+}
+
+void _OCRPipeline::SetBoxFilter(BoxFilter box_filter) {
+  box_filter_ = std::move(box_filter);
+}
+
+void _OCRPipeline::SetDetectionTiling(DetectionTilePlanner planner,
+                                      DetectionTileMerger merger) {
+  tile_planner_ = std::move(planner);
+  tile_merger_ = std::move(merger);
+}
+
 std::vector<std::unique_ptr<BaseCVResult>>
 _OCRPipeline::Predict(const std::vector<std::string> &input) {
   auto batches = batch_sampler_ptr_->Apply(input);
@@ -315,15 +332,33 @@ std::vector<std::unique_ptr<BaseCVResult>> _OCRPipeline::PredictInternal(
     const auto &batch = batches[batch_idx];
 
     std::vector<DocPreprocessorPipelineResult> doc_results;
-    if (use_doc_preprocessor_) {
-      if (string_batches == nullptr) {
-        INFOE("Doc preprocessor requires file path inputs when running with cv::Mat data.");
-        exit(-1);
+    auto *doc_pipeline =
+        static_cast<_DocPreprocessorPipeline *>(doc_preprocessors_pipeline_.get());
+    if (use_doc_preprocessor_ && !use_doc_unwarping_ &&
+        doc_orientation_override_.has_value()) {
+      const int angle = doc_orientation_override_.value();
+      for (const auto &image : batch) {
+        auto result_rotate = ComponentsProcessor::RotateImage(image, angle);
+        if (!result_rotate.ok()) {
+          INFOE("RotateImage fail : %s",
+                result_rotate.status().ToString().c_str());
+          exit(-1);
+        }
+        DocPreprocessorPipelineResult result;
+        result.input_image = image;
+        result.model_settings = doc_pipeline->GetModelSettings();
+        result.angle = angle;
+        result.rotate_image = result_rotate.value();
+        result.output_image = result.rotate_image;
+        doc_results.push_back(result);
+      }
+    } else if (use_doc_preprocessor_) {
+      if (string_batches != nullptr) {
+        doc_pipeline->Predict((*string_batches)[batch_idx]);
+      } else {
+        doc_pipeline->Predict(batch);
       }
-      doc_preprocessors_pipeline_->Predict((*string_batches)[batch_idx]);
-      doc_results = static_cast<_DocPreprocessorPipeline *>(
-                        doc_preprocessors_pipeline_.get())
-                        ->PipelineResult();
+      doc_results = doc_pipeline->PipelineResult();
     } else {
       DocPreprocessorPipelineResult result;
       for (const auto &image : batch) {
@@ -339,14 +374,54 @@ std::vector<std::unique_ptr<BaseCVResult>> _OCRPipeline::PredictInternal(
       doc_images_copy.push_back(item.output_image.clone());
     }
 
-    text_det_model_->Predict(doc_images_copy);
+    // Large images are split into equally sized tiles so that they can be
+    // detected in batches without downscaling.
+    std::vector<std::vector<cv::Rect>> det_tiles(doc_images.size());
+    std::vector<cv::Mat> det_inputs;
+    for (size_t j = 0; j < doc_images.size(); ++j) {
+      if (tile_planner_ && tile_merger_) {
+        det_tiles[j] = tile_planner_(doc_images[j].size());
+      }
+      if (det_tiles[j].size() > 1) {
+        for (const auto &tile : det_tiles[j]) {
+          det_inputs.push_back(doc_images[j](tile).clone());
+        }
+      } else {
+        det_tiles[j].clear();
+        det_inputs.push_back(std::move(doc_images_copy[j]));
+      }
+    }
+
+    text_det_model_->Predict(det_inputs);
     std::vector<TextDetPredictorResult> det_results =
         static_cast<TextDetPredictor *>(text_det_model_.get())
             ->PredictorResult();
     std::vector<std::vector<std::vector<cv::Point2f>>> dt_polys_list;
-    for (auto &item : det_results) {
-      if (!item.dt_polys.empty()) {
-        dt_polys_list.push_back(sort_boxes_(item.dt_polys));
+    size_t det_cursor = 0;
+    for (size_t j = 0; j < doc_images.size(); ++j) {
+      std::vector<std::vector<cv::Point2f>> polys;
+      if (det_tiles[j].empty()) {
+        if (det_cursor < det_results.size()) {
+          polys = std::move(det_results[det_cursor].dt_polys);
+        }
+        ++det_cursor;
+      } else {
+        std::vector<std::vector<std::vector<cv::Point2f>>> tile_polys;
+        tile_polys.reserve(det_tiles[j].size());
+        for (size_t t = 0; t < det_tiles[j].size(); ++t, ++det_cursor) {
+          tile_polys.push_back(det_cursor < det_results.size()
+                                   ? std::move(det_results[det_cursor].dt_polys)
+                                   : std::vector<std::vector<cv::Point2f>>{});
+        }
+        polys = tile_merger_(tile_polys, det_tiles[j], doc_images[j].size());
+      }
+
+      if (!polys.empty()) {
+        auto sorted_polys = sort_boxes_(polys);
+        if (box_filter_) {
+          sorted_polys = box_filter_(sorted_polys, doc_images[j].size());
+        }
+        dt_polys_list.push_back(std::move(sorted_polys));
       } else {
         dt_polys_list.push_back({});
       }
@@ -388,18 +463,28 @@ std::vector<std::unique_ptr<BaseCVResult>> _OCRPipeline::PredictInternal(
                                 crops.value().end());
         chunk_indices.emplace_back(chunk_indices.back() + crops.value().size());
       }
-      for (auto &img : all_subs_of_imgs) {
-        all_subs_of_imgs_copy.push_back(img.clone());
+      const bool run_textline_classifier =
+          model_settings["use_textline_orientation"] &&
+          !textline_orientation_override_.has_value();
+      if (run_textline_classifier) {
+        for (auto &img : all_subs_of_imgs) {
+          all_subs_of_imgs_copy.push_back(img.clone());
+        }
       }
 
       std::vector<int> angles;
       if (model_settings["use_textline_orientation"]) {
-        textline_orientation_model_->Predict(all_subs_of_imgs_copy);
-        auto textline_orientation_model_results =
-            static_cast<ClasPredictor *>(textline_orientation_model_.get())
-                ->PredictorResult();
-        for (auto &result_angle : textline_orientation_model_results) {
-          angles.push_back(result_angle.class_ids[0]);
+        if (!run_textline_classifier) {
+          angles = std::vector<int>(all_subs_of_imgs.size(),
+                                    textline_orientation_override_.value());
+        } else {
+          textline_orientation_model_->Predict(all_subs_of_imgs_copy);
+          auto textline_orientation_model_results =
+              static_cast<ClasPredictor *>(textline_orientation_model_.get())
+                  ->PredictorResult();
+          for (auto &result_angle : textline_orientation_model_results) {
+            angles.push_back(result_angle.class_ids[0]);
+          }
         }
         auto rotated = RotateImage(all_subs_of_imgs, angles);
         if (!rotated.ok()) {
@@ -453,6 +538,15 @@ std::vector<std::unique_ptr<BaseCVResult>> _OCRPipeline::PredictInternal(
           if (rec_res.rec_score >= text_rec_score_thresh_) {
             results[indices[l]].rec_texts.push_back(rec_res.rec_text);
             results[indices[l]].rec_scores.push_back(rec_res.rec_score);
+            // A line recognized upside down reads right to left in the crop.
+            auto char_ranges = rec_res.rec_char_ranges;
+            if (angles[chunk_indices[l] + sno] == 1) {
+              for (auto &range : char_ranges) {
+                range = {1.0f - range.second, 1.0f - range.first};
+              }
+            }
+            results[indices[l]].rec_char_ranges.push_back(
+                std::move(char_ranges));
             results[indices[l]].rec_polys.push_back(dt_polys_list[l][sno]);
             results[indices[l]].vis_fonts = rec_res.vis_font;
           }
@@ -647,6 +741,17 @@ void _OCRPipeline::OverrideConfig() {
       data[key] = params_.text_recognition_model_dir.value();
     }
   }
+  if (params_.text_detection_batch_size.has_value()) {
+    auto it = config_.FindKey("TextDetection.batch_size");
+    if (!it.ok()) {
+      data["SubModules.TextDetection.batch_size"] =
+          std::to_string(params_.text_detection_batch_size.value());
+    } else {
+      auto key = it.value().first;
+      data.erase(data.find(key));
+      data[key] = std::to_string(params_.text_detection_batch_size.value());
+    }
+  }
   if (params_.text_recognition_batch_size.has_value()) {
     auto it = config_.FindKey("TextRecognition.batch_size");
     if (!it.ok()) {
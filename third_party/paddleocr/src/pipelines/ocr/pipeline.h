@@ -51,6 +51,9 @@ struct OCRPipelineResult {
   float text_rec_score_thresh = 0.0;
   std::vector<std::string> rec_texts = {};
   std::vector<float> rec_scores = {};
+  // Per-character [begin, end) fractions along each text line, in reading
+  // direction of the unrotated crop (top to bottom for vertical lines).
+  std::vector<std::vector<std::pair<float, float>>> rec_char_ranges = {};
   std::vector<int> textline_orientation_angles = {};
   std::vector<std::vector<cv::Point2f>> rec_polys = {};
   std::vector<std::array<float, 4>> rec_boxes = {};
@@ -72,6 +75,7 @@ struct OCRPipelineParams {
   absl::optional<std::string> text_recognition_model_name = absl::nullopt;
   absl::optional<std::string> text_recognition_model_dir = absl::nullopt;
   absl::optional<int> text_recognition_batch_size = absl::nullopt;
+  absl::optional<int> text_detection_batch_size = absl::nullopt;
   absl::optional<bool> use_doc_orientation_classify = absl::nullopt;
   absl::optional<bool> use_doc_unwarping = absl::nullopt;
   absl::optional<bool> use_textline_orientation = absl::nullopt;
@@ -120,6 +124,28 @@ public:
 
   void OverrideConfig();
 
+  // Fixed orientation angles that bypass the doc orientation / textline
+  // orientation classifiers while set (absl::nullopt runs the classifier).
+  void SetOrientationOverrides(absl::optional<int> doc_orientation_angle,
+                               absl::optional<int> textline_orientation_angle);
+
+  // Optional hook applied to the sorted detection boxes of each image before
+  // they are cropped and recognized (e.g. to drop ruby or UI glyph boxes).
+  using BoxFilter = std::function<std::vector<std::vector<cv::Point2f>>(
+      const std::vector<std::vector<cv::Point2f>> &, const cv::Size &)>;
+  void SetBoxFilter(BoxFilter box_filter);
+
+  // Optional detection tiling for large frames. The planner returns the tile
+  // rectangles for an image (one rectangle disables tiling); the merger maps
+  // per-tile polys back to image coordinates and removes seam duplicates.
+  using DetectionTilePlanner =
+      std::function<std::vector<cv::Rect>(const cv::Size &)>;
+  using DetectionTileMerger = std::function<std::vector<std::vector<cv::Point2f>>(
+      const std::vector<std::vector<std::vector<cv::Point2f>>> &,
+      const std::vector<cv::Rect> &, const cv::Size &)>;
+  void SetDetectionTiling(DetectionTilePlanner planner,
+                          DetectionTileMerger merger);
+
   std::vector<std::unique_ptr<BaseCVResult>>
   PredictInternal(const std::vector<std::vector<cv::Mat>> &batches,
                   const std::vector<std::string> &input_path,
@@ -142,6 +168,11 @@ private:
   std::function<std::vector<std::vector<cv::Point2f>>(
       const std::vector<std::vector<cv::Point2f>> &)>
       sort_boxes_;
+  BoxFilter box_filter_;
+  DetectionTilePlanner tile_planner_;
+  DetectionTileMerger tile_merger_;
+  absl::optional<int> doc_orientation_override_ = absl::nullopt;
+  absl::optional<int> textline_orientation_override_ = absl::nullopt;
   float text_rec_score_thresh_ = 0.0;
   std::string text_type_;
   TextDetParams text_det_params_;
@@ -0,0 +1,49 @@
+// ToriYomi - JMdict 사전 컴파일러
+// 사용법: toriyomi_jmdict_compiler <JMdict.xml> <출력.tydict> [--lang eng]
+
+#include "core/dictionary/dictionary_builder.h"
+#include "core/dictionary/jmdict_parser.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace toriyomi::dictionary;
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <JMdict.xml> <output.tydict> [--lang eng]\n";
+        return 2;
+    }
+
+    JmdictParseOptions options;
+    for (int i = 3; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--lang") == 0) {
+            options.glossLanguage = argv[++i];
+        }
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input) {
+        std::cerr << "cannot open " << argv[1] << "\n";
+        return 1;
+    }
+
+    DictionaryBuilder builder;
+    std::string error;
+    if (!ParseJmdict(input, [&builder](DictionaryEntry&& entry) { builder.AddEntry(std::move(entry)); }, options, &error)) {
+        std::cerr << "parse failed: " << error << "\n";
+        return 1;
+    }
+    if (!builder.WriteToFile(argv[2], &error)) {
+        std::cerr << "write failed: " << error << "\n";
+        return 1;
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - started);
+    std::cout << builder.EntryCount() << " entries -> " << argv[2] << " (" << elapsed.count() << " ms)\n";
+    return 0;
+}